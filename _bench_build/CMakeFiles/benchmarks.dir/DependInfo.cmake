@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmark/simd_algorithm_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_algorithm_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_algorithm_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_backend_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_backend_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_backend_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_benchmark_main.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_benchmark_main.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_benchmark_main.cpp.o.d"
+  "/root/repo/benchmark/simd_complex_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_complex_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_complex_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_compression_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_compression_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_compression_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_fft_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_fft_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_fft_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_filter_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_filter_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_filter_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_half_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_half_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_half_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_hash_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_hash_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_hash_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_knn_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_knn_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_knn_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_lut_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_lut_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_lut_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_mapped_stream_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_mapped_stream_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_mapped_stream_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_math_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_math_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_math_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_matrix_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_matrix_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_matrix_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_parse_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_parse_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_parse_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_polynomial_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_polynomial_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_polynomial_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_random_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_random_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_random_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_sort_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_sort_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_sort_benchmark.cpp.o.d"
+  "/root/repo/benchmark/simd_string_benchmark.cpp" "CMakeFiles/benchmarks.dir/benchmark/simd_string_benchmark.cpp.o" "gcc" "CMakeFiles/benchmarks.dir/benchmark/simd_string_benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks.dir/benchmark/simd_algorithm_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_algorithm_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_backend_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_backend_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_benchmark_main.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_benchmark_main.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_complex_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_complex_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_compression_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_compression_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_fft_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_fft_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_filter_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_filter_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_half_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_half_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_hash_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_hash_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_knn_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_knn_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_lut_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_lut_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_mapped_stream_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_mapped_stream_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_math_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_math_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_matrix_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_matrix_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_parse_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_parse_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_polynomial_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_polynomial_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_random_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_random_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_sort_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_sort_benchmark.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_string_benchmark.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmark/simd_string_benchmark.cpp.o.d"
+  "benchmarks"
+  "benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
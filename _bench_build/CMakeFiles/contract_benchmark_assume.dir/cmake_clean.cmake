@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/contract_benchmark_assume.dir/benchmark/simd_contract_benchmark.cpp.o"
+  "CMakeFiles/contract_benchmark_assume.dir/benchmark/simd_contract_benchmark.cpp.o.d"
+  "contract_benchmark_assume"
+  "contract_benchmark_assume.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/contract_benchmark_assume.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
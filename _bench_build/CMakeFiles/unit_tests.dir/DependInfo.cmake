@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/simd_algorithm_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_algorithm_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_algorithm_unit_test.cpp.o.d"
+  "/root/repo/test/simd_complex_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_complex_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_complex_unit_test.cpp.o.d"
+  "/root/repo/test/simd_compression_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_compression_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_compression_unit_test.cpp.o.d"
+  "/root/repo/test/simd_counting_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_counting_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_counting_unit_test.cpp.o.d"
+  "/root/repo/test/simd_fft_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_fft_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_fft_unit_test.cpp.o.d"
+  "/root/repo/test/simd_filter_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_filter_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_filter_unit_test.cpp.o.d"
+  "/root/repo/test/simd_hash_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_hash_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_hash_unit_test.cpp.o.d"
+  "/root/repo/test/simd_knn_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_knn_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_knn_unit_test.cpp.o.d"
+  "/root/repo/test/simd_lut_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_lut_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_lut_unit_test.cpp.o.d"
+  "/root/repo/test/simd_mapped_stream_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_mapped_stream_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_mapped_stream_unit_test.cpp.o.d"
+  "/root/repo/test/simd_mask_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_mask_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_mask_unit_test.cpp.o.d"
+  "/root/repo/test/simd_math_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_math_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_math_unit_test.cpp.o.d"
+  "/root/repo/test/simd_matrix_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_matrix_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_matrix_unit_test.cpp.o.d"
+  "/root/repo/test/simd_parse_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_parse_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_parse_unit_test.cpp.o.d"
+  "/root/repo/test/simd_polynomial_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_polynomial_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_polynomial_unit_test.cpp.o.d"
+  "/root/repo/test/simd_profile_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_profile_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_profile_unit_test.cpp.o.d"
+  "/root/repo/test/simd_random_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_random_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_random_unit_test.cpp.o.d"
+  "/root/repo/test/simd_sort_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_sort_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_sort_unit_test.cpp.o.d"
+  "/root/repo/test/simd_string_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_string_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_string_unit_test.cpp.o.d"
+  "/root/repo/test/simd_unit_test.cpp" "CMakeFiles/unit_tests.dir/test/simd_unit_test.cpp.o" "gcc" "CMakeFiles/unit_tests.dir/test/simd_unit_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/_build/googletest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/_build/googletest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
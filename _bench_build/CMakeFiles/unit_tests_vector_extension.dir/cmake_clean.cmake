@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_algorithm_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_algorithm_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_complex_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_complex_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_compression_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_compression_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_counting_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_counting_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_fft_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_fft_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_filter_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_filter_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_hash_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_hash_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_knn_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_knn_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_lut_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_lut_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_mapped_stream_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_mapped_stream_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_mask_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_mask_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_math_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_math_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_matrix_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_matrix_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_parse_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_parse_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_polynomial_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_polynomial_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_profile_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_profile_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_random_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_random_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_sort_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_sort_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_string_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_string_unit_test.cpp.o.d"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_unit_test.cpp.o"
+  "CMakeFiles/unit_tests_vector_extension.dir/test/simd_unit_test.cpp.o.d"
+  "unit_tests_vector_extension"
+  "unit_tests_vector_extension.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests_vector_extension.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
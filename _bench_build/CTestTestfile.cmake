@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_bench_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests "/root/repo/_bench_build/unit_tests")
+set_tests_properties(unit_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;70;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(unit_tests_vector_extension "/root/repo/_bench_build/unit_tests_vector_extension")
+set_tests_properties(unit_tests_vector_extension PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;75;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("_build/googletest")
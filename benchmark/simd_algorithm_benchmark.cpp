@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_algorithm.h"
+#include "simd_benchmark_profile.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+void ScalarInclusiveScan(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> x(n, 1.0F);
+  std::vector<float> y(n);
+
+  for (auto _ : profiled{state}) {
+    float sum{};
+    for (std::size_t i{}; i < n; ++i) {
+      sum += x[i];
+      y[i] = sum;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdInclusiveScan(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> x(n, 1.0F);
+  std::vector<float> y(n);
+
+  for (auto _ : profiled{state}) {
+    simd_inclusive_scan(x.data(), x.data() + n, y.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+std::vector<float> Random(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{0.0F, 1.0F};
+  std::vector<float> v(n);
+  std::generate(v.begin(), v.end(), [&]() { return distribution(engine); });
+  return v;
+}
+
+// the only match is the last element
+void StdFindIf(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> x(n, 1.0F);
+  x.back() = -1.0F;
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(std::find_if(x.begin(), x.end(), [](const float v) { return v < 0.0F; }));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdFindIf(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> x(n, 1.0F);
+  x.back() = -1.0F;
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(
+        simd_find_if(x.data(), x.data() + n, [](const simd<float> &v) { return v < simd<float>{0.0F}; }));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void StdCountIf(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(std::count_if(x.begin(), x.end(), [](const float v) { return v < 0.5F; }));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+void SimdCountIf(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(
+        simd_count_if(x.data(), x.data() + x.size(), [](const simd<float> &v) { return v < simd<float>{0.5F}; }));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+void StdMinElement(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(std::min_element(x.begin(), x.end()));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+void SimdMinElement(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_min_element(x.data(), x.data() + x.size()));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+// nearest neighbour of a query point in one dimension
+void ScalarArgmin(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+
+  for (auto _ : profiled{state}) {
+    std::size_t index{};
+    float best{(x[0] - 0.3F) * (x[0] - 0.3F)};
+    for (std::size_t i{1U}; i < x.size(); ++i) {
+      const float d{(x[i] - 0.3F) * (x[i] - 0.3F)};
+      if (d < best) {
+        best = d;
+        index = i;
+      }
+    }
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+void SimdArgmin(benchmark::State &state) {
+  const std::vector<float> x{Random(static_cast<std::size_t>(state.range(0)))};
+  const auto distance = [](const simd<float> &v) {
+    const simd<float> d{v - simd<float>{0.3F}};
+    return d * d;
+  };
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_argmin(x.data(), x.data() + x.size(), distance));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+// 4 KiB (L1) to 1 MiB (L2) of input
+BENCHMARK(ScalarInclusiveScan)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdInclusiveScan)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdFindIf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdFindIf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdCountIf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdCountIf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdMinElement)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdMinElement)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(ScalarArgmin)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdArgmin)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+
+#include "detail/simd_vector_extension_backend.h"
+#include "simd.h"
+#include "simd_benchmark_profile.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+template <typename Abi> void Axpy(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> x(n, 1.0F);
+  const std::vector<float> y(n, 2.0F);
+  std::vector<float> z(n);
+  const V a{3.0F};
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V vx;
+      V vy;
+      vx.copy_from(&x[i], element_aligned);
+      vy.copy_from(&y[i], element_aligned);
+      (a * vx + vy).copy_to(&z[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * 3U * sizeof(float)));
+}
+
+template <typename Abi> void MaskedUpdate(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> x(n);
+  for (std::size_t i{}; i < n; ++i) {
+    x[i] = static_cast<float>(i % 7U) - 3.0F;
+  }
+  const V low{-2.0F};
+  const V high{2.0F};
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V v;
+      v.copy_from(&x[i], element_aligned);
+      v = clamp(v, low, high);
+      where(v < V{0.0F}, v) *= V{0.5F};
+      v.copy_to(&x[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * 2U * sizeof(float)));
+}
+
+template <typename Abi> void AnyNan(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> x(n, 1.0F);
+
+  for (auto _ : profiled{state}) {
+    bool found{false};
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V v;
+      v.copy_from(&x[i], element_aligned);
+      found = found || any_of(is_nan(v));
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * sizeof(float)));
+}
+
+#if defined(__SSE4_2__) && defined(__linux__)
+BENCHMARK_TEMPLATE(Axpy, detail::sse)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(MaskedUpdate, detail::sse)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(AnyNan, detail::sse)->Range(1 << 10, 1 << 20);
+#endif
+BENCHMARK_TEMPLATE(Axpy, simd_abi::vector_extension<4>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(Axpy, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(Axpy, simd_abi::vector_extension<16>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(MaskedUpdate, simd_abi::vector_extension<4>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(MaskedUpdate, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(MaskedUpdate, simd_abi::vector_extension<16>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(AnyNan, simd_abi::vector_extension<4>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(AnyNan, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(AnyNan, simd_abi::vector_extension<16>)->Range(1 << 10, 1 << 20);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Adds the bytes and items per cycle to the counters reported by profiled, i.e., whether a benchmark is bound by the
+// memory bandwidth or by the computation.
+class ProfileReporter : public benchmark::ConsoleReporter {
+public:
+  void ReportRuns(const std::vector<Run> &reports) override {
+    std::vector<Run> runs{reports};
+    for (Run &run : runs) {
+      const auto cycles{run.counters.find("cycles")};
+      if ((run.run_type != Run::RT_Iteration) || (cycles == run.counters.end()) || (run.iterations == 0)) {
+        continue;
+      }
+      // the rates are per second of CPU time, the cycles per iteration
+      const double seconds{run.cpu_accumulated_time / static_cast<double>(run.iterations)};
+      PerCycle(run, "bytes_per_second", "B/cycle", seconds, cycles->second.value);
+      PerCycle(run, "items_per_second", "items/cycle", seconds, cycles->second.value);
+    }
+    ConsoleReporter::ReportRuns(runs);
+  }
+
+private:
+  static void PerCycle(Run &run, const std::string &rate, const std::string &name, const double seconds,
+                       const double cycles) {
+    const auto it{run.counters.find(rate)};
+    if ((it != run.counters.end()) && (cycles > 0.0)) {
+      run.counters[name] = it->second.value * seconds / cycles;
+    }
+  }
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+  // the derived counters are only added to the console output
+  bool console{true};
+  for (int i{1}; i < argc; ++i) {
+    console = console && ((std::strncmp(argv[i], "--benchmark_format=", 19) != 0) ||
+                          (std::strcmp(argv[i], "--benchmark_format=console") == 0));
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  if (console) {
+    ProfileReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+  } else {
+    benchmark::RunSpecifiedBenchmarks();
+  }
+  benchmark::Shutdown();
+  return 0;
+}
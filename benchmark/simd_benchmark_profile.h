@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_BENCHMARK_PROFILE_H
+#define SIMD_BENCHMARK_PROFILE_H
+
+#include "simd_profile.h"
+#include <benchmark/benchmark.h>
+#include <source_location>
+#include <string>
+
+namespace parallelism_v2 {
+
+// The benchmark loop of state measured by a kernel_profile, i.e., `for (auto _ : profiled{state})`. Reports the
+// instructions per cycle and the cycles and misses per iteration as counters of the benchmark, from which the reporter
+// of the benchmark main derives the bytes and items per cycle. Reports nothing if the counters are unavailable.
+class profiled {
+public:
+  explicit profiled(benchmark::State &state,
+                    const std::source_location location = std::source_location::current()) noexcept
+      : state_{state}, profile_{location.function_name()} {}
+
+  profiled(const profiled &) = delete;
+  profiled &operator=(const profiled &) = delete;
+
+  ~profiled() {
+    const hardware_counts c{profile_.counts()};
+    const bool cycles{hardware_event_available(hardware_event::cycles) && (c[hardware_event::cycles] != 0U)};
+    if (cycles) {
+      state_.counters["cycles"] = benchmark::Counter(c[hardware_event::cycles], benchmark::Counter::kAvgIterations);
+    }
+    if (cycles && hardware_event_available(hardware_event::instructions)) {
+      state_.counters["IPC"] =
+          static_cast<double>(c[hardware_event::instructions]) / static_cast<double>(c[hardware_event::cycles]);
+    }
+    Report(c, hardware_event::l1d_misses, "L1D-miss");
+    Report(c, hardware_event::llc_misses, "LLC-miss");
+    Report(c, hardware_event::branch_misses, "br-miss");
+  }
+
+  benchmark::State::StateIterator begin() { return state_.begin(); }
+  benchmark::State::StateIterator end() { return state_.end(); }
+
+private:
+  void Report(const hardware_counts &c, const hardware_event e, const std::string &name) {
+    if (hardware_event_available(e)) {
+      state_.counters[name] = benchmark::Counter(c[e], benchmark::Counter::kAvgIterations);
+    }
+  }
+
+  benchmark::State &state_;
+  kernel_profile profile_;
+};
+
+} // namespace parallelism_v2
+
+#endif // SIMD_BENCHMARK_PROFILE_H
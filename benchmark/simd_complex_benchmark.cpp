@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_complex.h"
+#include <benchmark/benchmark.h>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<std::complex<float>> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<std::complex<float>> v(n);
+  for (std::complex<float> &x : v) {
+    x = std::complex<float>{distribution(engine), distribution(engine)};
+  }
+  return v;
+}
+
+// element-wise product of two interleaved arrays, e.g., applying a filter in the frequency domain
+void StdComplexMultiply(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  const std::vector<std::complex<float>> b{Random(n, 2U)};
+  std::vector<std::complex<float>> c(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; ++i) {
+      c[i] = a[i] * b[i];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdComplexMultiplyInterleaved(benchmark::State &state) {
+  using C = complex_simd<float>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  const std::vector<std::complex<float>> b{Random(n, 2U)};
+  std::vector<std::complex<float>> c(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += C::size()) {
+      C x;
+      C y;
+      x.copy_from(&a[i], element_aligned);
+      y.copy_from(&b[i], element_aligned);
+      (x * y).copy_to(&c[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdMultiplyInterleaved(benchmark::State &state) {
+  using V = fixed_size_simd<float, 4>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  const std::vector<std::complex<float>> b{Random(n, 2U)};
+  std::vector<std::complex<float>> c(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += 2U) {
+      V x;
+      V y;
+      x.copy_from(reinterpret_cast<const float *>(&a[i]), element_aligned);
+      y.copy_from(reinterpret_cast<const float *>(&b[i]), element_aligned);
+      multiply_interleaved(x, y).copy_to(reinterpret_cast<float *>(&c[i]), element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdComplexMultiplySplit(benchmark::State &state) {
+  using C = complex_simd<float>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  const std::vector<std::complex<float>> b{Random(n, 2U)};
+  std::vector<float> are(n);
+  std::vector<float> aim(n);
+  std::vector<float> bre(n);
+  std::vector<float> bim(n);
+  for (std::size_t i{}; i < n; ++i) {
+    are[i] = a[i].real();
+    aim[i] = a[i].imag();
+    bre[i] = b[i].real();
+    bim[i] = b[i].imag();
+  }
+  std::vector<float> cre(n);
+  std::vector<float> cim(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += C::size()) {
+      C x;
+      C y;
+      x.copy_from(&are[i], &aim[i], element_aligned);
+      y.copy_from(&bre[i], &bim[i], element_aligned);
+      (x * y).copy_to(&cre[i], &cim[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void StdComplexAbs(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  std::vector<float> c(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; ++i) {
+      c[i] = std::abs(a[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdComplexAbs(benchmark::State &state) {
+  using C = complex_simd<float>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::complex<float>> a{Random(n, 1U)};
+  std::vector<float> c(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += C::size()) {
+      C x;
+      x.copy_from(&a[i], element_aligned);
+      abs(x).copy_to(&c[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// 8 KiB (L1) to 2 MiB (L2) per input
+BENCHMARK(StdComplexMultiply)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdComplexMultiplyInterleaved)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdMultiplyInterleaved)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdComplexMultiplySplit)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdComplexAbs)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdComplexAbs)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_compression.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+constexpr std::size_t count{1U << 16};
+
+std::vector<std::uint32_t> Random(const unsigned bits) {
+  std::mt19937 engine{42U};
+  std::vector<std::uint32_t> v(count);
+  for (std::uint32_t &x : v) {
+    x = (bits == 0U) ? 0U : static_cast<std::uint32_t>(engine()) >> (32U - bits);
+  }
+  return v;
+}
+
+// the textbook decoder, integers packed one after another and extracted from a 64 bit window
+void ScalarBitunpack(benchmark::State &state) {
+  const unsigned bits{static_cast<unsigned>(state.range(0))};
+  const std::vector<std::uint32_t> input{Random(bits)};
+  std::vector<std::uint32_t> packed((count * bits + 31U) / 32U + 1U);
+  for (std::size_t i{}; i < count; ++i) {
+    const std::size_t bit{i * bits};
+    const std::uint64_t x{std::uint64_t{input[i]} << (bit % 32U)};
+    packed[bit / 32U] |= static_cast<std::uint32_t>(x);
+    packed[bit / 32U + 1U] |= static_cast<std::uint32_t>(x >> 32U);
+  }
+  const std::uint64_t mask{(std::uint64_t{1U} << bits) - 1U};
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < count; ++i) {
+      const std::size_t bit{i * bits};
+      const std::uint64_t window{packed[bit / 32U] | (std::uint64_t{packed[bit / 32U + 1U]} << 32U)};
+      output[i] = static_cast<std::uint32_t>((window >> (bit % 32U)) & mask);
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <bool Delta> void Bitunpack(benchmark::State &state) {
+  const unsigned bits{static_cast<unsigned>(state.range(0))};
+  const std::vector<std::uint32_t> input{Random(bits)};
+  std::vector<std::uint32_t> packed(bitpack_words(count, bits));
+  bitpack(input.data(), input.data() + count, bits, packed.data());
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    if constexpr (Delta) {
+      bitunpack_delta(packed.data(), count, bits, output.data());
+    } else {
+      bitunpack(packed.data(), count, bits, output.data());
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+void Bitpack(benchmark::State &state) {
+  const unsigned bits{static_cast<unsigned>(state.range(0))};
+  const std::vector<std::uint32_t> input{Random(bits)};
+  std::vector<std::uint32_t> packed(bitpack_words(count, bits));
+
+  for (auto _ : profiled{state}) {
+    bitpack(input.data(), input.data() + count, bits, packed.data());
+    benchmark::DoNotOptimize(packed.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+// the textbook decoder, one integer at a time from its bit pair of the control byte
+void ScalarStreamVByte(benchmark::State &state) {
+  const std::vector<std::uint32_t> input{Random(static_cast<unsigned>(state.range(0)))};
+  std::vector<std::uint8_t> encoded(stream_vbyte_max_bytes(count));
+  stream_vbyte_encode(input.data(), input.data() + count, encoded.data());
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    const std::uint8_t *data{encoded.data() + (count + 3U) / 4U};
+    for (std::size_t i{}; i < count; ++i) {
+      const std::uint32_t length{((encoded[i / 4U] >> (2U * (i % 4U))) & 3U) + 1U};
+      std::uint32_t x{};
+      for (std::uint32_t b{}; b < length; ++b) {
+        x |= std::uint32_t{data[b]} << (8U * b);
+      }
+      output[i] = x;
+      data += length;
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+template <bool Delta> void StreamVByte(benchmark::State &state) {
+  const std::vector<std::uint32_t> input{Random(static_cast<unsigned>(state.range(0)))};
+  std::vector<std::uint8_t> encoded(stream_vbyte_max_bytes(count));
+  const std::uint8_t *const end{stream_vbyte_encode(input.data(), input.data() + count, encoded.data())};
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    if constexpr (Delta) {
+      stream_vbyte_decode_delta(encoded.data(), end, count, output.data());
+    } else {
+      stream_vbyte_decode(encoded.data(), end, count, output.data());
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+void ScalarPrefixSum(benchmark::State &state) {
+  const std::vector<std::uint32_t> input{Random(8U)};
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    std::uint32_t sum{};
+    for (std::size_t i{}; i < count; ++i) {
+      sum += input[i];
+      output[i] = sum;
+    }
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+void DeltaEncode(benchmark::State &state) {
+  const std::vector<std::uint32_t> input{Random(8U)};
+  std::vector<std::uint32_t> output(count);
+
+  for (auto _ : profiled{state}) {
+    delta_encode(input.data(), input.data() + count, output.data());
+    benchmark::DoNotOptimize(output.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+// the items are integers, i.e., items/cycle are the integers per cycle
+BENCHMARK(ScalarBitunpack)->Arg(1)->Arg(7)->Arg(13)->Arg(32);
+BENCHMARK_TEMPLATE(Bitunpack, false)->Arg(1)->Arg(7)->Arg(13)->Arg(32);
+BENCHMARK_TEMPLATE(Bitunpack, true)->Arg(1)->Arg(7)->Arg(13)->Arg(32);
+BENCHMARK(Bitpack)->Arg(1)->Arg(7)->Arg(13)->Arg(32);
+// the bits select the byte lengths: 8 bits are one byte, 32 bits are mostly four bytes
+BENCHMARK(ScalarStreamVByte)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK_TEMPLATE(StreamVByte, false)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK_TEMPLATE(StreamVByte, true)->Arg(8)->Arg(20)->Arg(32);
+BENCHMARK(ScalarPrefixSum);
+BENCHMARK(DeltaEncode);
+
+} // namespace
+} // namespace parallelism_v2
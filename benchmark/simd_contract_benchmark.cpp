@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+// Built once per contract level, see the contract_benchmark_* targets.
+
+namespace parallelism_v2 {
+namespace {
+
+template <typename T> struct aligned_allocator {
+  using value_type = T;
+  aligned_allocator() = default;
+  template <typename U> aligned_allocator(const aligned_allocator<U> &) noexcept {}
+  T *allocate(const std::size_t n) { return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{64U})); }
+  void deallocate(T *const p, const std::size_t) noexcept { ::operator delete(p, std::align_val_t{64U}); }
+  template <typename U> bool operator==(const aligned_allocator<U> &) const noexcept { return true; }
+};
+
+using aligned_vector = std::vector<float, aligned_allocator<float>>;
+
+void AlignedCopy(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const aligned_vector x(n, 1.0F);
+  aligned_vector y(n);
+
+  for (auto _ : state) {
+    for (std::size_t i{}; i < n; i += simd<float>::size()) {
+      simd<float> v;
+      v.copy_from(&x[i], vector_aligned);
+      v.copy_to(&y[i], vector_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * 2U * sizeof(float)));
+}
+
+void ElementAccess(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const aligned_vector x(n, 1.0F);
+
+  for (auto _ : state) {
+    float sum{};
+    for (std::size_t i{}; i < n; i += simd<float>::size()) {
+      simd<float> v;
+      v.copy_from(&x[i], vector_aligned);
+      for (std::size_t j{}; j < simd<float>::size(); ++j) {
+        sum += v[j];
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * sizeof(float)));
+}
+
+void Clamp(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  aligned_vector x(n, 2.0F);
+  const simd<float> low{-1.0F};
+  const simd<float> high{1.0F};
+
+  for (auto _ : state) {
+    for (std::size_t i{}; i < n; i += simd<float>::size()) {
+      simd<float> v;
+      v.copy_from(&x[i], vector_aligned);
+      clamp(v, low, high).copy_to(&x[i], vector_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * 2U * sizeof(float)));
+}
+
+BENCHMARK(AlignedCopy)->Range(1 << 10, 1 << 16);
+BENCHMARK(ElementAccess)->Range(1 << 10, 1 << 16);
+BENCHMARK(Clamp)->Range(1 << 10, 1 << 16);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+
+#include "detail/simd_vector_extension_backend.h"
+#include "simd_benchmark_profile.h"
+#include "simd_fft.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<std::complex<float>> Signal(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<std::complex<float>> v(n);
+  for (std::complex<float> &x : v) {
+    x = {distribution(engine), distribution(engine)};
+  }
+  return v;
+}
+
+// the items are the points, i.e., the time per item is the time per point
+template <typename Transform> void Run(benchmark::State &state, const std::size_t points, Transform transform) {
+  const std::vector<std::complex<float>> in{Signal(points)};
+  std::vector<std::complex<float>> out(points);
+  for (auto _ : profiled{state}) {
+    transform(in.data(), out.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * points));
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * points * sizeof(std::complex<float>) * 2U));
+}
+
+// the iterative radix-2 FFT of the textbook with a bit-reversal pass and std::complex
+class Radix2 {
+public:
+  explicit Radix2(const std::size_t n) : n_{n}, twiddles_(n / 2U) {
+    for (std::size_t k{}; k < n / 2U; ++k) {
+      twiddles_[k] = std::polar(1.0F, -2.0F * 3.14159265F * static_cast<float>(k) / static_cast<float>(n));
+    }
+  }
+
+  void operator()(const std::complex<float> *const in, std::complex<float> *const out) const {
+    for (std::size_t i{}, j{}; i < n_; ++i) {
+      out[j] = in[i];
+      std::size_t bit{n_ >> 1U};
+      for (; (j & bit) != 0U; bit >>= 1U) {
+        j ^= bit;
+      }
+      j |= bit;
+    }
+    for (std::size_t m{2U}; m <= n_; m *= 2U) {
+      const std::size_t stride{n_ / m};
+      for (std::size_t i{}; i < n_; i += m) {
+        for (std::size_t k{}; k < m / 2U; ++k) {
+          const std::complex<float> t{twiddles_[k * stride] * out[i + k + m / 2U]};
+          out[i + k + m / 2U] = out[i + k] - t;
+          out[i + k] += t;
+        }
+      }
+    }
+  }
+
+private:
+  std::size_t n_;
+  std::vector<std::complex<float>> twiddles_;
+};
+
+void ScalarRadix2(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const Radix2 fft{n};
+  Run(state, n, fft);
+}
+
+template <typename Abi> void SimdFft(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  simd_fft<Abi> fft{n};
+  Run(state, n, [&fft](const std::complex<float> *const in, std::complex<float> *const out) { fft.forward(in, out); });
+}
+
+// many transforms of a small size, e.g., the blocks of a filter bank
+constexpr std::size_t transforms{1024U};
+
+void ScalarRadix2Batch(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const Radix2 fft{n};
+  Run(state, n * transforms, [&fft, n](const std::complex<float> *const in, std::complex<float> *const out) {
+    for (std::size_t t{}; t < transforms; ++t) {
+      fft(in + t * n, out + t * n);
+    }
+  });
+}
+
+template <typename Abi> void SimdFftBatch(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  simd_fft<Abi> fft{n};
+  Run(state, n * transforms, [&fft](const std::complex<float> *const in, std::complex<float> *const out) {
+    fft.forward(in, out, transforms);
+  });
+}
+
+template <typename Abi> void SimdRealFft(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  simd_real_fft<Abi> fft{n};
+  std::vector<float> in(n);
+  for (std::size_t i{}; i < n; ++i) {
+    in[i] = std::sin(0.1F * static_cast<float>(i));
+  }
+  std::vector<std::complex<float>> out(n / 2U + 1U);
+  for (auto _ : profiled{state}) {
+    fft.forward(in.data(), out.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n * sizeof(float) * 3U));
+}
+
+BENCHMARK(ScalarRadix2)->RangeMultiplier(4)->Range(64, 1 << 16);
+BENCHMARK(SimdFft<simd_abi::compatible<float>>)->RangeMultiplier(4)->Range(64, 1 << 16);
+BENCHMARK(SimdFft<simd_abi::vector_extension<16>>)->RangeMultiplier(4)->Range(64, 1 << 16);
+BENCHMARK(ScalarRadix2Batch)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(SimdFftBatch<simd_abi::compatible<float>>)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(SimdFftBatch<simd_abi::vector_extension<16>>)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(SimdRealFft<simd_abi::compatible<float>>)->RangeMultiplier(4)->Range(64, 1 << 16);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+
+#include "detail/simd_vector_extension_backend.h"
+#include "simd_benchmark_profile.h"
+#include "simd_filter.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+// a single-channel image larger than L2
+constexpr std::size_t width{1920U};
+constexpr std::size_t height{1080U};
+
+std::vector<float> Image() {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{0.0F, 1.0F};
+  std::vector<float> v(width * height);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+constexpr std::array<float, 5U> gaussian{0.0625F, 0.25F, 0.375F, 0.25F, 0.0625F};
+
+template <typename Filter> void Run(benchmark::State &state, Filter filter) {
+  const std::vector<float> in{Image()};
+  std::vector<float> out(width * height);
+  for (auto _ : profiled{state}) {
+    filter(in.data(), out.data());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * width * height));
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * width * height * sizeof(float) * 2U));
+}
+
+// the textbook 2D convolution of a K x K kernel, the interior without border handling
+void Naive2D(const std::vector<float> &kernel, const std::size_t k, const float *const in, float *const out) {
+  const std::size_t r{k / 2U};
+  for (std::size_t y{r}; y + r < height; ++y) {
+    for (std::size_t x{r}; x + r < width; ++x) {
+      float sum{};
+      for (std::size_t i{}; i < k; ++i) {
+        for (std::size_t j{}; j < k; ++j) {
+          sum += kernel[i * k + j] * in[(y + i - r) * width + x + j - r];
+        }
+      }
+      out[y * width + x] = sum;
+    }
+  }
+}
+
+void NaiveGaussian5x5(benchmark::State &state) {
+  std::vector<float> kernel(25U);
+  for (std::size_t i{}; i < 5U; ++i) {
+    for (std::size_t j{}; j < 5U; ++j) {
+      kernel[i * 5U + j] = gaussian[i] * gaussian[j];
+    }
+  }
+  Run(state, [&kernel](const float *const in, float *const out) { Naive2D(kernel, 5U, in, out); });
+}
+
+// the rows into an intermediate image and then its columns, i.e., the intermediate image goes through memory
+void TwoPassGaussian5x5(benchmark::State &state) {
+  std::vector<float> temporary(width * height);
+  Run(state, [&temporary](const float *const in, float *const out) {
+    simd_convolve_rows(gaussian, width, height, in, width, temporary.data(), width);
+    simd_convolve_columns(gaussian, width, height, temporary.data(), width, out, width);
+  });
+}
+
+template <typename Abi> void SeparableGaussian5x5(benchmark::State &state) {
+  Run(state, [](const float *const in, float *const out) {
+    simd_separable_filter<5U, 5U, Abi>(gaussian, gaussian, width, height, in, width, out, width);
+  });
+}
+
+void SeparableSobel(benchmark::State &state) {
+  Run(state, [](const float *const in, float *const out) {
+    simd_separable_filter(std::array<float, 3U>{-1.0F, 0.0F, 1.0F}, std::array<float, 3U>{1.0F, 2.0F, 1.0F}, width,
+                          height, in, width, out, width);
+  });
+}
+
+void NaiveBox(benchmark::State &state) {
+  const std::size_t k{2U * static_cast<std::size_t>(state.range(0)) + 1U};
+  const std::vector<float> kernel(k * k, 1.0F / static_cast<float>(k * k));
+  Run(state, [&kernel, k](const float *const in, float *const out) { Naive2D(kernel, k, in, out); });
+}
+
+void BoxFilter(benchmark::State &state) {
+  const std::size_t radius{static_cast<std::size_t>(state.range(0))};
+  Run(state, [radius](const float *const in, float *const out) {
+    simd_box_filter(radius, width, height, in, width, out, width);
+  });
+}
+
+BENCHMARK(NaiveGaussian5x5)->Unit(benchmark::kMillisecond);
+BENCHMARK(TwoPassGaussian5x5)->Unit(benchmark::kMillisecond);
+BENCHMARK(SeparableGaussian5x5<simd_abi::compatible<float>>)->Unit(benchmark::kMillisecond);
+// the registers of the naive convolution, which the compiler vectorizes for the native instruction set
+BENCHMARK(SeparableGaussian5x5<simd_abi::vector_extension<16>>)->Unit(benchmark::kMillisecond);
+BENCHMARK(SeparableSobel)->Unit(benchmark::kMillisecond);
+BENCHMARK(NaiveBox)->Arg(1)->Arg(5)->Unit(benchmark::kMillisecond);
+BENCHMARK(BoxFilter)->Arg(1)->Arg(5)->Arg(25)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace parallelism_v2
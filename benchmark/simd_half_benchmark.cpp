@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd.h"
+#include "simd_benchmark_profile.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<float> Random(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+template <typename Tag> std::vector<std::uint16_t> Convert(const std::vector<float> &v, const Tag tag) {
+  std::vector<std::uint16_t> r(v.size());
+  for (std::size_t i{}; i < v.size(); i += simd<float>::size()) {
+    simd<float> x;
+    x.copy_from(&v[i], element_aligned);
+    x.copy_to(&r[i], tag);
+  }
+  return r;
+}
+
+// dot product of a stored array with a query, e.g., scoring embeddings, which is bound by the memory bandwidth once
+// the array exceeds the caches
+void FloatDot(benchmark::State &state) {
+  using V = simd<float>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> a{Random(n)};
+  const std::vector<float> q{Random(n)};
+
+  for (auto _ : profiled{state}) {
+    V sum{0.0F};
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V x;
+      V y;
+      x.copy_from(&a[i], element_aligned);
+      y.copy_from(&q[i], element_aligned);
+      sum = fma(x, y, sum);
+    }
+    benchmark::DoNotOptimize(reduce(sum));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename Tag> void HalfDot(benchmark::State &state, const Tag tag) {
+  using V = simd<float>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::uint16_t> a{Convert(Random(n), tag)};
+  const std::vector<float> q{Random(n)};
+
+  for (auto _ : profiled{state}) {
+    V sum{0.0F};
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V x;
+      V y;
+      x.copy_from(&a[i], tag);
+      y.copy_from(&q[i], element_aligned);
+      sum = fma(x, y, sum);
+    }
+    benchmark::DoNotOptimize(reduce(sum));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void Float16Dot(benchmark::State &state) { HalfDot(state, float16); }
+void Bfloat16Dot(benchmark::State &state) { HalfDot(state, bfloat16); }
+
+// the same with one conversion per element
+void ScalarFloat16Dot(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::uint16_t> a{Convert(Random(n), float16)};
+  const std::vector<float> q{Random(n)};
+
+  for (auto _ : profiled{state}) {
+    float sum{};
+    for (std::size_t i{}; i < n; ++i) {
+      sum += detail::float16_to_float<std::uint32_t, float>(a[i]) * q[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// 16 KiB to 64 MiB of floats
+BENCHMARK(FloatDot)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(Float16Dot)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(Bfloat16Dot)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(ScalarFloat16Dot)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_hash.h"
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<std::uint32_t> Keys(const std::size_t n) {
+  std::vector<std::uint32_t> v(n);
+  std::iota(v.begin(), v.end(), 0U);
+  return v;
+}
+
+// the identity in libstdc++, i.e., the cost of the loop without any mixing
+void StdHash(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::uint32_t> keys{Keys(n)};
+  std::vector<std::size_t> hashes(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; ++i) {
+      hashes[i] = std::hash<std::uint32_t>{}(keys[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// one key at a time, the compiler is kept from vectorizing the loop
+void ScalarHashMix(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::uint32_t> keys{Keys(n)};
+  std::vector<std::uint32_t> hashes(n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; ++i) {
+      benchmark::DoNotOptimize(hashes[i] = hash_mix(keys[i]));
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdHash(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<std::uint32_t> keys{Keys(n)};
+  std::vector<std::uint32_t> hashes(n);
+
+  for (auto _ : profiled{state}) {
+    simd_hash(keys.data(), keys.data() + n, hashes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// byte at a time with a lookup table
+std::array<std::uint32_t, 256> Crc32cTable() {
+  std::array<std::uint32_t, 256> table;
+  for (std::uint32_t i{}; i < 256U; ++i) {
+    std::uint32_t crc{i};
+    for (int k{}; k < 8; ++k) {
+      crc = ((crc & 1U) != 0U) ? (crc >> 1) ^ 0x82F63B78U : crc >> 1;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+void ScalarCrc32c(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<char> bytes(n, 'x');
+  const std::array<std::uint32_t, 256> table{Crc32cTable()};
+
+  for (auto _ : profiled{state}) {
+    std::uint32_t crc{0xFFFFFFFFU};
+    for (const char c : bytes) {
+      crc = table[(crc ^ static_cast<std::uint8_t>(c)) & 0xFFU] ^ (crc >> 8);
+    }
+    benchmark::DoNotOptimize(~crc);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// eight bytes at a time with the CRC32 instruction but a single dependency chain
+void SingleStreamCrc32c(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<char> bytes(n, 'x');
+
+  for (auto _ : profiled{state}) {
+    std::uint32_t crc{0xFFFFFFFFU};
+    for (std::size_t i{}; i < n; i += 8U) {
+      crc = detail::crc32c_u64(crc, detail::load_u64(bytes.data() + i));
+    }
+    benchmark::DoNotOptimize(~crc);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdCrc32c(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<char> bytes(n, 'x');
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_crc32c(bytes.data(), bytes.data() + n));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(StdHash)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(ScalarHashMix)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdHash)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+// 1 KiB to 1 MiB, multiples of eight bytes
+BENCHMARK(ScalarCrc32c)->RangeMultiplier(4)->Range(1 << 10, 1 << 20);
+BENCHMARK(SingleStreamCrc32c)->RangeMultiplier(4)->Range(1 << 10, 1 << 20);
+BENCHMARK(SimdCrc32c)->RangeMultiplier(4)->Range(1 << 10, 1 << 20);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_knn.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+constexpr std::size_t count{1U << 14};
+constexpr std::size_t k{10U};
+
+std::vector<float> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::normal_distribution<float> distribution{};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+std::vector<std::uint16_t> Half(const std::vector<float> &v) {
+  using V = simd<float>;
+  std::vector<std::uint16_t> h(v.size());
+  for (std::size_t i{}; i < v.size(); i += V::size()) {
+    V x;
+    x.copy_from(&v[i], element_aligned);
+    x.copy_to(&h[i], float16);
+  }
+  return h;
+}
+
+// the textbook scan, one database vector at a time into a sorted candidate list
+void Scalar(benchmark::State &state) {
+  const std::size_t dim{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> database{Random(count * dim, 1U)};
+  const std::vector<float> query{Random(dim, 2U)};
+
+  for (auto _ : profiled{state}) {
+    std::vector<knn_neighbor> r;
+    for (std::size_t i{}; i < count; ++i) {
+      float d{};
+      for (std::size_t j{}; j < dim; ++j) {
+        const float x{database[i * dim + j] - query[j]};
+        d += x * x;
+      }
+      if ((r.size() < k) || (d < r.back().distance)) {
+        const auto it{std::upper_bound(r.begin(), r.end(), d,
+                                       [](const float a, const knn_neighbor &b) { return a < b.distance; })};
+        r.insert(it, knn_neighbor{i, d});
+        r.resize(std::min(r.size(), k));
+      }
+    }
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count * dim * sizeof(float)));
+}
+
+template <knn_metric Metric, typename S> void Simd(benchmark::State &state) {
+  const std::size_t dim{static_cast<std::size_t>(state.range(0))};
+  const std::size_t threads{static_cast<std::size_t>(state.range(1))};
+  const std::vector<float> values{Random(count * dim, 1U)};
+  std::vector<S> database;
+  if constexpr (std::is_same<S, float>::value) {
+    database = values;
+  } else {
+    database = Half(values);
+  }
+  const std::vector<float> query{Random(dim, 2U)};
+
+  for (auto _ : profiled{state}) {
+    const std::vector<knn_neighbor> r{knn_search(Metric, query.data(), database.data(), count, dim, k, threads)};
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count * dim * sizeof(S)));
+}
+
+// the items are queries, i.e., items_per_second are the queries per second
+BENCHMARK(Scalar)->Args({64})->Args({256})->Args({1024});
+BENCHMARK_TEMPLATE(Simd, knn_metric::squared_l2, float)->Args({64, 1})->Args({256, 1})->Args({1024, 1});
+BENCHMARK_TEMPLATE(Simd, knn_metric::inner_product, float)->Args({64, 1})->Args({256, 1})->Args({1024, 1});
+BENCHMARK_TEMPLATE(Simd, knn_metric::cosine, float)->Args({64, 1})->Args({256, 1})->Args({1024, 1});
+BENCHMARK_TEMPLATE(Simd, knn_metric::squared_l2, std::uint16_t)->Args({64, 1})->Args({256, 1})->Args({1024, 1});
+BENCHMARK_TEMPLATE(Simd, knn_metric::squared_l2, float)->Args({64, 4})->Args({256, 4})->Args({1024, 4})->UseRealTime();
+
+} // namespace
+} // namespace parallelism_v2
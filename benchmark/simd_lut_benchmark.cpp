@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_lut.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+constexpr float x0{0.0F};
+constexpr float x1{8.0F};
+
+template <std::size_t N> std::array<float, N> Samples() {
+  std::array<float, N> y;
+  for (std::size_t k{}; k < N; ++k) {
+    y[k] = std::tanh(x0 + (x1 - x0) * static_cast<float>(k) / static_cast<float>(N - 1U) - 4.0F);
+  }
+  return y;
+}
+
+// includes some inputs outside of the table
+std::vector<float> Inputs() {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{x0 - 0.5F, x1 + 0.5F};
+  std::vector<float> x(1U << 12);
+  for (float &v : x) {
+    v = distribution(engine);
+  }
+  return x;
+}
+
+// the textbook lookup table, clamps and interpolates one element at a time
+template <std::size_t N> void ScalarLinear(benchmark::State &state) {
+  const std::array<float, N> y{Samples<N>()};
+  const std::vector<float> x{Inputs()};
+  std::vector<float> r(x.size());
+  const float scale{static_cast<float>(N - 1U) / (x1 - x0)};
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < x.size(); ++i) {
+      const float s{(std::clamp(x[i], x0, x1) - x0) * scale};
+      const std::size_t k{std::min(static_cast<std::size_t>(s), N - 2U)};
+      const float t{s - static_cast<float>(k)};
+      r[i] = y[k] + t * (y[k + 1U] - y[k]);
+    }
+    benchmark::DoNotOptimize(r.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+template <std::size_t N> void ScalarCubic(benchmark::State &state) {
+  const std::array<float, N> y{Samples<N>()};
+  const std::vector<float> x{Inputs()};
+  std::vector<float> r(x.size());
+  const float scale{static_cast<float>(N - 1U) / (x1 - x0)};
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < x.size(); ++i) {
+      const float s{(std::clamp(x[i], x0, x1) - x0) * scale};
+      const std::size_t k{std::min(static_cast<std::size_t>(s), N - 2U)};
+      const float t{s - static_cast<float>(k)};
+      const float p0{(k == 0U) ? 2.0F * y[0] - y[1] : y[k - 1U]};
+      const float p1{y[k]};
+      const float p2{y[k + 1U]};
+      const float p3{(k + 2U == N) ? 2.0F * y[N - 1U] - y[N - 2U] : y[k + 2U]};
+      r[i] = p1 + 0.5F * t *
+                      (p2 - p0 + t * (2.0F * p0 - 5.0F * p1 + 4.0F * p2 - p3 + t * (3.0F * (p1 - p2) + p3 - p0)));
+    }
+    benchmark::DoNotOptimize(r.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+template <std::size_t N, bool Cubic> void SimdLut(benchmark::State &state) {
+  using V = simd<float>;
+  const simd_lut<N> lut{Samples<N>(), x0, x1};
+  const std::vector<float> x{Inputs()};
+  std::vector<float> r(x.size());
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < x.size(); i += V::size()) {
+      V v;
+      v.copy_from(&x[i], element_aligned);
+      v = Cubic ? lut.cubic(v) : lut.linear(v);
+      v.copy_to(&r[i], element_aligned);
+    }
+    benchmark::DoNotOptimize(r.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * x.size()));
+}
+
+// 16 samples fit into registers, 1024 samples are gathered from memory
+BENCHMARK_TEMPLATE(ScalarLinear, 16U);
+BENCHMARK_TEMPLATE(SimdLut, 16U, false);
+BENCHMARK_TEMPLATE(ScalarLinear, 1024U);
+BENCHMARK_TEMPLATE(SimdLut, 1024U, false);
+BENCHMARK_TEMPLATE(ScalarCubic, 16U);
+BENCHMARK_TEMPLATE(SimdLut, 16U, true);
+BENCHMARK_TEMPLATE(ScalarCubic, 1024U);
+BENCHMARK_TEMPLATE(SimdLut, 1024U, true);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_mapped_stream.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = simd<float>;
+
+// SIMD_BENCHMARK_FILE_BYTES selects the size of the file, e.g., larger than the memory to stream from the storage
+// instead of the page cache
+std::size_t FileSize() {
+  const char *const bytes{std::getenv("SIMD_BENCHMARK_FILE_BYTES")};
+  const std::size_t n{(bytes != nullptr) ? std::strtoull(bytes, nullptr, 10) : (std::size_t{256U} << 20U)};
+  return n / sizeof(float);
+}
+
+std::string FilePath() { return "/tmp/simd_mapped_stream_benchmark.bin"; }
+
+const std::string &InputFile() {
+  static const std::string path{[] {
+    const std::string p{FilePath()};
+    mapped_simd_output<float> output{p, FileSize()};
+    V v{1.0F};
+    for (std::size_t i{}; i < output.size(); i += V::size()) {
+      output.write(v, std::min(V::size(), output.size() - i));
+    }
+    return p;
+  }()};
+  return path;
+}
+
+// the textbook path, read() copies each block from the page cache into a buffer
+void ReadCopy(benchmark::State &state) {
+  const std::string &path{InputFile()};
+  std::vector<float> buffer(std::size_t{1U} << 18U);
+  std::size_t bytes{};
+
+  for (auto _ : profiled{state}) {
+    const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    static_cast<void>(::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL));
+    V sum{0.0F};
+    for (ssize_t r{}; (r = ::read(fd, buffer.data(), buffer.size() * sizeof(float))) > 0;) {
+      const std::size_t n{static_cast<std::size_t>(r) / sizeof(float)};
+      std::size_t i{};
+      for (; i + V::size() <= n; i += V::size()) {
+        V v;
+        v.copy_from(&buffer[i], element_aligned);
+        sum += v;
+      }
+      for (; i < n; ++i) {
+        sum += V{buffer[i]};
+      }
+      bytes += static_cast<std::size_t>(r);
+    }
+    ::close(fd);
+    benchmark::DoNotOptimize(reduce(sum));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+void MappedStream(benchmark::State &state) {
+  const std::string &path{InputFile()};
+  std::size_t bytes{};
+
+  for (auto _ : profiled{state}) {
+    mapped_simd_stream<float> stream{path};
+    V sum{0.0F};
+    V v;
+    for (std::size_t n{}; (n = stream.read(v)) != 0U;) {
+      sum += v;
+    }
+    bytes += stream.size() * sizeof(float);
+    benchmark::DoNotOptimize(reduce(sum));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+}
+
+void WriteCopy(benchmark::State &state) {
+  const std::string path{FilePath() + ".out"};
+  const std::size_t size{FileSize()};
+  std::vector<float> buffer(std::size_t{1U} << 18U);
+
+  for (auto _ : profiled{state}) {
+    const int fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+    V v{1.0F};
+    for (std::size_t i{}; i < size; i += buffer.size()) {
+      const std::size_t n{std::min(buffer.size(), size - i)};
+      for (std::size_t k{}; k < n; k += V::size()) {
+        v.copy_to(&buffer[k], element_aligned);
+      }
+      static_cast<void>(::write(fd, buffer.data(), n * sizeof(float)));
+    }
+    ::close(fd);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(float)));
+  std::remove(path.c_str());
+}
+
+void MappedOutput(benchmark::State &state) {
+  const std::string path{FilePath() + ".out"};
+  const std::size_t size{FileSize()};
+
+  for (auto _ : profiled{state}) {
+    mapped_simd_output<float> output{path, size};
+    V v{1.0F};
+    for (std::size_t i{}; i < size; i += V::size()) {
+      output.write(v, std::min(V::size(), size - i));
+    }
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(float)));
+  std::remove(path.c_str());
+}
+
+BENCHMARK(ReadCopy)->Unit(benchmark::kMillisecond);
+BENCHMARK(MappedStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(WriteCopy)->Unit(benchmark::kMillisecond);
+BENCHMARK(MappedOutput)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: MIT
+
+#include "detail/simd_vector_extension_backend.h"
+#include "simd.h"
+#include "simd_benchmark_profile.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+template <typename Abi> void MaskedMultiplyAdd(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> a(n, 1.0F);
+  const std::vector<float> b(n, 0.5F);
+  const std::vector<float> c(n, 0.25F);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V va;
+      V vb;
+      V vc;
+      va.copy_from(&a[i], element_aligned);
+      vb.copy_from(&b[i], element_aligned);
+      vc.copy_from(&c[i], element_aligned);
+      where(va < V{4.0F}, va) += vb * vc;
+      va.copy_to(&a[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename Abi> void MaskedFma(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> a(n, 1.0F);
+  const std::vector<float> b(n, 0.5F);
+  const std::vector<float> c(n, 0.25F);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V va;
+      V vb;
+      V vc;
+      va.copy_from(&a[i], element_aligned);
+      vb.copy_from(&b[i], element_aligned);
+      vc.copy_from(&c[i], element_aligned);
+      where(va < V{4.0F}, va) = fma(vb, vc, va);
+      va.copy_to(&a[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// rounding built from a scalar loop over the elements, as before the rounding functions
+template <typename Abi> void ElementwiseRound(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> a(n, 2.5F);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V v;
+      v.copy_from(&a[i], element_aligned);
+      for (std::size_t j{}; j < V::size(); ++j) {
+        v[j] = std::round(v[j]);
+      }
+      v.copy_to(&a[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename Abi> void Round(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> a(n, 2.5F);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V v;
+      v.copy_from(&a[i], element_aligned);
+      round(v).copy_to(&a[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename Abi> void Floor(benchmark::State &state) {
+  using V = simd<float, Abi>;
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> a(n, 2.5F);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; i += V::size()) {
+      V v;
+      v.copy_from(&a[i], element_aligned);
+      floor(v).copy_to(&a[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+#if defined(__SSE4_2__) && defined(__linux__)
+BENCHMARK_TEMPLATE(ElementwiseRound, detail::sse)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(Round, detail::sse)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(Floor, detail::sse)->Range(1 << 10, 1 << 16);
+#endif
+BENCHMARK_TEMPLATE(Round, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(Floor, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 16);
+
+#if defined(__SSE4_2__) && defined(__linux__)
+BENCHMARK_TEMPLATE(MaskedMultiplyAdd, detail::sse)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(MaskedFma, detail::sse)->Range(1 << 10, 1 << 16);
+#endif
+BENCHMARK_TEMPLATE(MaskedMultiplyAdd, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(MaskedFma, simd_abi::vector_extension<8>)->Range(1 << 10, 1 << 16);
+
+} // namespace
+} // namespace parallelism_v2
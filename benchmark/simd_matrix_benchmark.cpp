@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_matrix.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<float> Random(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+// 2 * n^3 floating point operations per iteration
+void SetFlops(benchmark::State &state, const std::size_t n) {
+  state.counters["FLOPS"] = benchmark::Counter(static_cast<double>(state.iterations()) * 2.0 * n * n * n,
+                                               benchmark::Counter::kIsRate, benchmark::Counter::kIs1000);
+}
+
+void NaiveGemm(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> a{Random(n * n)};
+  const std::vector<float> b{Random(n * n)};
+  std::vector<float> c(n * n);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < n; ++i) {
+      for (std::size_t j{}; j < n; ++j) {
+        float sum{};
+        for (std::size_t p{}; p < n; ++p) {
+          sum += a[i * n + p] * b[p * n + j];
+        }
+        c[i * n + j] = sum;
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, n);
+}
+
+void SimdGemm(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::vector<float> a{Random(n * n)};
+  const std::vector<float> b{Random(n * n)};
+  std::vector<float> c(n * n);
+
+  for (auto _ : profiled{state}) {
+    simd_gemm(n, n, n, a.data(), n, b.data(), n, c.data(), n);
+    benchmark::ClobberMemory();
+  }
+  SetFlops(state, n);
+}
+
+// a batch of 4x4 products as they occur in transformations, the same for the naive loop and the registers
+constexpr std::size_t batch{1024U};
+
+void NaiveMatrix4(benchmark::State &state) {
+  const std::vector<float> a{Random(16U * batch)};
+  const std::vector<float> b{Random(16U * batch)};
+  std::vector<float> c(16U * batch);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t m{}; m < 16U * batch; m += 16U) {
+      for (std::size_t i{}; i < 4U; ++i) {
+        for (std::size_t j{}; j < 4U; ++j) {
+          float sum{};
+          for (std::size_t p{}; p < 4U; ++p) {
+            sum += a[m + 4U * i + p] * b[m + 4U * p + j];
+          }
+          c[m + 4U * i + j] = sum;
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch));
+}
+
+void SimdMatrix4(benchmark::State &state) {
+  const std::vector<float> a{Random(16U * batch)};
+  const std::vector<float> b{Random(16U * batch)};
+  std::vector<float> c(16U * batch);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t m{}; m < 16U * batch; m += 16U) {
+      simd_matrix4<float> x;
+      simd_matrix4<float> y;
+      for (std::size_t i{}; i < 4U; ++i) {
+        x[i].copy_from(&a[m + 4U * i], element_aligned);
+        y[i].copy_from(&b[m + 4U * i], element_aligned);
+      }
+      const simd_matrix4<float> r{multiply(x, y)};
+      for (std::size_t i{}; i < 4U; ++i) {
+        r[i].copy_to(&c[m + 4U * i], element_aligned);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch));
+}
+
+void NaiveMatrixVector4(benchmark::State &state) {
+  const std::vector<float> a{Random(16U * batch)};
+  const std::vector<float> x{Random(4U * batch)};
+  std::vector<float> y(4U * batch);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t m{}; m < batch; ++m) {
+      for (std::size_t i{}; i < 4U; ++i) {
+        float sum{};
+        for (std::size_t p{}; p < 4U; ++p) {
+          sum += a[16U * m + 4U * i + p] * x[4U * m + p];
+        }
+        y[4U * m + i] = sum;
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch));
+}
+
+void SimdMatrixVector4(benchmark::State &state) {
+  using V = fixed_size_simd<float, 4>;
+  const std::vector<float> a{Random(16U * batch)};
+  const std::vector<float> x{Random(4U * batch)};
+  std::vector<float> y(4U * batch);
+
+  for (auto _ : profiled{state}) {
+    for (std::size_t m{}; m < batch; ++m) {
+      simd_matrix4<float> r;
+      for (std::size_t i{}; i < 4U; ++i) {
+        r[i].copy_from(&a[16U * m + 4U * i], element_aligned);
+      }
+      V v;
+      v.copy_from(&x[4U * m], element_aligned);
+      multiply(r, v).copy_to(&y[4U * m], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * batch));
+}
+
+BENCHMARK(NaiveGemm)->RangeMultiplier(2)->Range(64, 512);
+BENCHMARK(SimdGemm)->RangeMultiplier(2)->Range(64, 512);
+BENCHMARK(NaiveMatrix4);
+BENCHMARK(SimdMatrix4);
+BENCHMARK(NaiveMatrixVector4);
+BENCHMARK(SimdMatrixVector4);
+
+} // namespace
+} // namespace parallelism_v2
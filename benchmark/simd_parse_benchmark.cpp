@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_parse.h"
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+namespace parallelism_v2 {
+namespace {
+
+constexpr std::size_t count{1U << 16};
+
+// a column of numbers, one per line
+std::string Integers() {
+  std::mt19937 engine{42U};
+  std::string s;
+  for (std::size_t i{}; i < count; ++i) {
+    s += std::to_string(static_cast<std::int32_t>(engine()) >> (i % 32U));
+    s += '\n';
+  }
+  return s;
+}
+
+// decimals with a few fraction digits as written by a measurement device, e.g., "-123.45"
+std::string Decimals() {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<double> distribution{-1000.0, 1000.0};
+  std::string s;
+  char buffer[32];
+  for (std::size_t i{}; i < count; ++i) {
+    const int n{std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(i % 5U), distribution(engine))};
+    s.append(buffer, static_cast<std::size_t>(n));
+    s += '\n';
+  }
+  return s;
+}
+
+template <typename Parse> void Run(benchmark::State &state, const std::string &input, Parse parse) {
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(parse(input.data(), input.data() + input.size()));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+void Strtol(benchmark::State &state) {
+  Run(state, Integers(), [](const char *p, const char *) {
+    std::int32_t sum{};
+    for (std::size_t i{}; i < count; ++i) {
+      char *end;
+      sum += static_cast<std::int32_t>(std::strtol(p, &end, 10));
+      p = end + 1;
+    }
+    return sum;
+  });
+}
+
+constexpr auto std_parse = [](const char *first, const char *last, auto &x) {
+  return std::from_chars(first, last, x);
+};
+constexpr auto simd_parse = [](const char *first, const char *last, auto &x) { return simd_from_chars(first, last, x); };
+
+template <typename T, typename Parse> T SumOfFields(const char *p, const char *const last, Parse parse) {
+  T sum{};
+  while (p != last) {
+    T x{};
+    p = parse(p, last, x).ptr + 1;
+    sum += x;
+  }
+  return sum;
+}
+
+template <typename T, typename Parse> T SumOfBatches(const char *p, const char *const last, Parse parse) {
+  simd<T> sum{T{}};
+  simd<T> v;
+  for (std::from_chars_result r; (r = simd_from_chars(p, last, v, '\n')).ec == std::errc{}; p = r.ptr) {
+    sum += v;
+  }
+  return reduce(sum) + SumOfFields<T>(p, last, parse);
+}
+
+void FromCharsInt32(benchmark::State &state) {
+  Run(state, Integers(), [](const char *p, const char *const last) {
+    return SumOfFields<std::int32_t>(p, last, std_parse);
+  });
+}
+
+void SimdFromCharsInt32(benchmark::State &state) {
+  Run(state, Integers(), [](const char *p, const char *const last) {
+    return SumOfFields<std::int32_t>(p, last, simd_parse);
+  });
+}
+
+void SimdFromCharsInt32Batch(benchmark::State &state) {
+  Run(state, Integers(), [](const char *p, const char *const last) {
+    return SumOfBatches<std::int32_t>(p, last, simd_parse);
+  });
+}
+
+void Strtof(benchmark::State &state) {
+  Run(state, Decimals(), [](const char *p, const char *) {
+    float sum{};
+    for (std::size_t i{}; i < count; ++i) {
+      char *end;
+      sum += std::strtof(p, &end);
+      p = end + 1;
+    }
+    return sum;
+  });
+}
+
+void FromCharsFloat(benchmark::State &state) {
+  Run(state, Decimals(), [](const char *p, const char *const last) {
+    return SumOfFields<float>(p, last, std_parse);
+  });
+}
+
+void SimdFromCharsFloat(benchmark::State &state) {
+  Run(state, Decimals(), [](const char *p, const char *const last) {
+    return SumOfFields<float>(p, last, simd_parse);
+  });
+}
+
+void SimdFromCharsFloatBatch(benchmark::State &state) {
+  Run(state, Decimals(), [](const char *p, const char *const last) {
+    return SumOfBatches<float>(p, last, simd_parse);
+  });
+}
+
+BENCHMARK(Strtol);
+BENCHMARK(FromCharsInt32);
+BENCHMARK(SimdFromCharsInt32);
+BENCHMARK(SimdFromCharsInt32Batch);
+BENCHMARK(Strtof);
+BENCHMARK(FromCharsFloat);
+BENCHMARK(SimdFromCharsFloat);
+BENCHMARK(SimdFromCharsFloatBatch);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_polynomial.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = simd<float>;
+
+// 0.5 + 0.4 (x / 2 - x^2 / 4 + x^3 / 8 - ...), i.e., [-1, 1] is mapped into itself and repeated evaluations stay
+// bounded
+constexpr float Coefficient(const std::size_t i) {
+  float c{(i == 0U) ? 0.5F : 0.4F};
+  for (std::size_t k{}; k < i; ++k) {
+    c *= -0.5F;
+  }
+  return (i == 0U) ? c : -c;
+}
+
+template <std::size_t... I> V Horner(const V &x, std::index_sequence<I...>) { return horner<Coefficient(I)...>(x); }
+template <std::size_t... I> V Estrin(const V &x, std::index_sequence<I...>) { return estrin<Coefficient(I)...>(x); }
+
+// every evaluation depends on the previous one, i.e., the latency
+template <std::size_t N> void HornerLatency(benchmark::State &state) {
+  V x{0.25F};
+  for (auto _ : profiled{state}) {
+    x = Horner(x, std::make_index_sequence<N>{});
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+template <std::size_t N> void EstrinLatency(benchmark::State &state) {
+  V x{0.25F};
+  for (auto _ : profiled{state}) {
+    x = Estrin(x, std::make_index_sequence<N>{});
+    benchmark::DoNotOptimize(x);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+// independent evaluations over an array, i.e., the throughput
+template <std::size_t N> void HornerThroughput(benchmark::State &state) {
+  std::vector<float> v(4096U, 0.25F);
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < v.size(); i += V::size()) {
+      V x;
+      x.copy_from(&v[i], element_aligned);
+      Horner(x, std::make_index_sequence<N>{}).copy_to(&v[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * v.size()));
+}
+
+template <std::size_t N> void EstrinThroughput(benchmark::State &state) {
+  std::vector<float> v(4096U, 0.25F);
+  for (auto _ : profiled{state}) {
+    for (std::size_t i{}; i < v.size(); i += V::size()) {
+      V x;
+      x.copy_from(&v[i], element_aligned);
+      Estrin(x, std::make_index_sequence<N>{}).copy_to(&v[i], element_aligned);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * v.size()));
+}
+
+// degree 3, 7 and 15
+BENCHMARK_TEMPLATE(HornerLatency, 4U);
+BENCHMARK_TEMPLATE(EstrinLatency, 4U);
+BENCHMARK_TEMPLATE(HornerLatency, 8U);
+BENCHMARK_TEMPLATE(EstrinLatency, 8U);
+BENCHMARK_TEMPLATE(HornerLatency, 16U);
+BENCHMARK_TEMPLATE(EstrinLatency, 16U);
+BENCHMARK_TEMPLATE(HornerThroughput, 4U);
+BENCHMARK_TEMPLATE(EstrinThroughput, 4U);
+BENCHMARK_TEMPLATE(HornerThroughput, 8U);
+BENCHMARK_TEMPLATE(EstrinThroughput, 8U);
+BENCHMARK_TEMPLATE(HornerThroughput, 16U);
+BENCHMARK_TEMPLATE(EstrinThroughput, 16U);
+
+} // namespace
+} // namespace parallelism_v2
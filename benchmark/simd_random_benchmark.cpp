@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_random.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+// filling a buffer of random floats, e.g., the paths of a Monte Carlo simulation
+void StdUniform(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> v(n);
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{0.0F, 1.0F};
+
+  for (auto _ : profiled{state}) {
+    for (float &x : v) {
+      x = distribution(engine);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename G> void SimdUniform(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> v(n);
+  G g{42U};
+
+  for (auto _ : profiled{state}) {
+    simd_generate_uniform(g, v.data(), v.data() + n);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void StdNormal(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> v(n);
+  std::mt19937 engine{42U};
+  std::normal_distribution<float> distribution{};
+
+  for (auto _ : profiled{state}) {
+    for (float &x : v) {
+      x = distribution(engine);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+template <typename G> void SimdNormal(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::vector<float> v(n);
+  G g{42U};
+
+  for (auto _ : profiled{state}) {
+    simd_generate_normal(g, v.data(), v.data() + n);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(StdUniform)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(SimdUniform, philox4x32<>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(SimdUniform, xoshiro128plus<>)->Arg(1 << 12);
+BENCHMARK(StdNormal)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(SimdNormal, philox4x32<>)->Arg(1 << 12);
+BENCHMARK_TEMPLATE(SimdNormal, xoshiro128plus<>)->Arg(1 << 12);
+
+} // namespace
+} // namespace parallelism_v2
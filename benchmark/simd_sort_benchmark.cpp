@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_sort.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<float> Random(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<float> v(n);
+  std::generate(v.begin(), v.end(), [&]() { return distribution(engine); });
+  return v;
+}
+
+// sorted with 1% of the elements swapped with a random other element
+std::vector<float> NearlySorted(const std::size_t n) {
+  std::vector<float> v{Random(n)};
+  std::sort(v.begin(), v.end());
+  std::mt19937 engine{7U};
+  std::uniform_int_distribution<std::size_t> index{0U, n - 1U};
+  for (std::size_t i{}; i < n / 100U; ++i) {
+    std::swap(v[index(engine)], v[index(engine)]);
+  }
+  return v;
+}
+
+// 16 distinct values
+std::vector<float> Duplicates(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_int_distribution<int> distribution{0, 15};
+  std::vector<float> v(n);
+  std::generate(v.begin(), v.end(), [&]() { return static_cast<float>(distribution(engine)); });
+  return v;
+}
+
+// the copy of the input is part of every iteration of both sorts
+template <std::vector<float> (*Input)(std::size_t)> void StdSort(benchmark::State &state) {
+  const std::vector<float> input{Input(static_cast<std::size_t>(state.range(0)))};
+  std::vector<float> v(input.size());
+
+  for (auto _ : profiled{state}) {
+    std::copy(input.begin(), input.end(), v.begin());
+    std::sort(v.begin(), v.end());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+template <std::vector<float> (*Input)(std::size_t)> void SimdSort(benchmark::State &state) {
+  const std::vector<float> input{Input(static_cast<std::size_t>(state.range(0)))};
+  std::vector<float> v(input.size());
+
+  for (auto _ : profiled{state}) {
+    std::copy(input.begin(), input.end(), v.begin());
+    simd_sort(v.data(), v.data() + v.size());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+BENCHMARK_TEMPLATE(StdSort, Random)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(SimdSort, Random)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(StdSort, NearlySorted)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(SimdSort, NearlySorted)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(StdSort, Duplicates)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(SimdSort, Duplicates)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_benchmark_profile.h"
+#include "simd_string.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace parallelism_v2 {
+namespace {
+
+// lines of comma separated fields, similar to a CSV file
+std::string Text(const std::size_t n) {
+  std::string s;
+  while (s.size() < n) {
+    s += "lorem,ipsum,dolor sit amet,consectetur,adipiscing elit;sed do eiusmod tempor\n";
+  }
+  s.resize(n);
+  return s;
+}
+
+// the only match is the last character
+void StdStrchr(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = 'b';
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(std::strchr(s.c_str(), 'b'));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdStrchr(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = 'b';
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_strchr(s.c_str(), 'b'));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void StdMemchr(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = 'b';
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(std::memchr(s.data(), 'b', n));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdMemchr(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = 'b';
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_memchr(s.data(), s.data() + n, 'b'));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void StdFindFirstOf(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = '\n';
+  const std::string_view v{s};
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(v.find_first_of(":;\r\n"));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdFindFirstOf(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  std::string s(n, 'a');
+  s.back() = '\n';
+
+  for (auto _ : profiled{state}) {
+    benchmark::DoNotOptimize(simd_find_first_of(s.data(), s.data() + n, ":;\r\n"));
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void ScalarTokenizer(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::string s{Text(n)};
+
+  for (auto _ : profiled{state}) {
+    std::size_t tokens{};
+    std::string_view rest{s};
+    for (std::size_t i{rest.find_first_of(",;\n")}; i != std::string_view::npos; i = rest.find_first_of(",;\n")) {
+      ++tokens;
+      rest.remove_prefix(i + 1U);
+    }
+    benchmark::DoNotOptimize(tokens);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+void SimdTokenizer(benchmark::State &state) {
+  const std::size_t n{static_cast<std::size_t>(state.range(0))};
+  const std::string s{Text(n)};
+
+  for (auto _ : profiled{state}) {
+    std::size_t tokens{};
+    simd_tokenizer<> tokenizer{s.data(), s.data() + n, ",;\n"};
+    for (std::string_view token; tokenizer.next(token);) {
+      ++tokens;
+    }
+    benchmark::DoNotOptimize(tokens);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+// 1 KiB to 256 KiB of input
+BENCHMARK(StdStrchr)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdStrchr)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdMemchr)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdMemchr)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(StdFindFirstOf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdFindFirstOf)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(ScalarTokenizer)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+BENCHMARK(SimdTokenizer)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+
+} // namespace
+} // namespace parallelism_v2
@@ -18,6 +18,13 @@ struct vector_aligned_tag {};
 constexpr element_aligned_tag element_aligned{};
 constexpr vector_aligned_tag vector_aligned{};
 
+/// @brief Flags for loads and stores of simd<float> which convert from and to 16 bit floating point values held as
+/// std::uint16_t, i.e., IEEE 754 half precision and bfloat16.
+struct float16_tag {};
+struct bfloat16_tag {};
+constexpr float16_tag float16{};
+constexpr bfloat16_tag bfloat16{};
+
 template <typename T> struct is_abi_tag : std::integral_constant<bool, false> {};
 template <typename T> constexpr bool is_abi_tag_v{is_abi_tag<T>::value};
 
@@ -72,29 +79,39 @@ public:
   simd_mask() noexcept = default;
 
   /// @brief Broadcast argument to all elements.
-  explicit simd_mask(const value_type v) noexcept : v_{Abi::template mask_impl<T>::broadcast(v)} {}
+  constexpr explicit simd_mask(const value_type v) noexcept : v_{Abi::template mask_impl<T>::broadcast(v)} {}
 
   /// @brief Construct from all given arguments.
-  template <typename = std::enable_if_t<size() == 4U>>
-  explicit simd_mask(const value_type w, const value_type x, const value_type y, const value_type z)
+  template <std::size_t N = size(), typename = std::enable_if_t<N == 4U>>
+  constexpr explicit simd_mask(const value_type w, const value_type x, const value_type y, const value_type z)
       : v_{Abi::template mask_impl<T>::init(w, x, y, z)} {}
 
+  /// @brief Convert from a mask of another element type of the same size.
+  ///
+  /// E.g., selects the elements of an index vector by a comparison of the corresponding values.
+  template <typename U, typename = std::enable_if_t<!std::is_same<U, T>::value>>
+  constexpr explicit simd_mask(const simd_mask<U, Abi> &v) noexcept
+      : v_{::parallelism_v2::detail::bit_cast<_storage_type>(
+            static_cast<typename simd_mask<U, Abi>::_storage_type>(v))} {
+    static_assert(sizeof(U) == sizeof(T), "element size mismatch");
+  }
+
   /// @brief Convert from argument.
-  explicit simd_mask(const _storage_type v) : v_{v} {}
+  constexpr explicit simd_mask(const _storage_type v) : v_{v} {}
 
   /// @brief Convert to underlying storage type.
-  explicit operator _storage_type() const { return v_; }
+  constexpr explicit operator _storage_type() const { return v_; }
 
   /// @brief The value of the ith element.
   ///
   /// @pre i < size()
-  value_type operator[](const std::size_t i) const {
+  constexpr value_type operator[](const std::size_t i) const {
     ENSURES(i < size());
     return Abi::template mask_impl<T>::extract(v_, i);
   }
 
   /// @brief Applies logical not to each element.
-  simd_mask operator!() const noexcept { return simd_mask{Abi::template mask_impl<T>::logical_not(v_)}; }
+  constexpr simd_mask operator!() const noexcept { return simd_mask{Abi::template mask_impl<T>::logical_not(v_)}; }
 
 private:
   _storage_type v_;
@@ -102,33 +119,46 @@ private:
 
 /// @brief Applies logical and to each element.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator&&(const simd_mask<T, Abi> &lhs, const simd_mask<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator&&(const simd_mask<T, Abi> &lhs, const simd_mask<T, Abi> &rhs) noexcept {
   using type = typename simd_mask<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template mask_impl<T>::logical_and(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Applies logical or to each element.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator||(const simd_mask<T, Abi> &lhs, const simd_mask<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator||(const simd_mask<T, Abi> &lhs, const simd_mask<T, Abi> &rhs) noexcept {
   using type = typename simd_mask<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template mask_impl<T>::logical_or(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if all boolean elements in v are true, false otherwise.
-template <typename T, typename Abi> bool all_of(const simd_mask<T, Abi> &v) noexcept {
+template <typename T, typename Abi> constexpr bool all_of(const simd_mask<T, Abi> &v) noexcept {
   return Abi::template mask_impl<T>::all_of(static_cast<typename simd_mask<T, Abi>::_storage_type>(v));
 }
 
 /// @brief Returns true if at least one boolean element in v is true, false otherwise.
-template <typename T, typename Abi> bool any_of(const simd_mask<T, Abi> &v) noexcept {
+template <typename T, typename Abi> constexpr bool any_of(const simd_mask<T, Abi> &v) noexcept {
   return Abi::template mask_impl<T>::any_of(static_cast<typename simd_mask<T, Abi>::_storage_type>(v));
 }
 
 /// @brief Returns true if none of the boolean elements in v is true, false otherwise.
-template <typename T, typename Abi> bool none_of(const simd_mask<T, Abi> &v) noexcept {
+template <typename T, typename Abi> constexpr bool none_of(const simd_mask<T, Abi> &v) noexcept {
   return Abi::template mask_impl<T>::none_of(static_cast<typename simd_mask<T, Abi>::_storage_type>(v));
 }
 
+/// @brief The number of true elements in v.
+template <typename T, typename Abi> constexpr int popcount(const simd_mask<T, Abi> &v) noexcept {
+  return Abi::template mask_impl<T>::popcount(static_cast<typename simd_mask<T, Abi>::_storage_type>(v));
+}
+
+/// @brief The index of the first true element in v.
+///
+/// @pre any_of(v)
+template <typename T, typename Abi> constexpr int find_first_set(const simd_mask<T, Abi> &v) {
+  ENSURES(any_of(v));
+  return Abi::template mask_impl<T>::find_first_set(static_cast<typename simd_mask<T, Abi>::_storage_type>(v));
+}
+
 /// @brief The class template simd is a data-parallel type T.
 ///
 /// A data-parallel type consists of elements of an underlying arithmetic type, called the element type. The number of
@@ -148,6 +178,43 @@ public:
   using mask_type = simd_mask<T, Abi>;
   using abi_type = Abi;
 
+  /// @brief A proxy to an element of a simd object.
+  ///
+  /// Reads and writes the element in the register without a round trip through memory.
+  class reference {
+  public:
+    reference(const reference &) = delete;
+
+    /// @brief The value of the referenced element.
+    constexpr operator value_type() const noexcept { return Abi::template impl<T>::extract(v_.v_, i_); }
+
+    /// @brief Replace the referenced element with x.
+    constexpr void operator=(const value_type x) && noexcept { v_.v_ = Abi::template impl<T>::insert(v_.v_, i_, x); }
+
+    /// @brief Replace the referenced element with the value of the element referenced by x.
+    constexpr void operator=(const reference &x) && noexcept { std::move(*this) = static_cast<value_type>(x); }
+
+    /// @brief Addition assignment operator.
+    constexpr void operator+=(const value_type x) && noexcept { std::move(*this) = static_cast<value_type>(*this) + x; }
+
+    /// @brief Subtraction assignment operator.
+    constexpr void operator-=(const value_type x) && noexcept { std::move(*this) = static_cast<value_type>(*this) - x; }
+
+    /// @brief Multiplication assignment operator.
+    constexpr void operator*=(const value_type x) && noexcept { std::move(*this) = static_cast<value_type>(*this) * x; }
+
+    /// @brief Division assignment operator.
+    constexpr void operator/=(const value_type x) && noexcept { std::move(*this) = static_cast<value_type>(*this) / x; }
+
+  private:
+    friend class simd;
+
+    constexpr reference(simd &v, const std::size_t i) noexcept : v_{v}, i_{i} {}
+
+    simd &v_;
+    const std::size_t i_;
+  };
+
   /// @brief The number of elements, i.e., the width, of parallelism_v2::simd<T, Abi>.
   static constexpr std::size_t size() noexcept { return simd_size_v<T, Abi>; }
 
@@ -157,26 +224,28 @@ public:
   simd() noexcept = default;
 
   /// @brief Broadcast argument to all elements.
-  explicit simd(const value_type v) noexcept : v_{Abi::template impl<T>::broadcast(v)} {}
+  constexpr explicit simd(const value_type v) noexcept : v_{Abi::template impl<T>::broadcast(v)} {}
 
   /// @brief Construct from all given arguments.
-  template <typename = std::enable_if_t<size() == 4U>>
-  explicit simd(const value_type w, const value_type x, const value_type y, const value_type z) noexcept
+  template <std::size_t N = size(), typename = std::enable_if_t<N == 4U>>
+  constexpr explicit simd(const value_type w, const value_type x, const value_type y, const value_type z) noexcept
       : v_{Abi::template impl<T>::init(w, x, y, z)} {}
 
   /// @brief Convert from argument.
-  explicit simd(const _storage_type &v) noexcept : v_{v} {}
+  constexpr explicit simd(const _storage_type &v) noexcept : v_{v} {}
 
   /// @brief Convert to underlying storage type.
-  explicit operator _storage_type() const { return v_; }
+  constexpr explicit operator _storage_type() const { return v_; }
 
   /// @brief Replaces the elements of the simd object from memory pointing to an aligned address.
   ///
   /// @pre [v, v + size()) is a valid range.
   /// @pre v shall point to storage aligned by parallelism_v2::memory_alignment_v<simd>.
-  void copy_from(const value_type *const v, vector_aligned_tag) {
+  constexpr void copy_from(const value_type *const v, vector_aligned_tag) {
     static_assert(is_simd_flag_type_v<vector_aligned_tag>, "not a simd flag type tag");
-    ENSURES(::parallelism_v2::detail::bit_cast<std::uintptr_t>(v) % memory_alignment_v<simd> == 0U);
+    if (!std::is_constant_evaluated()) {
+      ENSURES(::parallelism_v2::detail::bit_cast<std::uintptr_t>(v) % memory_alignment_v<simd> == 0U);
+    }
     v_ = Abi::template impl<T>::load_aligned(v);
   }
 
@@ -184,7 +253,7 @@ public:
   ///
   /// @pre [v, v + size()) is a valid range.
   /// @pre v shall point to storage aligned by alignof(value_type).
-  void copy_from(const value_type *const v, element_aligned_tag) {
+  constexpr void copy_from(const value_type *const v, element_aligned_tag) {
     static_assert(is_simd_flag_type_v<element_aligned_tag>, "not a simd flag type tag");
     v_ = Abi::template impl<T>::load(v);
   }
@@ -193,9 +262,11 @@ public:
   ///
   /// @pre [v, v + size()) is a valid range.
   /// @pre v shall point to storage aligned by parallelism_v2::memory_alignment_v<simd>.
-  void copy_to(value_type *const v, vector_aligned_tag) const {
+  constexpr void copy_to(value_type *const v, vector_aligned_tag) const {
     static_assert(is_simd_flag_type_v<vector_aligned_tag>, "not a simd flag type tag");
-    ENSURES(::parallelism_v2::detail::bit_cast<std::uintptr_t>(v) % memory_alignment_v<simd> == 0U);
+    if (!std::is_constant_evaluated()) {
+      ENSURES(::parallelism_v2::detail::bit_cast<std::uintptr_t>(v) % memory_alignment_v<simd> == 0U);
+    }
     Abi::template impl<T>::store_aligned(v, v_);
   }
 
@@ -203,133 +274,436 @@ public:
   ///
   /// @pre [v, v + size()) is a valid range.
   /// @pre v shall point to storage aligned by alignof(value_type).
-  void copy_to(value_type *const v, element_aligned_tag) const {
+  constexpr void copy_to(value_type *const v, element_aligned_tag) const {
     static_assert(is_simd_flag_type_v<element_aligned_tag>, "not a simd flag type tag");
     Abi::template impl<T>::store(v, v_);
   }
 
+  /// @brief Replaces the elements of the simd object by the conversion of IEEE 754 half precision values.
+  ///
+  /// Maps to VCVTPH2PS if the target supports F16C. Only for simd<float>.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  constexpr void copy_from(const std::uint16_t *const v, float16_tag) noexcept {
+    static_assert(std::is_same<T, float>::value, "not a float");
+    v_ = Abi::template impl<T>::load_float16(v);
+  }
+
+  /// @brief Replaces the elements of the simd object by the conversion of bfloat16 values.
+  ///
+  /// Only for simd<float>.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  constexpr void copy_from(const std::uint16_t *const v, bfloat16_tag) noexcept {
+    static_assert(std::is_same<T, float>::value, "not a float");
+    v_ = Abi::template impl<T>::load_bfloat16(v);
+  }
+
+  /// @brief Stores the elements of the simd object converted to IEEE 754 half precision, rounded to nearest even.
+  ///
+  /// Maps to VCVTPS2PH if the target supports F16C. Only for simd<float>.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  constexpr void copy_to(std::uint16_t *const v, float16_tag) const noexcept {
+    static_assert(std::is_same<T, float>::value, "not a float");
+    Abi::template impl<T>::store_float16(v, v_);
+  }
+
+  /// @brief Stores the elements of the simd object converted to bfloat16, rounded to nearest even.
+  ///
+  /// Only for simd<float>.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  constexpr void copy_to(std::uint16_t *const v, bfloat16_tag) const noexcept {
+    static_assert(std::is_same<T, float>::value, "not a float");
+    Abi::template impl<T>::store_bfloat16(v, v_);
+  }
+
   /// @brief The value of the ith element.
   ///
   /// @pre i < size()
-  value_type operator[](const std::size_t i) const {
+  constexpr value_type operator[](const std::size_t i) const & {
     ENSURES(i < size());
     return Abi::template impl<T>::extract(v_, i);
   }
 
+  /// @brief A reference to the ith element.
+  ///
+  /// @pre i < size()
+  constexpr reference operator[](const std::size_t i) & {
+    ENSURES(i < size());
+    return reference{*this, i};
+  }
+
   /// @brief Same as -1 * *this.
-  simd operator-() const noexcept { return simd{Abi::template impl<T>::negate(v_)}; }
+  constexpr simd operator-() const noexcept { return simd{Abi::template impl<T>::negate(v_)}; }
 
   /// @brief Addition assignment operator.
-  simd &operator+=(const simd &other) noexcept {
+  constexpr simd &operator+=(const simd &other) noexcept {
     v_ = Abi::template impl<T>::add(v_, other.v_);
     return *this;
   }
 
   /// @brief Subtraction assignment operator.
-  simd &operator-=(const simd &other) noexcept {
+  constexpr simd &operator-=(const simd &other) noexcept {
     v_ = Abi::template impl<T>::subtract(v_, other.v_);
     return *this;
   }
 
   /// @brief Multiplication assignment operator.
-  simd &operator*=(const simd &other) noexcept {
+  constexpr simd &operator*=(const simd &other) noexcept {
     v_ = Abi::template impl<T>::multiply(v_, other.v_);
     return *this;
   }
 
   /// @brief Division assignment operator.
-  simd &operator/=(const simd &other) noexcept {
+  constexpr simd &operator/=(const simd &other) noexcept {
     v_ = Abi::template impl<T>::divide(v_, other.v_);
     return *this;
   }
 
+  /// @brief Bitwise complement, only for integral types.
+  constexpr simd operator~() const noexcept {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    return simd{Abi::template impl<T>::bitwise_not(v_)};
+  }
+
+  /// @brief Bitwise and assignment operator, only for integral types.
+  constexpr simd &operator&=(const simd &other) noexcept {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    v_ = Abi::template impl<T>::bitwise_and(v_, other.v_);
+    return *this;
+  }
+
+  /// @brief Bitwise or assignment operator, only for integral types.
+  constexpr simd &operator|=(const simd &other) noexcept {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    v_ = Abi::template impl<T>::bitwise_or(v_, other.v_);
+    return *this;
+  }
+
+  /// @brief Bitwise xor assignment operator, only for integral types.
+  constexpr simd &operator^=(const simd &other) noexcept {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    v_ = Abi::template impl<T>::bitwise_xor(v_, other.v_);
+    return *this;
+  }
+
+  /// @brief Shifts all elements left by n bits, only for integral types.
+  ///
+  /// @pre 0 <= n < number of bits of T
+  constexpr simd &operator<<=(const int n) {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    ENSURES((0 <= n) && (n < static_cast<int>(8U * sizeof(T))));
+    v_ = Abi::template impl<T>::shift_left(v_, n);
+    return *this;
+  }
+
+  /// @brief Shifts all elements right by n bits, only for integral types.
+  ///
+  /// The shift is arithmetic for signed and logical for unsigned types.
+  ///
+  /// @pre 0 <= n < number of bits of T
+  constexpr simd &operator>>=(const int n) {
+    static_assert(std::is_integral<T>::value, "not an integral type");
+    ENSURES((0 <= n) && (n < static_cast<int>(8U * sizeof(T))));
+    v_ = Abi::template impl<T>::shift_right(v_, n);
+    return *this;
+  }
+
 private:
   _storage_type v_;
 };
 
+/// @brief The value of the Ith element of v.
+///
+/// Faster than v[I] as the index is known at compile time.
+template <std::size_t I, typename T, typename Abi> constexpr T extract(const simd<T, Abi> &v) noexcept {
+  static_assert(I < simd_size_v<T, Abi>, "index out of range");
+  using type = typename simd<T, Abi>::_storage_type;
+  return Abi::template impl<T>::template extract<I>(static_cast<type>(v));
+}
+
+/// @brief Returns v with the Ith element replaced by x.
+template <std::size_t I, typename T, typename Abi>
+constexpr simd<T, Abi> insert(const simd<T, Abi> &v, const typename simd<T, Abi>::value_type x) noexcept {
+  static_assert(I < simd_size_v<T, Abi>, "index out of range");
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::template insert<I>(static_cast<type>(v), x)};
+}
+
+/// @brief Returns the elements of a and b selected by the indices I...
+///
+/// Index i selects a[i] if i is less than size(), otherwise b[i - size()]. The indices are known at compile time such
+/// that the permutation maps to a single shuffle instruction where the target has one.
+template <std::size_t... I, typename T, typename Abi>
+constexpr simd<T, Abi> shuffle(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  static_assert(sizeof...(I) == simd_size_v<T, Abi>, "size mismatch");
+  static_assert(((I < 2U * simd_size_v<T, Abi>) && ...), "index out of range");
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::template shuffle<I...>(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns the elements of table selected by the elements of index, i.e., table[index[i]].
+///
+/// Unlike shuffle the indices are only known at run time. Maps to a single VPERMILPS with AVX and to PSHUFB otherwise,
+/// e.g., a lookup in a table of size() elements held in a register.
+///
+/// @pre 0 <= index[i] < size()
+template <typename T, typename Abi>
+constexpr simd<T, Abi> permute(const simd<T, Abi> &table, const simd<std::int32_t, Abi> &index) noexcept {
+  static_assert(simd_size_v<T, Abi> == simd_size_v<std::int32_t, Abi>, "size mismatch");
+  using type = typename simd<T, Abi>::_storage_type;
+  using index_type = typename simd<std::int32_t, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::permute(static_cast<type>(table), static_cast<index_type>(index))};
+}
+
+/// @brief Returns the elements loaded from memory at the offsets index, i.e., base[index[i]].
+///
+/// Maps to a single VGATHERDPS with AVX2 and to one load per element otherwise.
+///
+/// @pre base[index[i]] is a valid element.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> gather(const T *const base, const simd<std::int32_t, Abi> &index) noexcept {
+  static_assert(simd_size_v<T, Abi> == simd_size_v<std::int32_t, Abi>, "size mismatch");
+  using index_type = typename simd<std::int32_t, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::gather(base, static_cast<index_type>(index))};
+}
+
+/// @brief Returns the bytes of v selected by the bytes of index, i.e., byte i of the result is byte index_i of v, or
+/// zero if the most significant bit of index_i is set. The bytes are in little-endian order.
+///
+/// Maps to a single PSHUFB, e.g., to move the bytes of variable-length integers into their elements by a table of
+/// byte indices.
+///
+/// @pre index_i < sizeof(v) or index_i >= 0x80 for every byte index_i of index
+template <typename T, typename Abi>
+constexpr simd<T, Abi> permute_bytes(const simd<T, Abi> &v, const simd<T, Abi> &index) noexcept {
+  static_assert(std::is_integral_v<T> && (sizeof(T) == 4U), "bytes of 32 bit integers");
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::permute_bytes(static_cast<type>(v), static_cast<type>(index))};
+}
+
+/// @brief Returns the sums of the products of adjacent bytes, i.e., each 16-bit half of the result is
+/// a_0 * b_0 + a_1 * b_1 of the unsigned bytes a_0, a_1 of a and the signed bytes b_0, b_1 of b at the same position,
+/// saturated to [-32768, 32767]. The halves are in little-endian order.
+///
+/// Maps to a single PMADDUBSW, e.g., to combine pairs of decimal digits by the weights 10 and 1.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> madd_bytes(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  static_assert(std::is_integral_v<T> && (sizeof(T) == 4U), "bytes of 32 bit integers");
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::madd_bytes(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns the sums of the products of adjacent 16-bit halves, i.e., element i of the result is
+/// a_0 * b_0 + a_1 * b_1 of the signed halves a_0, a_1 of a[i] and b_0, b_1 of b[i], wrapping on overflow.
+///
+/// Maps to a single PMADDWD.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> madd_halves(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  static_assert(std::is_integral_v<T> && (sizeof(T) == 4U), "halves of 32 bit integers");
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::madd_halves(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns the elements of v converted to U, i.e., static_cast<U>(v[i]).
+///
+/// Converts float to std::int32_t by truncation towards zero and std::int32_t to float by rounding to nearest.
+///
+/// @pre v[i] is representable by U for float to std::int32_t.
+template <typename U, typename T, typename Abi>
+constexpr simd<U, Abi> static_simd_cast(const simd<T, Abi> &v) noexcept {
+  static_assert((std::is_same_v<T, float> && std::is_same_v<U, std::int32_t>) ||
+                    (std::is_same_v<T, std::int32_t> && std::is_same_v<U, float>),
+                "conversion not supported");
+  using type = typename simd<T, Abi>::_storage_type;
+  if constexpr (std::is_same_v<U, std::int32_t>) {
+    return simd<U, Abi>{Abi::template impl<T>::convert_to_int32(static_cast<type>(v))};
+  } else {
+    return simd<U, Abi>{Abi::template impl<T>::convert_to_float(static_cast<type>(v))};
+  }
+}
+
 /// @brief Addition operator.
-template <typename T, typename Abi> simd<T, Abi> operator+(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator+(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   simd<T, Abi> tmp{lhs};
   return tmp += rhs;
 }
 
 /// @brief Subtraction operator.
-template <typename T, typename Abi> simd<T, Abi> operator-(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator-(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   simd<T, Abi> tmp{lhs};
   return tmp -= rhs;
 }
 
 /// @brief Multiplication operator.
-template <typename T, typename Abi> simd<T, Abi> operator*(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator*(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   simd<T, Abi> tmp{lhs};
   return tmp *= rhs;
 }
 
 /// @brief Division operator.
-template <typename T, typename Abi> simd<T, Abi> operator/(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator/(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   simd<T, Abi> tmp{lhs};
   return tmp /= rhs;
 }
 
+/// @brief Bitwise and operator.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator&(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+  simd<T, Abi> tmp{lhs};
+  return tmp &= rhs;
+}
+
+/// @brief Bitwise or operator.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator|(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+  simd<T, Abi> tmp{lhs};
+  return tmp |= rhs;
+}
+
+/// @brief Bitwise xor operator.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> operator^(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+  simd<T, Abi> tmp{lhs};
+  return tmp ^= rhs;
+}
+
+/// @brief Left shift operator.
+template <typename T, typename Abi> constexpr simd<T, Abi> operator<<(const simd<T, Abi> &v, const int n) {
+  simd<T, Abi> tmp{v};
+  return tmp <<= n;
+}
+
+/// @brief Right shift operator.
+template <typename T, typename Abi> constexpr simd<T, Abi> operator>>(const simd<T, Abi> &v, const int n) {
+  simd<T, Abi> tmp{v};
+  return tmp >>= n;
+}
+
 /// @brief Returns true if lhs is equal to rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator==(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator==(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::equal(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if lhs is not equal to rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator!=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator!=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::not_equal(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if lhs is less than rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator<(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator<(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::less_than(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if lhs is less than or equal to rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator<=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator<=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::less_equal(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if lhs is greater than rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator>(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator>(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::greater_than(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns true if lhs is greater than or equal to rhs, false otherwise.
 template <typename T, typename Abi>
-simd_mask<T, Abi> operator>=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
+constexpr simd_mask<T, Abi> operator>=(const simd<T, Abi> &lhs, const simd<T, Abi> &rhs) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd_mask<T, Abi>{Abi::template impl<T>::greater_equal(static_cast<type>(lhs), static_cast<type>(rhs))};
 }
 
 /// @brief Returns the smaller of a and b. Returns a if one operand is NaN.
-template <typename T, typename Abi> simd<T, Abi> min(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+template <typename T, typename Abi> constexpr simd<T, Abi> min(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd<T, Abi>{Abi::template impl<T>::min(static_cast<type>(a), static_cast<type>(b))};
 }
 
 /// @brief Returns the greater of a and b. Returns a if one operand is NaN.
-template <typename T, typename Abi> simd<T, Abi> max(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+template <typename T, typename Abi> constexpr simd<T, Abi> max(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
   using type = typename simd<T, Abi>::_storage_type;
   return simd<T, Abi>{Abi::template impl<T>::max(static_cast<type>(a), static_cast<type>(b))};
 }
 
+/// @brief Returns the inclusive prefix sums of the elements, i.e., element i is v[0] + ... + v[i].
+template <typename T, typename Abi> constexpr simd<T, Abi> inclusive_scan(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::inclusive_scan(static_cast<type>(v))};
+}
+
+/// @brief Returns the exclusive prefix sums of the elements, i.e., element i is v[0] + ... + v[i - 1].
+///
+/// Element 0 is zero.
+template <typename T, typename Abi> constexpr simd<T, Abi> exclusive_scan(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::exclusive_scan(static_cast<type>(v))};
+}
+
+/// @brief Returns the sum of all elements.
+///
+/// The order of the additions is unspecified.
+template <typename T, typename Abi> constexpr T reduce(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return Abi::template impl<T>::reduce(static_cast<type>(v));
+}
+
+/// @brief Returns the smallest element.
+template <typename T, typename Abi> constexpr T hmin(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return Abi::template impl<T>::hmin(static_cast<type>(v));
+}
+
+/// @brief Returns the greatest element.
+template <typename T, typename Abi> constexpr T hmax(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return Abi::template impl<T>::hmax(static_cast<type>(v));
+}
+
+/// @brief Returns true for the elements of v which are equal to any of the first n elements of set.
+///
+/// Maps to a single SSE4.2 string comparison for simd<char>.
+///
+/// @pre n <= size()
+template <typename T, typename Abi>
+constexpr simd_mask<T, Abi> is_any_of(const simd<T, Abi> &v, const simd<T, Abi> &set, const std::size_t n) {
+  using type = typename simd<T, Abi>::_storage_type;
+  ENSURES((n <= simd<T, Abi>::size()));
+  return simd_mask<T, Abi>{Abi::template impl<T>::is_any_of(static_cast<type>(v), static_cast<type>(set), n)};
+}
+
+/// @brief Returns true for the elements of v which are in any of the closed ranges [ranges[0], ranges[1]],
+/// [ranges[2], ranges[3]], ... of the first n elements of ranges.
+///
+/// Maps to a single SSE4.2 string comparison for simd<char>, e.g., to classify the decimal digits by the range "09".
+///
+/// @pre n <= size() and n is even
+template <typename T, typename Abi>
+constexpr simd_mask<T, Abi> is_in_ranges(const simd<T, Abi> &v, const simd<T, Abi> &ranges, const std::size_t n) {
+  using type = typename simd<T, Abi>::_storage_type;
+  ENSURES((n <= simd<T, Abi>::size()) && ((n % 2U) == 0U));
+  return simd_mask<T, Abi>{Abi::template impl<T>::is_in_ranges(static_cast<type>(v), static_cast<type>(ranges), n)};
+}
+
 /// @brief Returns low if v is less than low, high if high is less than v, otherwise v.
 ///
 /// @pre low <= high
 template <typename T, typename Abi>
-simd<T, Abi> clamp(const simd<T, Abi> &v, const simd<T, Abi> &low, const simd<T, Abi> &high) {
+constexpr simd<T, Abi> clamp(const simd<T, Abi> &v, const simd<T, Abi> &low, const simd<T, Abi> &high) {
   ENSURES(all_of(low <= high));
   return ::parallelism_v2::min(::parallelism_v2::max(v, low), high);
 }
@@ -346,36 +720,36 @@ template <typename M, typename T> class where_expression {
 
 public:
   /// @brief Do not call directly. Instead use `where()` function.
-  where_expression(const M &mask, T &value) : m_{mask}, v_{value} {}
+  constexpr where_expression(const M &mask, T &value) : m_{mask}, v_{value} {}
   where_expression(const where_expression &) = delete;
   where_expression &operator=(const where_expression &) = delete;
 
   /// @brief Replace the elements of value with the elements of x for elements where mask is true.
-  template <typename U> void operator=(U &&x) && noexcept {
+  template <typename U> constexpr void operator=(U &&x) && noexcept {
     static_assert(std::is_same<const T, const std::remove_reference_t<U>>::value, "no known conversion");
     v_ = T{impl::blend(static_cast<type>(v_), static_cast<type>(std::forward<U>(x)), static_cast<mask_type>(m_))};
   }
 
   /// @brief Replace the elements of value with the elements of value + x for elements where mask is true.
-  template <typename U> void operator+=(U &&x) && noexcept {
+  template <typename U> constexpr void operator+=(U &&x) && noexcept {
     static_assert(std::is_same<const T, const std::remove_reference_t<U>>::value, "no known conversion");
     v_ = T{impl::blend(static_cast<type>(v_), static_cast<type>(v_ + std::forward<U>(x)), static_cast<mask_type>(m_))};
   }
 
   /// @brief Replace the elements of value with the elements of value - x for elements where mask is true.
-  template <typename U> void operator-=(U &&x) && noexcept {
+  template <typename U> constexpr void operator-=(U &&x) && noexcept {
     static_assert(std::is_same<const T, const std::remove_reference_t<U>>::value, "no known conversion");
     v_ = T{impl::blend(static_cast<type>(v_), static_cast<type>(v_ - std::forward<U>(x)), static_cast<mask_type>(m_))};
   }
 
   /// @brief Replace the elements of value with the elements of value * x for elements where mask is true.
-  template <typename U> void operator*=(U &&x) && noexcept {
+  template <typename U> constexpr void operator*=(U &&x) && noexcept {
     static_assert(std::is_same<const T, const std::remove_reference_t<U>>::value, "no known conversion");
     v_ = T{impl::blend(static_cast<type>(v_), static_cast<type>(v_ * std::forward<U>(x)), static_cast<mask_type>(m_))};
   }
 
   /// @brief Replace the elements of value with the elements of value / x for elements where mask is true.
-  template <typename U> void operator/=(U &&x) && noexcept {
+  template <typename U> constexpr void operator/=(U &&x) && noexcept {
     static_assert(std::is_same<const T, const std::remove_reference_t<U>>::value, "no known conversion");
     v_ = T{impl::blend(static_cast<type>(v_), static_cast<type>(v_ / std::forward<U>(x)), static_cast<mask_type>(m_))};
   }
@@ -391,7 +765,7 @@ private:
 ///
 /// Where `@` denotes one of the operators of `where_expression<>`.
 template <typename T, typename Abi>
-where_expression<simd_mask<T, Abi>, simd<T, Abi>> where(const typename simd<T, Abi>::mask_type &m,
+constexpr where_expression<simd_mask<T, Abi>, simd<T, Abi>> where(const typename simd<T, Abi>::mask_type &m,
                                                         simd<T, Abi> &v) noexcept {
   return {m, v};
 }
@@ -4,9 +4,12 @@
 #define DETAIL_SIMD_DEFAULT_BACKEND_H
 
 #include "detail/simd_data_types.h"
+#include "detail/simd_half.h"
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace parallelism_v2 {
@@ -15,16 +18,16 @@ namespace detail {
 template <typename T, int N> struct simd_vector { alignas(N * sizeof(T)) T v[N]; };
 
 template <int N> struct simd_default_mask_impl {
-  static simd_vector<bool, N> broadcast(const bool v) noexcept { return {v, v, v, v}; }
+  static constexpr simd_vector<bool, N> broadcast(const bool v) noexcept { return {v, v, v, v}; }
 
-  static simd_vector<bool, N> init(const bool w, const bool x, const bool y, const bool z) noexcept {
+  static constexpr simd_vector<bool, N> init(const bool w, const bool x, const bool y, const bool z) noexcept {
     static_assert(N == 4U, "size mismatch");
     return {w, x, y, z};
   };
 
-  static bool extract(const simd_vector<bool, N> &v, const size_t i) noexcept { return v.v[i]; }
+  static constexpr bool extract(const simd_vector<bool, N> &v, const size_t i) noexcept { return v.v[i]; }
 
-  static simd_vector<bool, N> logical_not(const simd_vector<bool, N> &v) noexcept {
+  static constexpr simd_vector<bool, N> logical_not(const simd_vector<bool, N> &v) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = !v.v[i];
@@ -32,7 +35,8 @@ template <int N> struct simd_default_mask_impl {
     return r;
   }
 
-  static simd_vector<bool, N> logical_and(const simd_vector<bool, N> &a, const simd_vector<bool, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> logical_and(const simd_vector<bool, N> &a,
+                                                    const simd_vector<bool, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] && b.v[i];
@@ -40,7 +44,8 @@ template <int N> struct simd_default_mask_impl {
     return r;
   }
 
-  static simd_vector<bool, N> logical_or(const simd_vector<bool, N> &a, const simd_vector<bool, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> logical_or(const simd_vector<bool, N> &a,
+                                                   const simd_vector<bool, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] || b.v[i];
@@ -48,7 +53,7 @@ template <int N> struct simd_default_mask_impl {
     return r;
   }
 
-  static bool all_of(const simd_vector<bool, N> &v) noexcept {
+  static constexpr bool all_of(const simd_vector<bool, N> &v) noexcept {
     for (int i{}; i < N; ++i) {
       if (!v.v[i]) {
         return false;
@@ -57,7 +62,7 @@ template <int N> struct simd_default_mask_impl {
     return true;
   }
 
-  static bool any_of(const simd_vector<bool, N> &v) noexcept {
+  static constexpr bool any_of(const simd_vector<bool, N> &v) noexcept {
     for (int i{}; i < N; ++i) {
       if (v.v[i]) {
         return true;
@@ -66,7 +71,7 @@ template <int N> struct simd_default_mask_impl {
     return false;
   }
 
-  static bool none_of(const simd_vector<bool, N> &v) noexcept {
+  static constexpr bool none_of(const simd_vector<bool, N> &v) noexcept {
     for (int i{}; i < N; ++i) {
       if (v.v[i]) {
         return false;
@@ -74,17 +79,33 @@ template <int N> struct simd_default_mask_impl {
     }
     return true;
   }
+
+  static constexpr int popcount(const simd_vector<bool, N> &v) noexcept {
+    int r{};
+    for (int i{}; i < N; ++i) {
+      r += v.v[i];
+    }
+    return r;
+  }
+
+  static constexpr int find_first_set(const simd_vector<bool, N> &v) noexcept {
+    int i{};
+    while (!v.v[i]) {
+      ++i;
+    }
+    return i;
+  }
 };
 
 template <typename T, int N> struct simd_default_impl {
-  static simd_vector<T, N> broadcast(const T v) noexcept { return {v, v, v, v}; }
+  static constexpr simd_vector<T, N> broadcast(const T v) noexcept { return {v, v, v, v}; }
 
-  static simd_vector<T, N> init(const T w, const T x, const T y, const T z) noexcept {
+  static constexpr simd_vector<T, N> init(const T w, const T x, const T y, const T z) noexcept {
     static_assert(N == 4U, "size mismatch");
     return {w, x, y, z};
   };
 
-  static simd_vector<T, N> load(const T *const v) {
+  static constexpr simd_vector<T, N> load(const T *const v) {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = v[i];
@@ -92,19 +113,136 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> load_aligned(const T *const v) { return load(v); }
+  static constexpr simd_vector<T, N> load_aligned(const T *const v) { return load(v); }
 
-  static void store(T *const v, const simd_vector<T, N> &a) {
+  static constexpr void store(T *const v, const simd_vector<T, N> &a) {
     for (int i = 0; i < N; ++i) {
       v[i] = a.v[i];
     }
   }
 
-  static void store_aligned(T *const v, const simd_vector<T, N> &a) { store(v, a); }
+  static constexpr void store_aligned(T *const v, const simd_vector<T, N> &a) { store(v, a); }
+
+  static constexpr simd_vector<T, N> load_float16(const std::uint16_t *const v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = float16_to_float<std::uint32_t, float>(v[i]);
+    }
+    return r;
+  }
+
+  static constexpr void store_float16(std::uint16_t *const v, const simd_vector<T, N> &a) noexcept {
+    for (int i = 0; i < N; ++i) {
+      v[i] = static_cast<std::uint16_t>(float_to_float16<std::uint32_t, float>(a.v[i]));
+    }
+  }
+
+  static constexpr simd_vector<T, N> load_bfloat16(const std::uint16_t *const v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = bfloat16_to_float<std::uint32_t, float>(v[i]);
+    }
+    return r;
+  }
+
+  static constexpr void store_bfloat16(std::uint16_t *const v, const simd_vector<T, N> &a) noexcept {
+    for (int i = 0; i < N; ++i) {
+      v[i] = static_cast<std::uint16_t>(float_to_bfloat16<std::uint32_t, float>(a.v[i]));
+    }
+  }
+
+  static constexpr T extract(const simd_vector<T, N> &v, const size_t i) noexcept { return v.v[i]; }
+
+  template <size_t I> static constexpr T extract(const simd_vector<T, N> &v) noexcept { return v.v[I]; }
+
+  static constexpr simd_vector<T, N> insert(const simd_vector<T, N> &v, const size_t i, const T x) noexcept {
+    simd_vector<T, N> r{v};
+    r.v[i] = x;
+    return r;
+  }
+
+  template <size_t I> static constexpr simd_vector<T, N> insert(const simd_vector<T, N> &v, const T x) noexcept {
+    return insert(v, I, x);
+  }
+
+  template <size_t... I>
+  static constexpr simd_vector<T, N> shuffle(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    constexpr size_t index[]{I...};
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = index[i] < size_t{N} ? a.v[index[i]] : b.v[index[i] - size_t{N}];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> permute(const simd_vector<T, N> &table,
+                                             const simd_vector<std::int32_t, N> &index) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = table.v[index.v[i]];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> permute_bytes(const simd_vector<T, N> &v,
+                                                   const simd_vector<T, N> &index) noexcept {
+    using bytes = std::array<unsigned char, N * sizeof(T)>;
+    const bytes a{bit_cast<bytes>(v)};
+    const bytes b{bit_cast<bytes>(index)};
+    bytes r{};
+    for (std::size_t i{}; i < r.size(); ++i) {
+      r[i] = ((b[i] & 0x80U) != 0U) ? 0U : a[b[i] % r.size()];
+    }
+    return bit_cast<simd_vector<T, N>>(r);
+  }
+
+  static constexpr simd_vector<T, N> madd_bytes(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    const auto x{bit_cast<std::array<std::uint8_t, N * sizeof(T)>>(a)};
+    const auto y{bit_cast<std::array<std::int8_t, N * sizeof(T)>>(b)};
+    std::array<std::int16_t, N * sizeof(T) / 2U> r{};
+    for (std::size_t i{}; i < r.size(); ++i) {
+      const int sum{x[2U * i] * y[2U * i] + x[2U * i + 1U] * y[2U * i + 1U]};
+      r[i] = static_cast<std::int16_t>(std::min(std::max(sum, -32768), 32767));
+    }
+    return bit_cast<simd_vector<T, N>>(r);
+  }
+
+  static constexpr simd_vector<T, N> madd_halves(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    const auto x{bit_cast<std::array<std::int16_t, N * sizeof(T) / 2U>>(a)};
+    const auto y{bit_cast<std::array<std::int16_t, N * sizeof(T) / 2U>>(b)};
+    std::array<std::int32_t, N * sizeof(T) / 4U> r{};
+    for (std::size_t i{}; i < r.size(); ++i) {
+      const std::int64_t sum{std::int64_t{x[2U * i]} * y[2U * i] + std::int64_t{x[2U * i + 1U]} * y[2U * i + 1U]};
+      r[i] = static_cast<std::int32_t>(sum);
+    }
+    return bit_cast<simd_vector<T, N>>(r);
+  }
+
+  static constexpr simd_vector<T, N> gather(const T *const base, const simd_vector<std::int32_t, N> &index) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = base[index.v[i]];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<std::int32_t, N> convert_to_int32(const simd_vector<T, N> &v) noexcept {
+    simd_vector<std::int32_t, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = static_cast<std::int32_t>(v.v[i]);
+    }
+    return r;
+  }
 
-  static T extract(const simd_vector<T, N> &v, const size_t i) noexcept { return v.v[i]; }
+  static constexpr simd_vector<float, N> convert_to_float(const simd_vector<T, N> &v) noexcept {
+    simd_vector<float, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = static_cast<float>(v.v[i]);
+    }
+    return r;
+  }
 
-  static simd_vector<T, N> add(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> add(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] + b.v[i];
@@ -112,7 +250,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> subtract(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> subtract(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] - b.v[i];
@@ -120,7 +258,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> multiply(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> multiply(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] * b.v[i];
@@ -128,7 +266,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> divide(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> divide(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] / b.v[i];
@@ -136,7 +274,40 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> negate(const simd_vector<T, N> &v) noexcept {
+  static constexpr simd_vector<T, N> fma(const simd_vector<T, N> &a, const simd_vector<T, N> &b,
+                                         const simd_vector<T, N> &c) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = a.v[i] * b.v[i] + c.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> mulhi(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = static_cast<T>((std::uint64_t{a.v[i]} * b.v[i]) >> 32);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> addsub(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = (i % 2 == 0) ? a.v[i] - b.v[i] : a.v[i] + b.v[i];
+    }
+    return r;
+  }
+
+  static simd_vector<T, N> sqrt(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::sqrt(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> negate(const simd_vector<T, N> &v) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = -v.v[i];
@@ -144,7 +315,55 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> bitwise_not(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = ~v.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> bitwise_and(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = a.v[i] & b.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> bitwise_or(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = a.v[i] | b.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> bitwise_xor(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = a.v[i] ^ b.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> shift_left(const simd_vector<T, N> &v, const int n) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = v.v[i] << n;
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> shift_right(const simd_vector<T, N> &v, const int n) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = v.v[i] >> n;
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] == b.v[i];
@@ -152,7 +371,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> not_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> not_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] != b.v[i];
@@ -160,7 +379,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> less_than(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> less_than(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] < b.v[i];
@@ -168,7 +387,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> less_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> less_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] <= b.v[i];
@@ -176,7 +395,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> greater_than(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> greater_than(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] > b.v[i];
@@ -184,7 +403,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> greater_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<bool, N> greater_equal(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = a.v[i] >= b.v[i];
@@ -192,7 +411,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> min(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> min(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = std::min(a.v[i], b.v[i]);
@@ -200,7 +419,7 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<T, N> max(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+  static constexpr simd_vector<T, N> max(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = std::max(a.v[i], b.v[i]);
@@ -208,17 +427,152 @@ template <typename T, int N> struct simd_default_impl {
     return r;
   }
 
-  static simd_vector<bool, N> is_nan(const simd_vector<T, N> &v) noexcept {
+  static constexpr simd_vector<T, N> inclusive_scan(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r{v};
+    for (int i = 1; i < N; ++i) {
+      r.v[i] = r.v[i - 1] + v.v[i];
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> exclusive_scan(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    r.v[0] = T{};
+    for (int i = 1; i < N; ++i) {
+      r.v[i] = r.v[i - 1] + v.v[i - 1];
+    }
+    return r;
+  }
+
+  static constexpr T reduce(const simd_vector<T, N> &v) noexcept {
+    T r{v.v[0]};
+    for (int i = 1; i < N; ++i) {
+      r += v.v[i];
+    }
+    return r;
+  }
+
+  static constexpr T hmin(const simd_vector<T, N> &v) noexcept {
+    T r{v.v[0]};
+    for (int i = 1; i < N; ++i) {
+      r = std::min(r, v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr T hmax(const simd_vector<T, N> &v) noexcept {
+    T r{v.v[0]};
+    for (int i = 1; i < N; ++i) {
+      r = std::max(r, v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> is_any_of(const simd_vector<T, N> &v, const simd_vector<T, N> &set,
+                                                  const size_t n) noexcept {
+    simd_vector<bool, N> r{};
+    for (int i = 0; i < N; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        r.v[i] = r.v[i] || (v.v[i] == set.v[j]);
+      }
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> is_in_ranges(const simd_vector<T, N> &v, const simd_vector<T, N> &ranges,
+                                                     const size_t n) noexcept {
+    simd_vector<bool, N> r{};
+    for (int i = 0; i < N; ++i) {
+      for (size_t j = 0; j + 1U < n; j += 2U) {
+        r.v[i] = r.v[i] || ((ranges.v[j] <= v.v[i]) && (v.v[i] <= ranges.v[j + 1U]));
+      }
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> is_nan(const simd_vector<T, N> &v) noexcept {
     static_assert(std::is_floating_point<T>::value, "not a floating point type");
     simd_vector<bool, N> r;
     for (int i = 0; i < N; ++i) {
-      r.v[i] = std::isnan(v.v[i]);
+      r.v[i] = v.v[i] != v.v[i];
     }
     return r;
   }
 
-  static simd_vector<T, N> blend(const simd_vector<T, N> &a, const simd_vector<T, N> &b,
-                                 const simd_vector<bool, N> &c) noexcept {
+  static constexpr simd_vector<T, N> abs(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::fabs(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> copysign(const simd_vector<T, N> &a, const simd_vector<T, N> &b) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::copysign(a.v[i], b.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> floor(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::floor(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> ceil(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::ceil(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> trunc(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::trunc(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> round(const simd_vector<T, N> &v) noexcept {
+    simd_vector<T, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::round(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> is_inf(const simd_vector<T, N> &v) noexcept {
+    simd_vector<bool, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::isinf(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> is_finite(const simd_vector<T, N> &v) noexcept {
+    simd_vector<bool, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::isfinite(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<bool, N> signbit(const simd_vector<T, N> &v) noexcept {
+    simd_vector<bool, N> r;
+    for (int i = 0; i < N; ++i) {
+      r.v[i] = std::signbit(v.v[i]);
+    }
+    return r;
+  }
+
+  static constexpr simd_vector<T, N> blend(const simd_vector<T, N> &a, const simd_vector<T, N> &b,
+                                           const simd_vector<bool, N> &c) noexcept {
     simd_vector<T, N> r;
     for (int i = 0; i < N; ++i) {
       r.v[i] = c.v[i] ? b.v[i] : a.v[i];
@@ -246,6 +600,17 @@ template <> struct is_abi_tag<detail::simd_default_backend<4U>> : std::integral_
 template <> struct is_simd<simd<float, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
 template <>
 struct is_simd_mask<simd_mask<float, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <>
+struct is_simd<simd<std::int32_t, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <>
+struct is_simd_mask<simd_mask<std::int32_t, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <>
+struct is_simd<simd<std::uint32_t, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <>
+struct is_simd_mask<simd_mask<std::uint32_t, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <> struct is_simd<simd<char, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
+template <>
+struct is_simd_mask<simd_mask<char, detail::simd_default_backend<4U>>> : std::integral_constant<bool, true> {};
 
 } // namespace parallelism_v2
 
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef DETAIL_SIMD_HALF_H
+#define DETAIL_SIMD_HALF_H
+
+#include "detail/utilities.h"
+#include <cstdint>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// The conversions between float and the 16 bit formats are written once for a std::uint32_t and a float, and for the
+// GCC/Clang vectors of std::uint32_t and float. For vectors, the comparisons yield masks and the conditional
+// operator selects element-wise, such that every branch is computed and the results are blended. Constants are
+// initialized as U{} + c since a braced initializer would only set the first element of a vector.
+
+/// @brief Converts the IEEE 754 half precision values in the lower 16 bits of h to float.
+///
+/// The exponent is rebiased and the mantissa shifted into place. Infinity and NaN keep the maximal exponent, NaN
+/// become quiet NaN with the same payload. Denormals are renormalized by a floating point subtraction.
+template <typename U, typename F> constexpr F float16_to_float(const U h) noexcept {
+  const U shifted_exponent{U{} + (0x7C00U << 13)};
+  const U magic{U{} + (113U << 23)};
+
+  const U o{(h & 0x7FFFU) << 13};
+  const U exponent{o & shifted_exponent};
+  const U normal{o + ((127U - 15U) << 23)};
+  const U special{(normal + ((128U - 16U) << 23)) | (((o & 0x7FFFFFU) != 0U) ? U{} + 0x400000U : U{})};
+  const U denormal{bit_cast<U>(bit_cast<F>(normal + (1U << 23)) - bit_cast<F>(magic))};
+  const U r{(exponent == shifted_exponent) ? special : ((exponent == 0U) ? denormal : normal)};
+  return bit_cast<F>(r | ((h & 0x8000U) << 16));
+}
+
+/// @brief Converts f to IEEE 754 half precision values in the lower 16 bits, rounded to nearest even.
+///
+/// Values beyond the half precision range become infinity, NaN become quiet NaN with the upper bits of the payload.
+/// Values in the denormal range are rounded by a floating point addition which aligns their mantissa.
+template <typename U, typename F> constexpr U float_to_float16(const F f) noexcept {
+  const U infinity{U{} + (255U << 23)};
+  const U overflow{U{} + ((127U + 16U) << 23)};
+  const U denormal_magic{U{} + (((127U - 15U) + (23U - 10U) + 1U) << 23)};
+
+  const U bits{bit_cast<U>(f)};
+  const U sign{(bits >> 16) & 0x8000U};
+  const U a{bits & 0x7FFFFFFFU};
+
+  const U special{(a > infinity) ? (((a >> 13) & 0x3FFU) | 0x7E00U) : U{} + 0x7C00U};
+  const U denormal{bit_cast<U>(bit_cast<F>(a) + bit_cast<F>(denormal_magic)) - denormal_magic};
+  const U normal{(a + ((15U - 127U) << 23) + 0xFFFU + ((a >> 13) & 1U)) >> 13};
+  const U r{(a >= overflow) ? special : ((a < (113U << 23)) ? denormal : normal)};
+  return r | sign;
+}
+
+/// @brief Converts the bfloat16 values in the lower 16 bits of h to float, i.e., they are the upper half of a float.
+template <typename U, typename F> constexpr F bfloat16_to_float(const U h) noexcept { return bit_cast<F>(h << 16); }
+
+/// @brief Converts f to bfloat16 values in the lower 16 bits, rounded to nearest even.
+///
+/// NaN are truncated and made quiet such that they do not round to infinity.
+template <typename U, typename F> constexpr U float_to_bfloat16(const F f) noexcept {
+  const U bits{bit_cast<U>(f)};
+  const U rounded{(bits + 0x7FFFU + ((bits >> 16) & 1U)) >> 16};
+  return ((bits & 0x7FFFFFFFU) > 0x7F800000U) ? ((bits >> 16) | 0x40U) : rounded;
+}
+
+} // namespace detail
+} // namespace parallelism_v2
+
+#endif // DETAIL_SIMD_HALF_H
@@ -4,15 +4,131 @@
 #define DETAIL_SIMD_MATH_H
 
 #include "simd_data_types.h"
+#include <cmath>
+#include <cstdint>
+#include <limits>
 
 namespace parallelism_v2 {
 
 /// @brief Returns true if v is a NaN, false otherwise
-template <typename Abi> simd_mask<float, Abi> is_nan(const simd<float, Abi> &v) noexcept {
+template <typename Abi> constexpr simd_mask<float, Abi> is_nan(const simd<float, Abi> &v) noexcept {
   using type = typename simd<float, Abi>::_storage_type;
   return simd_mask<float, Abi>{Abi::template impl<float>::is_nan(static_cast<type>(v))};
 }
 
+/// @brief Returns true if v is positive or negative infinity, false otherwise
+template <typename T, typename Abi> constexpr simd_mask<T, Abi> is_inf(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd_mask<T, Abi>{Abi::template impl<T>::is_inf(static_cast<type>(v))};
+}
+
+/// @brief Returns true if v is neither infinite nor a NaN, false otherwise
+template <typename T, typename Abi> constexpr simd_mask<T, Abi> is_finite(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd_mask<T, Abi>{Abi::template impl<T>::is_finite(static_cast<type>(v))};
+}
+
+/// @brief Returns true if the sign bit of v is set, false otherwise, i.e., also for -0 and NaN with the sign bit.
+template <typename T, typename Abi> constexpr simd_mask<T, Abi> signbit(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd_mask<T, Abi>{Abi::template impl<T>::signbit(static_cast<type>(v))};
+}
+
+/// @brief Returns the category of v, i.e., FP_NAN, FP_INFINITE, FP_ZERO, FP_SUBNORMAL or FP_NORMAL.
+template <typename Abi> constexpr simd<std::int32_t, Abi> fpclassify(const simd<float, Abi> &v) noexcept {
+  using V = simd<float, Abi>;
+  using I = simd<std::int32_t, Abi>;
+  using M = simd_mask<std::int32_t, Abi>;
+  using type = typename V::_storage_type;
+
+  const V magnitude{Abi::template impl<float>::abs(static_cast<type>(v))};
+  I r{FP_NORMAL};
+  where(M{magnitude < V{std::numeric_limits<float>::min()}}, r) = I{FP_SUBNORMAL};
+  where(M{magnitude == V{0.0F}}, r) = I{FP_ZERO};
+  where(M{is_inf(v)}, r) = I{FP_INFINITE};
+  where(M{is_nan(v)}, r) = I{FP_NAN};
+  return r;
+}
+
+/// @brief Returns the absolute values of the elements of v.
+///
+/// Clears the sign bits, i.e., also of -0 and NaN.
+template <typename T, typename Abi> constexpr simd<T, Abi> abs(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::abs(static_cast<type>(v))};
+}
+
+/// @brief Returns the magnitudes of the elements of a with the signs of the elements of b.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> copysign(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::copysign(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns the largest integers not greater than the elements of v.
+///
+/// Maps to ROUNDPS with SSE4.1, as do ceil, trunc and round.
+template <typename T, typename Abi> constexpr simd<T, Abi> floor(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::floor(static_cast<type>(v))};
+}
+
+/// @brief Returns the smallest integers not less than the elements of v.
+template <typename T, typename Abi> constexpr simd<T, Abi> ceil(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::ceil(static_cast<type>(v))};
+}
+
+/// @brief Returns the elements of v rounded towards zero.
+template <typename T, typename Abi> constexpr simd<T, Abi> trunc(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::trunc(static_cast<type>(v))};
+}
+
+/// @brief Returns the elements of v rounded to the nearest integers, halfway cases away from zero as std::round.
+template <typename T, typename Abi> constexpr simd<T, Abi> round(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::round(static_cast<type>(v))};
+}
+
+/// @brief Returns a * b + c.
+///
+/// Evaluated with a single rounding if the target supports FMA instructions, otherwise the product is rounded before
+/// the addition. Use `where(mask, c) = fma(a, b, c);` for a masked multiply-add with a single blend.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> fma(const simd<T, Abi> &a, const simd<T, Abi> &b, const simd<T, Abi> &c) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::fma(static_cast<type>(a), static_cast<type>(b), static_cast<type>(c))};
+}
+
+/// @brief Returns the upper 32 bits of the 64 bit products of the elements of a and b.
+///
+/// The multiplication in multiplicative hashing and counter-based random number generators, maps to two PMULUDQ with
+/// SSE4.2.
+template <typename Abi>
+constexpr simd<std::uint32_t, Abi> mulhi(const simd<std::uint32_t, Abi> &a,
+                                         const simd<std::uint32_t, Abi> &b) noexcept {
+  using type = typename simd<std::uint32_t, Abi>::_storage_type;
+  return simd<std::uint32_t, Abi>{Abi::template impl<std::uint32_t>::mulhi(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns a - b in the even and a + b in the odd elements.
+///
+/// The building block of the multiplication of interleaved complex numbers, maps to ADDSUBPS with SSE3.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> addsub(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::addsub(static_cast<type>(a), static_cast<type>(b))};
+}
+
+/// @brief Returns the square root of the elements of v.
+///
+/// Not usable in constant expressions.
+template <typename T, typename Abi> simd<T, Abi> sqrt(const simd<T, Abi> &v) noexcept {
+  using type = typename simd<T, Abi>::_storage_type;
+  return simd<T, Abi>{Abi::template impl<T>::sqrt(static_cast<type>(v))};
+}
+
 } // namespace parallelism_v2
 
 #endif // DETAIL_SIMD_MATH_H
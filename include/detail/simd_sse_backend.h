@@ -4,75 +4,1259 @@
 #define DETAIL_SIMD_SSE_BACKEND_H
 
 #include "detail/simd_data_types.h"
+#include "detail/simd_half.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <nmmintrin.h> // only include SSE4.2
+#include <type_traits>
+#if defined(__FMA__) || defined(__F16C__) || defined(__AVX__)
+#include <immintrin.h> // FMA3, F16C, AVX and AVX2 if enabled by the target
+#endif
 
 namespace parallelism_v2 {
 namespace detail {
 
+// Intrinsics cannot be evaluated at compile time. During constant evaluation every operation falls back to the
+// equivalent vector extension expression on the underlying GCC/Clang vector type.
+
 template <typename T> struct sse_mask_intrinsics;
 
 template <> struct sse_mask_intrinsics<float> {
-  static __m128 broadcast(const bool v) noexcept {
+  static constexpr __m128 broadcast(const bool v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(__v4si{} - static_cast<std::int32_t>(v));
+    }
     return _mm_castsi128_ps(_mm_set1_epi32(-static_cast<std::uint32_t>(v)));
   }
 
-  static __m128 init(const bool w, const bool x, const bool y, const bool z) noexcept {
+  static constexpr __m128 init(const bool w, const bool x, const bool y, const bool z) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(__v4si{-static_cast<std::int32_t>(w), -static_cast<std::int32_t>(x),
+                                     -static_cast<std::int32_t>(y), -static_cast<std::int32_t>(z)});
+    }
     return _mm_castsi128_ps(_mm_set_epi32(-static_cast<std::uint32_t>(z), -static_cast<std::uint32_t>(y),
                                           -static_cast<std::uint32_t>(x), -static_cast<std::uint32_t>(w)));
   };
 
-  static bool extract(const __m128 v, const std::size_t i) noexcept { return _mm_movemask_ps(v) & (1 << i); }
+  static constexpr bool extract(const __m128 v, const std::size_t i) noexcept { return movemask(v) & (1 << i); }
+
+  static constexpr __m128 logical_not(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bit_cast<__v4si>(v) == 0);
+    }
+    return _mm_cmpeq_ps(v, _mm_setzero_ps());
+  }
+
+  static constexpr __m128 logical_and(const __m128 a, __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bit_cast<__v4si>(a) & bit_cast<__v4si>(b));
+    }
+    return _mm_and_ps(a, b);
+  }
+
+  static constexpr __m128 logical_or(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bit_cast<__v4si>(a) | bit_cast<__v4si>(b));
+    }
+    return _mm_or_ps(a, b);
+  }
+
+  static constexpr bool all_of(const __m128 v) noexcept { return movemask(v) == 0b1111; }
+  static constexpr bool any_of(const __m128 v) noexcept { return movemask(v) > 0; }
+  static constexpr bool none_of(const __m128 v) noexcept { return movemask(v) == 0; }
+
+  static constexpr int popcount(const __m128 v) noexcept { return __builtin_popcount(movemask(v)); }
+  static constexpr int find_first_set(const __m128 v) noexcept { return __builtin_ctz(movemask(v)); }
+
+private:
+  friend struct sse_mask_intrinsics<std::int32_t>;
+
+  static constexpr int movemask(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v4si i{bit_cast<__v4si>(v) < 0};
+      return (i[0] & 0b0001) | (i[1] & 0b0010) | (i[2] & 0b0100) | (i[3] & 0b1000);
+    }
+    return _mm_movemask_ps(v);
+  }
+};
+
+template <> struct sse_mask_intrinsics<std::int32_t> {
+  static constexpr __m128i broadcast(const bool v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{} - static_cast<std::int32_t>(v));
+    }
+    return _mm_set1_epi32(-static_cast<std::int32_t>(v));
+  }
+
+  static constexpr __m128i init(const bool w, const bool x, const bool y, const bool z) noexcept {
+    return bit_cast<__m128i>(sse_mask_intrinsics<float>::init(w, x, y, z));
+  };
+
+  static constexpr bool extract(const __m128i v, const std::size_t i) noexcept {
+    return sse_mask_intrinsics<float>::extract(bit_cast<__m128>(v), i);
+  }
+
+  static constexpr __m128i logical_not(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(v) == 0);
+    }
+    return _mm_cmpeq_epi32(v, _mm_setzero_si128());
+  }
+
+  static constexpr __m128i logical_and(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) & bit_cast<__v4si>(b));
+    }
+    return _mm_and_si128(a, b);
+  }
+
+  static constexpr __m128i logical_or(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) | bit_cast<__v4si>(b));
+    }
+    return _mm_or_si128(a, b);
+  }
+
+  static constexpr bool all_of(const __m128i v) noexcept { return movemask(v) == 0b1111; }
+  static constexpr bool any_of(const __m128i v) noexcept { return movemask(v) > 0; }
+  static constexpr bool none_of(const __m128i v) noexcept { return movemask(v) == 0; }
+
+  static constexpr int popcount(const __m128i v) noexcept { return __builtin_popcount(movemask(v)); }
+  static constexpr int find_first_set(const __m128i v) noexcept { return __builtin_ctz(movemask(v)); }
 
-  static __m128 logical_not(const __m128 v) noexcept { return _mm_cmpeq_ps(v, _mm_setzero_ps()); }
-  static __m128 logical_and(const __m128 a, __m128 b) noexcept { return _mm_and_ps(a, b); }
-  static __m128 logical_or(const __m128 a, const __m128 b) noexcept { return _mm_or_ps(a, b); }
+private:
+  static constexpr int movemask(const __m128i v) noexcept {
+    return sse_mask_intrinsics<float>::movemask(bit_cast<__m128>(v));
+  }
+};
+
+template <> struct sse_mask_intrinsics<std::uint32_t> : sse_mask_intrinsics<std::int32_t> {};
+
+template <> struct sse_mask_intrinsics<char> {
+  static constexpr __m128i broadcast(const bool v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v16qi{} - static_cast<char>(v));
+    }
+    return _mm_set1_epi8(static_cast<char>(-static_cast<int>(v)));
+  }
 
-  static bool all_of(const __m128 v) noexcept { return _mm_movemask_ps(v) == 0b1111; }
-  static bool any_of(const __m128 v) noexcept { return _mm_movemask_ps(v) > 0; }
-  static bool none_of(const __m128 v) noexcept { return _mm_movemask_ps(v) == 0; }
+  static constexpr bool extract(const __m128i v, const std::size_t i) noexcept { return movemask(v) & (1 << i); }
+
+  static constexpr __m128i logical_not(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(v) == 0);
+    }
+    return _mm_cmpeq_epi8(v, _mm_setzero_si128());
+  }
+
+  static constexpr __m128i logical_and(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_and(a, b);
+  }
+
+  static constexpr __m128i logical_or(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_or(a, b);
+  }
+
+  static constexpr bool all_of(const __m128i v) noexcept { return movemask(v) == 0xFFFF; }
+  static constexpr bool any_of(const __m128i v) noexcept { return movemask(v) > 0; }
+  static constexpr bool none_of(const __m128i v) noexcept { return movemask(v) == 0; }
+
+  static constexpr int popcount(const __m128i v) noexcept { return __builtin_popcount(movemask(v)); }
+  static constexpr int find_first_set(const __m128i v) noexcept { return __builtin_ctz(movemask(v)); }
+
+private:
+  static constexpr int movemask(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v16qi c{bit_cast<__v16qi>(v)};
+      int r{};
+      for (int i{}; i < 16; ++i) {
+        r |= (c[i] < 0) << i;
+      }
+      return r;
+    }
+    return _mm_movemask_epi8(v);
+  }
 };
 
 template <typename T> struct sse_intrinsics;
 
 template <> struct sse_intrinsics<float> {
-  static __m128 broadcast(const float v) noexcept { return _mm_set1_ps(v); }
+  static constexpr __m128 broadcast(const float v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{v, v, v, v};
+    }
+    return _mm_set1_ps(v);
+  }
 
-  static __m128 init(const float w, const float x, const float y, const float z) noexcept {
+  static constexpr __m128 init(const float w, const float x, const float y, const float z) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{w, x, y, z};
+    }
     return _mm_set_ps(z, y, x, w);
   };
 
-  static __m128 load(const float *const v) noexcept { return _mm_loadu_ps(v); }
-  static __m128 load_aligned(const float *const v) noexcept { return _mm_load_ps(v); }
-  static void store(float *const v, __m128 a) noexcept { _mm_storeu_ps(v, a); }
-  static void store_aligned(float *const v, __m128 a) noexcept { _mm_store_ps(v, a); }
+  static constexpr __m128 load(const float *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{v[0], v[1], v[2], v[3]};
+    }
+    return _mm_loadu_ps(v);
+  }
+
+  static constexpr __m128 load_aligned(const float *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{v[0], v[1], v[2], v[3]};
+    }
+    return _mm_load_ps(v);
+  }
+
+  static constexpr void store(float *const v, __m128 a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = a[i];
+      }
+      return;
+    }
+    _mm_storeu_ps(v, a);
+  }
+
+  static constexpr void store_aligned(float *const v, __m128 a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = a[i];
+      }
+      return;
+    }
+    _mm_store_ps(v, a);
+  }
+
+  static constexpr __m128 load_float16(const std::uint16_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(float16_to_float<__v4su, __v4sf>(__v4su{v[0], v[1], v[2], v[3]}));
+    }
+    const __m128i h{_mm_loadl_epi64(reinterpret_cast<const __m128i *>(v))};
+#if defined(__F16C__)
+    return _mm_cvtph_ps(h);
+#else
+    return bit_cast<__m128>(float16_to_float<__v4su, __v4sf>(bit_cast<__v4su>(_mm_cvtepu16_epi32(h))));
+#endif
+  }
+
+  static constexpr void store_float16(std::uint16_t *const v, const __m128 a) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v4su h{float_to_float16<__v4su, __v4sf>(a)};
+      for (int i{}; i < 4; ++i) {
+        v[i] = static_cast<std::uint16_t>(h[i]);
+      }
+      return;
+    }
+#if defined(__F16C__)
+    const __m128i p{_mm_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)};
+#else
+    const __m128i h{bit_cast<__m128i>(float_to_float16<__v4su, __v4sf>(a))};
+    const __m128i p{_mm_packus_epi32(h, h)};
+#endif
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(v), p);
+  }
+
+  static constexpr __m128 load_bfloat16(const std::uint16_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bfloat16_to_float<__v4su, __v4sf>(__v4su{v[0], v[1], v[2], v[3]}));
+    }
+    // the zero extended 16 bit values shifted into the upper halves
+    const __m128i h{_mm_loadl_epi64(reinterpret_cast<const __m128i *>(v))};
+    return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), h));
+  }
+
+  static constexpr void store_bfloat16(std::uint16_t *const v, const __m128 a) noexcept {
+    const __v4su h{float_to_bfloat16<__v4su, __v4sf>(a)};
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = static_cast<std::uint16_t>(h[i]);
+      }
+      return;
+    }
+    const __m128i p{_mm_packus_epi32(bit_cast<__m128i>(h), bit_cast<__m128i>(h))};
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(v), p);
+  }
+
+  static constexpr float extract(const __m128 v, const std::size_t i) noexcept {
+    if (std::is_constant_evaluated()) {
+      return v[i];
+    }
+    // moves the bytes of element i into element 0 instead of spilling the register to memory
+    const __m128i control{_mm_cvtsi32_si128(static_cast<int>(0x03020100U + 0x04040404U * i))};
+    return _mm_cvtss_f32(_mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(v), control)));
+  }
+
+  template <std::size_t I> static constexpr float extract(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return v[I];
+    }
+    if constexpr (I == 0U) {
+      return _mm_cvtss_f32(v);
+    } else {
+      return _mm_cvtss_f32(_mm_shuffle_ps(v, v, I));
+    }
+  }
+
+  static constexpr __m128 insert(const __m128 v, const std::size_t i, const float x) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __v4si{0, 1, 2, 3} == static_cast<std::int32_t>(i) ? __m128{x, x, x, x} : v;
+    }
+    const __m128i mask{_mm_cmpeq_epi32(_mm_set1_epi32(static_cast<int>(i)), _mm_setr_epi32(0, 1, 2, 3))};
+    return _mm_blendv_ps(v, _mm_set1_ps(x), _mm_castsi128_ps(mask));
+  }
+
+  template <std::size_t I> static constexpr __m128 insert(const __m128 v, const float x) noexcept {
+    if (std::is_constant_evaluated()) {
+      return insert(v, I, x);
+    }
+    return _mm_insert_ps(v, _mm_set_ss(x), I << 4U);
+  }
+
+  // lowered to shufps, unpcklps, blendps or insertps depending on the indices
+  template <std::size_t... I> static constexpr __m128 shuffle(const __m128 a, const __m128 b) noexcept {
+    return __builtin_shufflevector(a, b, I...);
+  }
+
+  static constexpr __m128 permute(const __m128 table, const __m128i index) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v4si i{bit_cast<__v4si>(index)};
+      return __m128{table[i[0]], table[i[1]], table[i[2]], table[i[3]]};
+    }
+#if defined(__AVX__)
+    return _mm_permutevar_ps(table, index);
+#else
+    // the byte indices 4 index[i] + 0, 1, 2, 3 of the selected elements
+    const __m128i spread{_mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12)};
+    const __m128i offset{_mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3)};
+    const __m128i bytes{_mm_add_epi8(_mm_shuffle_epi8(_mm_slli_epi32(index, 2), spread), offset)};
+    return _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(table), bytes));
+#endif
+  }
+
+  static constexpr __m128 gather(const float *const base, const __m128i index) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v4si i{bit_cast<__v4si>(index)};
+      return __m128{base[i[0]], base[i[1]], base[i[2]], base[i[3]]};
+    }
+#if defined(__AVX2__)
+    return _mm_i32gather_ps(base, index, 4);
+#else
+    return _mm_setr_ps(base[_mm_cvtsi128_si32(index)], base[_mm_extract_epi32(index, 1)],
+                       base[_mm_extract_epi32(index, 2)], base[_mm_extract_epi32(index, 3)]);
+#endif
+  }
+
+  // truncates towards zero
+  static constexpr __m128i convert_to_int32(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__builtin_convertvector(v, __v4si));
+    }
+    return _mm_cvttps_epi32(v);
+  }
+
+  static constexpr __m128 add(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return a + b;
+    }
+    return _mm_add_ps(a, b);
+  }
+
+  static constexpr __m128 subtract(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return a - b;
+    }
+    return _mm_sub_ps(a, b);
+  }
+
+  static constexpr __m128 multiply(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return a * b;
+    }
+    return _mm_mul_ps(a, b);
+  }
+
+  static constexpr __m128 divide(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return a / b;
+    }
+    return _mm_div_ps(a, b);
+  }
+
+  static constexpr __m128 fma(const __m128 a, const __m128 b, const __m128 c) noexcept {
+    if (std::is_constant_evaluated()) {
+      return a * b + c;
+    }
+#if defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+  }
+
+  static constexpr __m128 addsub(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __builtin_shufflevector(a - b, a + b, 0, 5, 2, 7);
+    }
+    return _mm_addsub_ps(a, b);
+  }
+
+  static __m128 sqrt(const __m128 v) noexcept { return _mm_sqrt_ps(v); }
+
+  // clears the sign bits
+  static constexpr __m128 abs(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bit_cast<__v4su>(v) & 0x7FFFFFFFU);
+    }
+    return _mm_andnot_ps(_mm_set1_ps(-0.0F), v);
+  }
+
+  // the sign bits of b and the other bits of a
+  static constexpr __m128 copysign(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>((bit_cast<__v4su>(a) & 0x7FFFFFFFU) | (bit_cast<__v4su>(b) & 0x80000000U));
+    }
+    const __m128 sign{_mm_set1_ps(-0.0F)};
+    return _mm_or_ps(_mm_andnot_ps(sign, a), _mm_and_ps(sign, b));
+  }
+
+  static constexpr __m128 floor(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{std::floor(v[0]), std::floor(v[1]), std::floor(v[2]), std::floor(v[3])};
+    }
+    return _mm_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  }
+
+  static constexpr __m128 ceil(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{std::ceil(v[0]), std::ceil(v[1]), std::ceil(v[2]), std::ceil(v[3])};
+    }
+    return _mm_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+  }
+
+  static constexpr __m128 trunc(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{std::trunc(v[0]), std::trunc(v[1]), std::trunc(v[2]), std::trunc(v[3])};
+    }
+    return _mm_round_ps(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+
+  // There is no rounding mode for halfway cases away from zero. Adding the largest float below 0.5 with the sign of v
+  // reaches the next integer only for the fractions from 0.5 on, since the sum of a halfway case is rounded up to even.
+  static constexpr __m128 round(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __m128{std::round(v[0]), std::round(v[1]), std::round(v[2]), std::round(v[3])};
+    }
+    return trunc(_mm_add_ps(v, copysign(_mm_set1_ps(0.49999997F), v)));
+  }
+
+  static constexpr __m128 is_inf(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(abs(v) == std::numeric_limits<float>::infinity());
+    }
+    return _mm_cmpeq_ps(abs(v), _mm_set1_ps(std::numeric_limits<float>::infinity()));
+  }
+
+  // false for infinity and NaN
+  static constexpr __m128 is_finite(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(abs(v) < std::numeric_limits<float>::infinity());
+    }
+    return _mm_cmplt_ps(abs(v), _mm_set1_ps(std::numeric_limits<float>::infinity()));
+  }
+
+  // the sign bits shifted into all bits
+  static constexpr __m128 signbit(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(bit_cast<__v4si>(v) >> 31);
+    }
+    return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(v), 31));
+  }
+
+  static constexpr __m128 negate(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return -v;
+    }
+    return _mm_xor_ps(v, _mm_set1_ps(-0.0F));
+  }
+
+  static constexpr __m128 equal(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a == b);
+    }
+    return _mm_cmpeq_ps(a, b);
+  }
+
+  static constexpr __m128 not_equal(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a != b);
+    }
+    return _mm_cmpneq_ps(a, b);
+  }
+
+  static constexpr __m128 less_than(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a < b);
+    }
+    return _mm_cmplt_ps(a, b);
+  }
+
+  static constexpr __m128 less_equal(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a <= b);
+    }
+    return _mm_cmple_ps(a, b);
+  }
+
+  static constexpr __m128 greater_than(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a > b);
+    }
+    return _mm_cmpgt_ps(a, b);
+  }
+
+  static constexpr __m128 greater_equal(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(a >= b);
+    }
+    return _mm_cmpge_ps(a, b);
+  }
+
+  static constexpr __m128 min(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return b < a ? b : a;
+    }
+    return _mm_min_ps(b, a);
+  }
+
+  static constexpr __m128 max(const __m128 a, const __m128 b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return b > a ? b : a;
+    }
+    return _mm_max_ps(b, a);
+  }
+
+  static constexpr __m128 inclusive_scan(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __m128 r{v + __builtin_shufflevector(v, __m128{}, 4, 0, 1, 2)};
+      return r + __builtin_shufflevector(r, __m128{}, 4, 5, 0, 1);
+    }
+    const __m128 r{_mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)))};
+    return _mm_add_ps(r, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(r), 8)));
+  }
+
+  static constexpr __m128 exclusive_scan(const __m128 v) noexcept {
+    const __m128 r{inclusive_scan(v)};
+    if (std::is_constant_evaluated()) {
+      return __builtin_shufflevector(r, __m128{}, 4, 0, 1, 2);
+    }
+    return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(r), 4));
+  }
+
+  static constexpr float reduce(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return (v[0] + v[2]) + (v[1] + v[3]);
+    }
+    const __m128 r{_mm_add_ps(v, _mm_movehl_ps(v, v))};
+    return _mm_cvtss_f32(_mm_add_ss(r, _mm_shuffle_ps(r, r, 1)));
+  }
+
+  static constexpr float hmin(const __m128 v) noexcept {
+    const __m128 r{min(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(min(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr float hmax(const __m128 v) noexcept {
+    const __m128 r{max(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(max(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr __m128 is_nan(const __m128 v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128>(v != v);
+    }
+    return _mm_cmpunord_ps(v, v);
+  }
+
+  static constexpr __m128 blend(const __m128 a, const __m128 b, const __m128 c) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__v4si>(c) < 0 ? b : a;
+    }
+    return _mm_blendv_ps(a, b, c);
+  }
+};
+
+template <> struct sse_intrinsics<std::int32_t> {
+  static constexpr __m128i broadcast(const std::int32_t v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{v, v, v, v});
+    }
+    return _mm_set1_epi32(v);
+  }
+
+  static constexpr __m128i init(const std::int32_t w, const std::int32_t x, const std::int32_t y,
+                                const std::int32_t z) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{w, x, y, z});
+    }
+    return _mm_set_epi32(z, y, x, w);
+  };
+
+  static constexpr __m128i load(const std::int32_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{v[0], v[1], v[2], v[3]});
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr __m128i load_aligned(const std::int32_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{v[0], v[1], v[2], v[3]});
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr void store(std::int32_t *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = bit_cast<__v4si>(a)[i];
+      }
+      return;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr void store_aligned(std::int32_t *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = bit_cast<__v4si>(a)[i];
+      }
+      return;
+    }
+    _mm_store_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr std::int32_t extract(const __m128i v, const std::size_t i) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__v4si>(v)[i];
+    }
+    // moves the bytes of element i into element 0 instead of spilling the register to memory
+    const __m128i control{_mm_cvtsi32_si128(static_cast<int>(0x03020100U + 0x04040404U * i))};
+    return _mm_cvtsi128_si32(_mm_shuffle_epi8(v, control));
+  }
+
+  template <std::size_t I> static constexpr std::int32_t extract(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__v4si>(v)[I];
+    }
+    return _mm_extract_epi32(v, I);
+  }
+
+  static constexpr __m128i insert(const __m128i v, const std::size_t i, const std::int32_t x) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4si{0, 1, 2, 3} == static_cast<std::int32_t>(i) ? __v4si{x, x, x, x}
+                                                                                   : bit_cast<__v4si>(v));
+    }
+    const __m128i mask{_mm_cmpeq_epi32(_mm_set1_epi32(static_cast<int>(i)), _mm_setr_epi32(0, 1, 2, 3))};
+    return _mm_blendv_epi8(v, _mm_set1_epi32(x), mask);
+  }
+
+  template <std::size_t I> static constexpr __m128i insert(const __m128i v, const std::int32_t x) noexcept {
+    if (std::is_constant_evaluated()) {
+      return insert(v, I, x);
+    }
+    return _mm_insert_epi32(v, x, I);
+  }
+
+  template <std::size_t... I> static constexpr __m128i shuffle(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(__builtin_shufflevector(bit_cast<__v4si>(a), bit_cast<__v4si>(b), I...));
+  }
+
+  static constexpr __m128 convert_to_float(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return __builtin_convertvector(bit_cast<__v4si>(v), __m128);
+    }
+    return _mm_cvtepi32_ps(v);
+  }
+
+  static constexpr __m128i add(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) + bit_cast<__v4si>(b));
+    }
+    return _mm_add_epi32(a, b);
+  }
+
+  static constexpr __m128i subtract(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) - bit_cast<__v4si>(b));
+    }
+    return _mm_sub_epi32(a, b);
+  }
+
+  static constexpr __m128i multiply(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) * bit_cast<__v4si>(b));
+    }
+    return _mm_mullo_epi32(a, b);
+  }
+
+  // there is no integer division instruction, the compiler divides element by element
+  static constexpr __m128i divide(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v4si>(a) / bit_cast<__v4si>(b));
+  }
+
+  static constexpr __m128i fma(const __m128i a, const __m128i b, const __m128i c) noexcept {
+    return add(multiply(a, b), c);
+  }
+
+  static constexpr __m128i negate(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(-bit_cast<__v4si>(v));
+    }
+    return _mm_sub_epi32(_mm_setzero_si128(), v);
+  }
+
+  static constexpr __m128i bitwise_not(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(~bit_cast<__v4si>(v));
+    }
+    return _mm_xor_si128(v, _mm_set1_epi32(-1));
+  }
+
+  static constexpr __m128i bitwise_and(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) & bit_cast<__v4si>(b));
+    }
+    return _mm_and_si128(a, b);
+  }
+
+  static constexpr __m128i bitwise_or(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) | bit_cast<__v4si>(b));
+    }
+    return _mm_or_si128(a, b);
+  }
+
+  static constexpr __m128i bitwise_xor(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) ^ bit_cast<__v4si>(b));
+    }
+    return _mm_xor_si128(a, b);
+  }
+
+  static constexpr __m128i shift_left(const __m128i v, const int n) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(v) << n);
+    }
+    return _mm_slli_epi32(v, n);
+  }
+
+  // arithmetic shift, i.e., the sign bit is shifted in
+  static constexpr __m128i shift_right(const __m128i v, const int n) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(v) >> n);
+    }
+    return _mm_srai_epi32(v, n);
+  }
+
+  static constexpr __m128i permute_bytes(const __m128i v, const __m128i index) noexcept {
+    if (std::is_constant_evaluated()) {
+      using bytes = std::array<unsigned char, 16U>;
+      const bytes a{bit_cast<bytes>(v)};
+      const bytes b{bit_cast<bytes>(index)};
+      bytes r{};
+      for (std::size_t i{}; i < r.size(); ++i) {
+        r[i] = ((b[i] & 0x80U) != 0U) ? 0U : a[b[i] & 0x0FU];
+      }
+      return bit_cast<__m128i>(r);
+    }
+    return _mm_shuffle_epi8(v, index);
+  }
+
+  static constexpr __m128i madd_bytes(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      const auto x{bit_cast<std::array<std::uint8_t, 16U>>(a)};
+      const auto y{bit_cast<std::array<std::int8_t, 16U>>(b)};
+      std::array<std::int16_t, 8U> r{};
+      for (std::size_t i{}; i < r.size(); ++i) {
+        const int sum{x[2U * i] * y[2U * i] + x[2U * i + 1U] * y[2U * i + 1U]};
+        r[i] = static_cast<std::int16_t>(std::min(std::max(sum, -32768), 32767));
+      }
+      return bit_cast<__m128i>(r);
+    }
+    return _mm_maddubs_epi16(a, b);
+  }
+
+  static constexpr __m128i madd_halves(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      const auto x{bit_cast<std::array<std::int16_t, 8U>>(a)};
+      const auto y{bit_cast<std::array<std::int16_t, 8U>>(b)};
+      std::array<std::int32_t, 4U> r{};
+      for (std::size_t i{}; i < r.size(); ++i) {
+        const std::int64_t sum{std::int64_t{x[2U * i]} * y[2U * i] + std::int64_t{x[2U * i + 1U]} * y[2U * i + 1U]};
+        r[i] = static_cast<std::int32_t>(sum);
+      }
+      return bit_cast<__m128i>(r);
+    }
+    return _mm_madd_epi16(a, b);
+  }
+
+  static constexpr __m128i equal(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) == bit_cast<__v4si>(b));
+    }
+    return _mm_cmpeq_epi32(a, b);
+  }
+
+  static constexpr __m128i not_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_not(equal(a, b));
+  }
+
+  static constexpr __m128i less_than(const __m128i a, const __m128i b) noexcept { return greater_than(b, a); }
+
+  static constexpr __m128i less_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_not(greater_than(a, b));
+  }
+
+  static constexpr __m128i greater_than(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(a) > bit_cast<__v4si>(b));
+    }
+    return _mm_cmpgt_epi32(a, b);
+  }
+
+  static constexpr __m128i greater_equal(const __m128i a, const __m128i b) noexcept { return less_equal(b, a); }
+
+  static constexpr __m128i min(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, greater_than(a, b));
+    }
+    return _mm_min_epi32(a, b);
+  }
+
+  static constexpr __m128i max(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, less_than(a, b));
+    }
+    return _mm_max_epi32(a, b);
+  }
+
+  static constexpr __m128i inclusive_scan(const __m128i v) noexcept {
+    const __m128i r{add(v, shuffle<4, 0, 1, 2>(v, __m128i{}))};
+    return add(r, shuffle<4, 5, 0, 1>(r, __m128i{}));
+  }
+
+  static constexpr __m128i exclusive_scan(const __m128i v) noexcept {
+    return shuffle<4, 0, 1, 2>(inclusive_scan(v), __m128i{});
+  }
+
+  static constexpr std::int32_t reduce(const __m128i v) noexcept {
+    const __m128i r{add(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(add(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr std::int32_t hmin(const __m128i v) noexcept {
+    const __m128i r{min(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(min(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr std::int32_t hmax(const __m128i v) noexcept {
+    const __m128i r{max(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(max(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr __m128i blend(const __m128i a, const __m128i b, const __m128i c) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4si>(c) < 0 ? bit_cast<__v4si>(b) : bit_cast<__v4si>(a));
+    }
+    return _mm_blendv_epi8(a, b, c);
+  }
+};
+
+// The addition, multiplication, bitwise operations and shuffles are the same instructions for signed and unsigned
+// elements. Only the value type, division, right shift, comparisons and everything built on them differ.
+template <> struct sse_intrinsics<std::uint32_t> : sse_intrinsics<std::int32_t> {
+  static constexpr __m128i broadcast(const std::uint32_t v) noexcept {
+    return sse_intrinsics<std::int32_t>::broadcast(static_cast<std::int32_t>(v));
+  }
+
+  static constexpr __m128i init(const std::uint32_t w, const std::uint32_t x, const std::uint32_t y,
+                                const std::uint32_t z) noexcept {
+    return sse_intrinsics<std::int32_t>::init(static_cast<std::int32_t>(w), static_cast<std::int32_t>(x),
+                                              static_cast<std::int32_t>(y), static_cast<std::int32_t>(z));
+  };
+
+  static constexpr __m128i load(const std::uint32_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4su{v[0], v[1], v[2], v[3]});
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr __m128i load_aligned(const std::uint32_t *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v4su{v[0], v[1], v[2], v[3]});
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr void store(std::uint32_t *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = bit_cast<__v4su>(a)[i];
+      }
+      return;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr void store_aligned(std::uint32_t *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 4; ++i) {
+        v[i] = bit_cast<__v4su>(a)[i];
+      }
+      return;
+    }
+    _mm_store_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr std::uint32_t extract(const __m128i v, const std::size_t i) noexcept {
+    return static_cast<std::uint32_t>(sse_intrinsics<std::int32_t>::extract(v, i));
+  }
 
-  static float extract(const __m128 v, const std::size_t i) noexcept {
-    alignas(16) float tmp[4];
-    _mm_store_ps(tmp, v);
-    return tmp[i];
+  template <std::size_t I> static constexpr std::uint32_t extract(const __m128i v) noexcept {
+    return static_cast<std::uint32_t>(sse_intrinsics<std::int32_t>::extract<I>(v));
   }
 
-  static __m128 add(const __m128 a, const __m128 b) noexcept { return _mm_add_ps(a, b); }
-  static __m128 subtract(const __m128 a, const __m128 b) noexcept { return _mm_sub_ps(a, b); }
-  static __m128 multiply(const __m128 a, const __m128 b) noexcept { return _mm_mul_ps(a, b); }
-  static __m128 divide(const __m128 a, const __m128 b) noexcept { return _mm_div_ps(a, b); }
-  static __m128 negate(const __m128 v) noexcept { return _mm_xor_ps(v, _mm_set1_ps(-0.0F)); }
+  static constexpr __m128i insert(const __m128i v, const std::size_t i, const std::uint32_t x) noexcept {
+    return sse_intrinsics<std::int32_t>::insert(v, i, static_cast<std::int32_t>(x));
+  }
 
-  static __m128 equal(const __m128 a, const __m128 b) noexcept { return _mm_cmpeq_ps(a, b); }
-  static __m128 not_equal(const __m128 a, const __m128 b) noexcept { return _mm_cmpneq_ps(a, b); }
-  static __m128 less_than(const __m128 a, const __m128 b) noexcept { return _mm_cmplt_ps(a, b); }
-  static __m128 less_equal(const __m128 a, const __m128 b) noexcept { return _mm_cmple_ps(a, b); }
-  static __m128 greater_than(const __m128 a, const __m128 b) noexcept { return _mm_cmpgt_ps(a, b); }
-  static __m128 greater_equal(const __m128 a, const __m128 b) noexcept { return _mm_cmpge_ps(a, b); }
+  template <std::size_t I> static constexpr __m128i insert(const __m128i v, const std::uint32_t x) noexcept {
+    return sse_intrinsics<std::int32_t>::insert<I>(v, static_cast<std::int32_t>(x));
+  }
 
-  static __m128 min(const __m128 a, const __m128 b) noexcept { return _mm_min_ps(b, a); }
-  static __m128 max(const __m128 a, const __m128 b) noexcept { return _mm_max_ps(b, a); }
+  static constexpr __m128i divide(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v4su>(a) / bit_cast<__v4su>(b));
+  }
 
-  static __m128 is_nan(const __m128 v) noexcept { return _mm_cmpunord_ps(v, v); }
+  // logical shift, i.e., zeros are shifted in
+  static constexpr __m128i shift_right(const __m128i v, const int n) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4su>(v) >> n);
+    }
+    return _mm_srli_epi32(v, n);
+  }
+
+  // PMULUDQ multiplies the even elements to 64 bit products, the odd elements are shifted into the even positions for
+  // a second one, and the upper halves of both are blended together
+  static constexpr __m128i mulhi(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v2du x{bit_cast<__v2du>(a)};
+      const __v2du y{bit_cast<__v2du>(b)};
+      const __v2du even{((x & 0xFFFFFFFFU) * (y & 0xFFFFFFFFU)) >> 32};
+      const __v2du odd{((x >> 32) * (y >> 32)) & 0xFFFFFFFF00000000U};
+      return bit_cast<__m128i>(even | odd);
+    }
+    const __m128i even{_mm_mul_epu32(a, b)};
+    const __m128i odd{_mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32))};
+    return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+  }
+
+  static constexpr __m128i not_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_not(equal(a, b));
+  }
+
+  static constexpr __m128i less_than(const __m128i a, const __m128i b) noexcept { return greater_than(b, a); }
+
+  static constexpr __m128i less_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<std::int32_t>::logical_not(greater_than(a, b));
+  }
+
+  // there is no unsigned comparison, flipping the sign bits maps the unsigned to the signed order
+  static constexpr __m128i greater_than(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v4su>(a) > bit_cast<__v4su>(b));
+    }
+    const __m128i sign{_mm_set1_epi32(static_cast<int>(0x80000000U))};
+    return _mm_cmpgt_epi32(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+  }
+
+  static constexpr __m128i greater_equal(const __m128i a, const __m128i b) noexcept { return less_equal(b, a); }
+
+  static constexpr __m128i min(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, greater_than(a, b));
+    }
+    return _mm_min_epu32(a, b);
+  }
+
+  static constexpr __m128i max(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, less_than(a, b));
+    }
+    return _mm_max_epu32(a, b);
+  }
 
-  static __m128 blend(const __m128 a, const __m128 b, const __m128 c) noexcept { return _mm_blendv_ps(a, b, c); }
+  static constexpr std::uint32_t reduce(const __m128i v) noexcept {
+    return static_cast<std::uint32_t>(sse_intrinsics<std::int32_t>::reduce(v));
+  }
+
+  static constexpr std::uint32_t hmin(const __m128i v) noexcept {
+    const __m128i r{min(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(min(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+
+  static constexpr std::uint32_t hmax(const __m128i v) noexcept {
+    const __m128i r{max(v, shuffle<2, 3, 0, 1>(v, v))};
+    return extract<0U>(max(r, shuffle<1, 0, 3, 2>(r, r)));
+  }
+};
+
+template <> struct sse_intrinsics<char> {
+  static constexpr __m128i broadcast(const char v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v16qi{} + v);
+    }
+    return _mm_set1_epi8(v);
+  }
+
+  static constexpr __m128i load(const char *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(__v16qi{v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], v[9], v[10], v[11], v[12],
+                                       v[13], v[14], v[15]});
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr __m128i load_aligned(const char *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return load(v);
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(v));
+  }
+
+  static constexpr void store(char *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < 16; ++i) {
+        v[i] = bit_cast<__v16qi>(a)[i];
+      }
+      return;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr void store_aligned(char *const v, const __m128i a) noexcept {
+    if (std::is_constant_evaluated()) {
+      store(v, a);
+      return;
+    }
+    _mm_store_si128(reinterpret_cast<__m128i *>(v), a);
+  }
+
+  static constexpr char extract(const __m128i v, const std::size_t i) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__v16qi>(v)[i];
+    }
+    // moves element i into element 0 instead of spilling the register to memory
+    return static_cast<char>(_mm_cvtsi128_si32(_mm_shuffle_epi8(v, _mm_cvtsi32_si128(static_cast<int>(i)))));
+  }
+
+  template <std::size_t I> static constexpr char extract(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__v16qi>(v)[I];
+    }
+    return static_cast<char>(_mm_extract_epi8(v, I));
+  }
+
+  static constexpr __m128i insert(const __m128i v, const std::size_t i, const char x) noexcept {
+    return blend(v, broadcast(x), equal(broadcast(static_cast<char>(i)), index()));
+  }
+
+  template <std::size_t I> static constexpr __m128i insert(const __m128i v, const char x) noexcept {
+    if (std::is_constant_evaluated()) {
+      return insert(v, I, x);
+    }
+    return _mm_insert_epi8(v, x, I);
+  }
+
+  template <std::size_t... I> static constexpr __m128i shuffle(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(__builtin_shufflevector(bit_cast<__v16qi>(a), bit_cast<__v16qi>(b), I...));
+  }
+
+  static constexpr __m128i add(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(a) + bit_cast<__v16qi>(b));
+    }
+    return _mm_add_epi8(a, b);
+  }
+
+  static constexpr __m128i subtract(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(a) - bit_cast<__v16qi>(b));
+    }
+    return _mm_sub_epi8(a, b);
+  }
+
+  // there are no byte multiplication and division instructions, the compiler widens or divides element by element
+  static constexpr __m128i multiply(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v16qi>(a) * bit_cast<__v16qi>(b));
+  }
+
+  static constexpr __m128i divide(const __m128i a, const __m128i b) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v16qi>(a) / bit_cast<__v16qi>(b));
+  }
+
+  static constexpr __m128i fma(const __m128i a, const __m128i b, const __m128i c) noexcept {
+    return add(multiply(a, b), c);
+  }
+
+  static constexpr __m128i negate(const __m128i v) noexcept { return subtract(__m128i{}, v); }
+
+  static constexpr __m128i bitwise_not(const __m128i v) noexcept {
+    return sse_intrinsics<std::int32_t>::bitwise_not(v);
+  }
+  static constexpr __m128i bitwise_and(const __m128i a, const __m128i b) noexcept {
+    return sse_intrinsics<std::int32_t>::bitwise_and(a, b);
+  }
+  static constexpr __m128i bitwise_or(const __m128i a, const __m128i b) noexcept {
+    return sse_intrinsics<std::int32_t>::bitwise_or(a, b);
+  }
+  static constexpr __m128i bitwise_xor(const __m128i a, const __m128i b) noexcept {
+    return sse_intrinsics<std::int32_t>::bitwise_xor(a, b);
+  }
+
+  // there are no byte shift instructions, the compiler shifts words and masks
+  static constexpr __m128i shift_left(const __m128i v, const int n) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v16qi>(v) << n);
+  }
+  static constexpr __m128i shift_right(const __m128i v, const int n) noexcept {
+    return bit_cast<__m128i>(bit_cast<__v16qi>(v) >> n);
+  }
+
+  static constexpr __m128i equal(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(a) == bit_cast<__v16qi>(b));
+    }
+    return _mm_cmpeq_epi8(a, b);
+  }
+
+  static constexpr __m128i not_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<char>::logical_not(equal(a, b));
+  }
+
+  static constexpr __m128i less_than(const __m128i a, const __m128i b) noexcept { return greater_than(b, a); }
+
+  static constexpr __m128i less_equal(const __m128i a, const __m128i b) noexcept {
+    return sse_mask_intrinsics<char>::logical_not(greater_than(a, b));
+  }
+
+  // char is signed on x86
+  static constexpr __m128i greater_than(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(a) > bit_cast<__v16qi>(b));
+    }
+    return _mm_cmpgt_epi8(a, b);
+  }
+
+  static constexpr __m128i greater_equal(const __m128i a, const __m128i b) noexcept { return less_equal(b, a); }
+
+  static constexpr __m128i min(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, greater_than(a, b));
+    }
+    return _mm_min_epi8(a, b);
+  }
+
+  static constexpr __m128i max(const __m128i a, const __m128i b) noexcept {
+    if (std::is_constant_evaluated()) {
+      return blend(a, b, less_than(a, b));
+    }
+    return _mm_max_epi8(a, b);
+  }
+
+  static constexpr __m128i inclusive_scan(const __m128i v) noexcept {
+    __m128i r{add(v, shift<1>(v))};
+    r = add(r, shift<2>(r));
+    r = add(r, shift<4>(r));
+    return add(r, shift<8>(r));
+  }
+
+  static constexpr __m128i exclusive_scan(const __m128i v) noexcept { return shift<1>(inclusive_scan(v)); }
+
+  static constexpr char reduce(const __m128i v) noexcept {
+    return extract<15U>(inclusive_scan(v));
+  }
+
+  static constexpr char hmin(const __m128i v) noexcept {
+    __m128i r{min(v, shuffle<8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7>(v, v))};
+    r = min(r, shuffle<4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3>(r, r));
+    r = min(r, shuffle<2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1>(r, r));
+    return extract<0U>(min(r, shuffle<1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0>(r, r)));
+  }
+
+  static constexpr char hmax(const __m128i v) noexcept {
+    __m128i r{max(v, shuffle<8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7>(v, v))};
+    r = max(r, shuffle<4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3>(r, r));
+    r = max(r, shuffle<2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1>(r, r));
+    return extract<0U>(max(r, shuffle<1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0>(r, r)));
+  }
+
+  static constexpr __m128i blend(const __m128i a, const __m128i b, const __m128i c) noexcept {
+    if (std::is_constant_evaluated()) {
+      return bit_cast<__m128i>(bit_cast<__v16qi>(c) < 0 ? bit_cast<__v16qi>(b) : bit_cast<__v16qi>(a));
+    }
+    return _mm_blendv_epi8(a, b, c);
+  }
+
+  // SSE4.2 string comparison with explicit lengths: equal any, bytewise mask
+  static constexpr __m128i is_any_of(const __m128i v, const __m128i set, const std::size_t n) noexcept {
+    if (std::is_constant_evaluated()) {
+      __m128i r{};
+      for (std::size_t i{}; i < n; ++i) {
+        r = sse_mask_intrinsics<char>::logical_or(r, equal(v, broadcast(extract(set, i))));
+      }
+      return r;
+    }
+    return _mm_cmpestrm(set, static_cast<int>(n), v, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_UNIT_MASK);
+  }
+
+  // SSE4.2 string comparison with explicit lengths: ranges of signed bytes like the comparisons of char, bytewise mask
+  static constexpr __m128i is_in_ranges(const __m128i v, const __m128i ranges, const std::size_t n) noexcept {
+    if (std::is_constant_evaluated()) {
+      __m128i r{};
+      for (std::size_t i{}; i + 1U < n; i += 2U) {
+        const __m128i in{sse_mask_intrinsics<char>::logical_and(less_equal(broadcast(extract(ranges, i)), v),
+                                                               less_equal(v, broadcast(extract(ranges, i + 1U))))};
+        r = sse_mask_intrinsics<char>::logical_or(r, in);
+      }
+      return r;
+    }
+    return _mm_cmpestrm(ranges, static_cast<int>(n), v, 16, _SIDD_SBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_UNIT_MASK);
+  }
+
+private:
+  static constexpr __m128i index() noexcept {
+    return bit_cast<__m128i>(__v16qi{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15});
+  }
+
+  // moves element i to i + K, the first K elements become zero
+  template <int K> static constexpr __m128i shift(const __m128i v) noexcept {
+    if (std::is_constant_evaluated()) {
+      const __v16qi c{bit_cast<__v16qi>(v)};
+      __v16qi r{};
+      for (int i{K}; i < 16; ++i) {
+        r[i] = c[i - K];
+      }
+      return bit_cast<__m128i>(r);
+    }
+    return _mm_slli_si128(v, K);
+  }
 };
 
 template <typename T> struct sse_type;
@@ -81,6 +1265,21 @@ template <> struct sse_type<float> {
   using mask_type = __m128;
   static constexpr std::size_t width{4U};
 };
+template <> struct sse_type<std::int32_t> {
+  using storage_type = __m128i;
+  using mask_type = __m128i;
+  static constexpr std::size_t width{4U};
+};
+template <> struct sse_type<std::uint32_t> {
+  using storage_type = __m128i;
+  using mask_type = __m128i;
+  static constexpr std::size_t width{4U};
+};
+template <> struct sse_type<char> {
+  using storage_type = __m128i;
+  using mask_type = __m128i;
+  static constexpr std::size_t width{16U};
+};
 
 struct sse {
   template <typename T> using storage_type = typename sse_type<T>::storage_type;
@@ -100,6 +1299,12 @@ template <typename T> using compatible = detail::sse;
 template <> struct is_abi_tag<detail::sse> : std::integral_constant<bool, true> {};
 template <> struct is_simd<simd<float, detail::sse>> : std::integral_constant<bool, true> {};
 template <> struct is_simd_mask<simd_mask<float, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd<simd<std::int32_t, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd_mask<simd_mask<std::int32_t, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd<simd<std::uint32_t, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd_mask<simd_mask<std::uint32_t, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd<simd<char, detail::sse>> : std::integral_constant<bool, true> {};
+template <> struct is_simd_mask<simd_mask<char, detail::sse>> : std::integral_constant<bool, true> {};
 
 } // namespace parallelism_v2
 
@@ -0,0 +1,489 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef DETAIL_SIMD_VECTOR_EXTENSION_BACKEND_H
+#define DETAIL_SIMD_VECTOR_EXTENSION_BACKEND_H
+
+#include "detail/simd_data_types.h"
+#include "detail/simd_half.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace parallelism_v2 {
+namespace detail {
+
+/// @brief GCC/Clang vector type with N elements of type T.
+///
+/// The attribute is ignored on alias templates, hence the typedef inside a class template.
+template <typename T, int N> struct vext_type { typedef T type __attribute__((vector_size(N * sizeof(T)))); };
+template <typename T, int N> using vext_vector = typename vext_type<T, N>::type;
+
+/// @brief Signed integer type of the same size as T, i.e., the element type of the result of a vector comparison.
+template <std::size_t Size> struct vext_mask_element;
+template <> struct vext_mask_element<1U> { using type = std::int8_t; };
+template <> struct vext_mask_element<2U> { using type = std::int16_t; };
+template <> struct vext_mask_element<4U> { using type = std::int32_t; };
+template <> struct vext_mask_element<8U> { using type = std::int64_t; };
+template <typename T, int N> using vext_mask_vector = vext_vector<typename vext_mask_element<sizeof(T)>::type, N>;
+
+/// @brief Horizontal reduction of a vector with N elements by repeatedly folding the upper half onto the lower half.
+template <int N> struct vext_reduce {
+  static_assert((N & (N - 1)) == 0, "not a power of two");
+
+  template <typename V, typename Op> static constexpr auto apply(const V v, const Op op) noexcept {
+    return fold(v, op, std::make_index_sequence<N / 2>{});
+  }
+
+private:
+  template <typename V, typename Op, std::size_t... I>
+  static constexpr auto fold(const V v, const Op op, std::index_sequence<I...>) noexcept {
+    return vext_reduce<N / 2>::apply(
+        op(__builtin_shufflevector(v, v, I...), __builtin_shufflevector(v, v, (I + N / 2)...)), op);
+  }
+};
+
+template <> struct vext_reduce<1> {
+  template <typename V, typename Op> static constexpr auto apply(const V v, const Op) noexcept { return v[0]; }
+};
+
+template <typename T, int N> struct vext_mask_impl {
+  using mask = vext_mask_vector<T, N>;
+  using element = typename vext_mask_element<sizeof(T)>::type;
+
+  static constexpr mask broadcast(const bool v) noexcept { return mask{} - static_cast<element>(v); }
+
+  static constexpr mask init(const bool w, const bool x, const bool y, const bool z) noexcept {
+    static_assert(N == 4U, "size mismatch");
+    return mask{-static_cast<element>(w), -static_cast<element>(x), -static_cast<element>(y), -static_cast<element>(z)};
+  };
+
+  static constexpr bool extract(const mask v, const std::size_t i) noexcept { return v[i] != 0; }
+
+  static constexpr mask logical_not(const mask v) noexcept { return ~v; }
+  static constexpr mask logical_and(const mask a, const mask b) noexcept { return a & b; }
+  static constexpr mask logical_or(const mask a, const mask b) noexcept { return a | b; }
+
+  static constexpr bool all_of(const mask v) noexcept {
+    return vext_reduce<N>::apply(v, [](const auto a, const auto b) { return a & b; }) != 0;
+  }
+  static constexpr bool any_of(const mask v) noexcept {
+    return vext_reduce<N>::apply(v, [](const auto a, const auto b) { return a | b; }) != 0;
+  }
+  static constexpr bool none_of(const mask v) noexcept { return !any_of(v); }
+
+  static constexpr int popcount(const mask v) noexcept {
+    int r{};
+    for (int i{}; i < N; ++i) {
+      r += v[i] != 0;
+    }
+    return r;
+  }
+
+  static constexpr int find_first_set(const mask v) noexcept {
+    int i{};
+    while (v[i] == 0) {
+      ++i;
+    }
+    return i;
+  }
+};
+
+template <typename T, int N> struct vext_impl {
+  using vector = vext_vector<T, N>;
+  using mask = vext_mask_vector<T, N>;
+
+  static constexpr vector broadcast(const T v) noexcept { return broadcast(v, std::make_index_sequence<N>{}); }
+
+  static constexpr vector init(const T w, const T x, const T y, const T z) noexcept {
+    static_assert(N == 4U, "size mismatch");
+    return vector{w, x, y, z};
+  };
+
+  static constexpr vector load(const T *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return load(v, std::make_index_sequence<N>{});
+    }
+    vector r;
+    std::memcpy(&r, v, sizeof(vector));
+    return r;
+  }
+
+  static constexpr vector load_aligned(const T *const v) noexcept {
+    if (std::is_constant_evaluated()) {
+      return load(v, std::make_index_sequence<N>{});
+    }
+    vector r;
+    std::memcpy(&r, __builtin_assume_aligned(v, sizeof(vector)), sizeof(vector));
+    return r;
+  }
+
+  static constexpr void store(T *const v, const vector a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < N; ++i) {
+        v[i] = a[i];
+      }
+      return;
+    }
+    std::memcpy(v, &a, sizeof(vector));
+  }
+
+  static constexpr void store_aligned(T *const v, const vector a) noexcept {
+    if (std::is_constant_evaluated()) {
+      for (int i{}; i < N; ++i) {
+        v[i] = a[i];
+      }
+      return;
+    }
+    std::memcpy(__builtin_assume_aligned(v, sizeof(vector)), &a, sizeof(vector));
+  }
+
+  static constexpr vector load_float16(const std::uint16_t *const v) noexcept {
+    return float16_to_float<vext_vector<std::uint32_t, N>, vector>(widen(v, std::make_index_sequence<N>{}));
+  }
+
+  static constexpr void store_float16(std::uint16_t *const v, const vector a) noexcept {
+    narrow(v, float_to_float16<vext_vector<std::uint32_t, N>, vector>(a));
+  }
+
+  static constexpr vector load_bfloat16(const std::uint16_t *const v) noexcept {
+    return bfloat16_to_float<vext_vector<std::uint32_t, N>, vector>(widen(v, std::make_index_sequence<N>{}));
+  }
+
+  static constexpr void store_bfloat16(std::uint16_t *const v, const vector a) noexcept {
+    narrow(v, float_to_bfloat16<vext_vector<std::uint32_t, N>, vector>(a));
+  }
+
+  static constexpr T extract(const vector v, const std::size_t i) noexcept { return v[i]; }
+
+  template <std::size_t I> static constexpr T extract(const vector v) noexcept { return v[I]; }
+
+  // select instead of v[i] = x, which neither is a constant expression nor stays in a register
+  static constexpr vector insert(const vector v, const std::size_t i, const T x) noexcept {
+    using element = typename vext_mask_element<sizeof(T)>::type;
+    return index(std::make_index_sequence<N>{}) == static_cast<element>(i) ? broadcast(x) : v;
+  }
+
+  template <std::size_t I> static constexpr vector insert(const vector v, const T x) noexcept {
+    return insert(v, I, x);
+  }
+
+  template <std::size_t... I> static constexpr vector shuffle(const vector a, const vector b) noexcept {
+    return __builtin_shufflevector(a, b, I...);
+  }
+
+  static constexpr vector permute(const vector table, const vext_vector<std::int32_t, N> index) noexcept {
+    return permute(table, index, std::make_index_sequence<N>{});
+  }
+
+  static constexpr vector gather(const T *const base, const vext_vector<std::int32_t, N> index) noexcept {
+    return gather(base, index, std::make_index_sequence<N>{});
+  }
+
+  static constexpr vector permute_bytes(const vector v, const vector index) noexcept {
+    using bytes = vext_vector<unsigned char, N * static_cast<int>(sizeof(T))>;
+    return bit_cast<vector>(
+        permute_bytes(bit_cast<bytes>(v), bit_cast<bytes>(index), std::make_index_sequence<N * sizeof(T)>{}));
+  }
+
+  // the halves of every element computed within the element, i.e., without vectors wider than the register
+  static constexpr vector madd_bytes(const vector a, const vector b) noexcept {
+    using lanes = vext_vector<std::int32_t, N>;
+    const auto x{bit_cast<vext_vector<std::uint32_t, N>>(a)};
+    const auto y{bit_cast<lanes>(b)};
+    const auto half = [&](const int k) {
+      const auto product = [&](const int i) {
+        return bit_cast<lanes>((x >> (8 * i)) & 0xFFU) * ((y << (24 - 8 * i)) >> 24);
+      };
+      const lanes sum{product(k) + product(k + 1)};
+      const lanes low{sum < -32768 ? -32768 : sum};
+      return bit_cast<vext_vector<std::uint32_t, N>>(low > 32767 ? 32767 : low) & 0xFFFFU;
+    };
+    return bit_cast<vector>(half(0) | (half(2) << 16));
+  }
+
+  static constexpr vector madd_halves(const vector a, const vector b) noexcept {
+    using lanes = vext_vector<std::int32_t, N>;
+    const auto x{bit_cast<lanes>(a)};
+    const auto y{bit_cast<lanes>(b)};
+    const auto low{bit_cast<vext_vector<std::uint32_t, N>>(((x << 16) >> 16) * ((y << 16) >> 16))};
+    const auto high{bit_cast<vext_vector<std::uint32_t, N>>((x >> 16) * (y >> 16))};
+    return bit_cast<vector>(low + high);
+  }
+
+  // truncates towards zero
+  static constexpr vext_vector<std::int32_t, N> convert_to_int32(const vector v) noexcept {
+    return __builtin_convertvector(v, vext_vector<std::int32_t, N>);
+  }
+
+  static constexpr vext_vector<float, N> convert_to_float(const vector v) noexcept {
+    return __builtin_convertvector(v, vext_vector<float, N>);
+  }
+
+  static constexpr vector add(const vector a, const vector b) noexcept { return a + b; }
+  static constexpr vector subtract(const vector a, const vector b) noexcept { return a - b; }
+  static constexpr vector multiply(const vector a, const vector b) noexcept { return a * b; }
+  static constexpr vector divide(const vector a, const vector b) noexcept { return a / b; }
+  static constexpr vector negate(const vector v) noexcept { return -v; }
+
+  static constexpr vector bitwise_not(const vector v) noexcept { return ~v; }
+  static constexpr vector bitwise_and(const vector a, const vector b) noexcept { return a & b; }
+  static constexpr vector bitwise_or(const vector a, const vector b) noexcept { return a | b; }
+  static constexpr vector bitwise_xor(const vector a, const vector b) noexcept { return a ^ b; }
+  static constexpr vector shift_left(const vector v, const int n) noexcept { return v << n; }
+  static constexpr vector shift_right(const vector v, const int n) noexcept { return v >> n; }
+
+  // the elements widened to 64 bit, multiplied and the upper halves narrowed again
+  static constexpr vector mulhi(const vector a, const vector b) noexcept {
+    using wide = vext_vector<std::uint64_t, N>;
+    return __builtin_convertvector((__builtin_convertvector(a, wide) * __builtin_convertvector(b, wide)) >> 32, vector);
+  }
+
+  // contracted to a single FMA instruction by GCC and Clang if the target supports it
+  static constexpr vector fma(const vector a, const vector b, const vector c) noexcept { return a * b + c; }
+
+  static constexpr vector addsub(const vector a, const vector b) noexcept {
+    return alternate(a - b, a + b, std::make_index_sequence<N>{});
+  }
+
+  // the square root instructions of the widest chunks the target has, the loop only for other element types
+  static vector sqrt(const vector v) noexcept {
+#if defined(__AVX__)
+    if constexpr (std::is_same_v<T, float> && ((N % 8) == 0)) {
+      return chunked<8>(v, [](const vext_vector<float, 8> x) { return __builtin_ia32_sqrtps256(x); });
+    } else if constexpr (std::is_same_v<T, double> && ((N % 4) == 0)) {
+      return chunked<4>(v, [](const vext_vector<double, 4> x) { return __builtin_ia32_sqrtpd256(x); });
+    }
+#endif
+#if defined(__SSE2__)
+    if constexpr (std::is_same_v<T, float> && ((N % 4) == 0)) {
+      return chunked<4>(v, [](const vext_vector<float, 4> x) { return __builtin_ia32_sqrtps(x); });
+    } else if constexpr (std::is_same_v<T, double> && ((N % 2) == 0)) {
+      return chunked<2>(v, [](const vext_vector<double, 2> x) { return __builtin_ia32_sqrtpd(x); });
+    }
+#endif
+    vector r;
+    for (int i{}; i < N; ++i) {
+      r[i] = std::sqrt(v[i]);
+    }
+    return r;
+  }
+
+  static constexpr mask equal(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a == b, mask);
+  }
+  static constexpr mask not_equal(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a != b, mask);
+  }
+  static constexpr mask less_than(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a < b, mask);
+  }
+  static constexpr mask less_equal(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a <= b, mask);
+  }
+  static constexpr mask greater_than(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a > b, mask);
+  }
+  static constexpr mask greater_equal(const vector a, const vector b) noexcept {
+    return __builtin_convertvector(a >= b, mask);
+  }
+
+  // same operand order as minps/maxps: the second operand is returned if one operand is NaN
+  static constexpr vector min(const vector a, const vector b) noexcept { return b < a ? b : a; }
+  static constexpr vector max(const vector a, const vector b) noexcept { return b > a ? b : a; }
+
+  static constexpr vector inclusive_scan(const vector v) noexcept { return scan<1U>(v); }
+
+  static constexpr vector exclusive_scan(const vector v) noexcept {
+    return shift<1>(inclusive_scan(v), std::make_index_sequence<N>{});
+  }
+
+  static constexpr T reduce(const vector v) noexcept {
+    return vext_reduce<N>::apply(v, [](const auto a, const auto b) { return a + b; });
+  }
+  static constexpr T hmin(const vector v) noexcept {
+    return vext_reduce<N>::apply(v, [](const auto a, const auto b) { return b < a ? b : a; });
+  }
+  static constexpr T hmax(const vector v) noexcept {
+    return vext_reduce<N>::apply(v, [](const auto a, const auto b) { return b > a ? b : a; });
+  }
+
+  static constexpr mask is_any_of(const vector v, const vector set, const std::size_t n) noexcept {
+    mask r{};
+    for (std::size_t i{}; i < n; ++i) {
+      r |= __builtin_convertvector(v == set[i], mask);
+    }
+    return r;
+  }
+
+  static constexpr mask is_in_ranges(const vector v, const vector ranges, const std::size_t n) noexcept {
+    mask r{};
+    for (std::size_t i{}; i + 1U < n; i += 2U) {
+      r |= __builtin_convertvector((ranges[i] <= v) & (v <= ranges[i + 1U]), mask);
+    }
+    return r;
+  }
+
+  static constexpr mask is_nan(const vector v) noexcept {
+    static_assert(std::is_floating_point<T>::value, "not a floating point type");
+    return __builtin_convertvector(v != v, mask);
+  }
+
+  // the scalar functions are builtins, which GCC and Clang vectorize and evaluate in constant expressions
+  static constexpr vector abs(const vector v) noexcept {
+    return map(v, [](const T x) { return std::fabs(x); }, std::make_index_sequence<N>{});
+  }
+  static constexpr vector copysign(const vector a, const vector b) noexcept {
+    return zip(a, b, [](const T x, const T y) { return std::copysign(x, y); }, std::make_index_sequence<N>{});
+  }
+  static constexpr vector floor(const vector v) noexcept {
+    return map(v, [](const T x) { return std::floor(x); }, std::make_index_sequence<N>{});
+  }
+  static constexpr vector ceil(const vector v) noexcept {
+    return map(v, [](const T x) { return std::ceil(x); }, std::make_index_sequence<N>{});
+  }
+  static constexpr vector trunc(const vector v) noexcept {
+    return map(v, [](const T x) { return std::trunc(x); }, std::make_index_sequence<N>{});
+  }
+  // std::round is not vectorized, hence truncating after adding the largest value below 0.5 with the sign of v, which
+  // reaches the next integer only for the fractions from 0.5 on
+  static constexpr vector round(const vector v) noexcept {
+    constexpr T below_half{T{0.5} - std::numeric_limits<T>::epsilon() / 4};
+    return trunc(v + copysign(broadcast(below_half, std::make_index_sequence<N>{}), v));
+  }
+
+  static constexpr mask is_inf(const vector v) noexcept {
+    return __builtin_convertvector(abs(v) == std::numeric_limits<T>::infinity(), mask);
+  }
+  static constexpr mask is_finite(const vector v) noexcept {
+    return __builtin_convertvector(abs(v) < std::numeric_limits<T>::infinity(), mask);
+  }
+  static constexpr mask signbit(const vector v) noexcept {
+    return __builtin_convertvector(bit_cast<mask>(v) < 0, mask);
+  }
+
+  static constexpr vector blend(const vector a, const vector b, const mask c) noexcept { return c ? b : a; }
+
+private:
+  template <std::size_t... I> static constexpr vector broadcast(const T v, std::index_sequence<I...>) noexcept {
+    return vector{(static_cast<void>(I), v)...};
+  }
+
+  template <std::size_t... I> static constexpr mask index(std::index_sequence<I...>) noexcept { return mask{I...}; }
+
+  template <std::size_t... I>
+  static constexpr vector permute(const vector table, const vext_vector<std::int32_t, N> index,
+                                  std::index_sequence<I...>) noexcept {
+    return vector{table[index[I]]...};
+  }
+
+  template <typename B, std::size_t... I>
+  static constexpr B permute_bytes(const B v, const B index, std::index_sequence<I...>) noexcept {
+    return B{static_cast<unsigned char>(((index[I] & 0x80U) != 0U) ? 0U : v[index[I] % sizeof...(I)])...};
+  }
+
+  template <std::size_t... I>
+  static constexpr vector gather(const T *const base, const vext_vector<std::int32_t, N> index,
+                                 std::index_sequence<I...>) noexcept {
+    return vector{base[index[I]]...};
+  }
+
+  template <typename F, std::size_t... I>
+  static constexpr vector map(const vector v, F f, std::index_sequence<I...>) noexcept {
+    return vector{f(v[I])...};
+  }
+
+  template <typename F, std::size_t... I>
+  static constexpr vector zip(const vector a, const vector b, F f, std::index_sequence<I...>) noexcept {
+    return vector{f(a[I], b[I])...};
+  }
+
+  // op applied to the consecutive chunks of M elements
+  template <int M, typename Op> static vector chunked(const vector v, const Op op) noexcept {
+    using chunk = vext_vector<T, M>;
+    vector r;
+    for (int i{}; i < N; i += M) {
+      chunk c;
+      std::memcpy(&c, reinterpret_cast<const T *>(&v) + i, sizeof(chunk));
+      c = op(c);
+      std::memcpy(reinterpret_cast<T *>(&r) + i, &c, sizeof(chunk));
+    }
+    return r;
+  }
+
+  // the even elements of a and the odd elements of b
+  template <std::size_t... I>
+  static constexpr vector alternate(const vector a, const vector b, std::index_sequence<I...>) noexcept {
+    return __builtin_shufflevector(a, b, (I % 2U == 0U ? I : N + I)...);
+  }
+
+  // moves element i to i + K, the first K elements become zero
+  template <std::size_t K, std::size_t... I>
+  static constexpr vector shift(const vector v, std::index_sequence<I...>) noexcept {
+    return __builtin_shufflevector(v, vector{}, (I < K ? N + I : I - K)...);
+  }
+
+  // log2(N) steps of shifting by K = 1, 2, 4, ... elements and adding
+  template <std::size_t K> static constexpr vector scan(const vector v) noexcept {
+    if constexpr (K < N) {
+      return scan<2U * K>(v + shift<K>(v, std::make_index_sequence<N>{}));
+    } else {
+      return v;
+    }
+  }
+
+  template <std::size_t... I> static constexpr vector load(const T *const v, std::index_sequence<I...>) noexcept {
+    return vector{v[I]...};
+  }
+
+  // zero extends N 16 bit values
+  template <std::size_t... I>
+  static constexpr vext_vector<std::uint32_t, N> widen(const std::uint16_t *const v,
+                                                       std::index_sequence<I...>) noexcept {
+    return vext_vector<std::uint32_t, N>{v[I]...};
+  }
+
+  // stores the lower 16 bits of the elements of h
+  static constexpr void narrow(std::uint16_t *const v, const vext_vector<std::uint32_t, N> h) noexcept {
+    for (int i{}; i < N; ++i) {
+      v[i] = static_cast<std::uint16_t>(h[i]);
+    }
+  }
+};
+
+/// @brief Portable ABI on top of the GCC/Clang vector extensions with N elements per data-parallel object.
+///
+/// The compiler lowers the operations to whatever the target supports, e.g., SSE, AVX2 or AVX-512 depending on -march.
+template <int N> struct vector_extension {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "width not a power of two");
+
+  template <typename T> using storage_type = vext_vector<T, N>;
+  template <typename T> using mask_storage_type = vext_mask_vector<T, N>;
+  template <typename T> static constexpr std::size_t simd_size{N};
+  template <typename T> using impl = vext_impl<T, N>;
+  template <typename T> using mask_impl = vext_mask_impl<T, N>;
+};
+
+} // namespace detail
+
+namespace simd_abi {
+template <int N> using vector_extension = detail::vector_extension<N>;
+#if defined(SIMD_VECTOR_EXTENSION_BACKEND)
+template <int N> using fixed_size = detail::vector_extension<N>;
+template <typename T> using compatible = detail::vector_extension<16U / sizeof(T)>;
+#endif
+} // namespace simd_abi
+
+template <int N> struct is_abi_tag<detail::vector_extension<N>> : std::integral_constant<bool, true> {};
+template <typename T, int N>
+struct is_simd<simd<T, detail::vector_extension<N>>> : std::integral_constant<bool, std::is_arithmetic<T>::value> {};
+template <typename T, int N>
+struct is_simd_mask<simd_mask<T, detail::vector_extension<N>>>
+    : std::integral_constant<bool, std::is_arithmetic<T>::value> {};
+
+} // namespace parallelism_v2
+
+#endif // DETAIL_SIMD_VECTOR_EXTENSION_BACKEND_H
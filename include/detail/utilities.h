@@ -3,21 +3,20 @@
 #ifndef DETAIL_UTILITIES_H
 #define DETAIL_UTILITIES_H
 
-#include <cstring>
+#include <bit>
+#include <cstdlib>
 #include <type_traits>
 
 namespace parallelism_v2 {
 namespace detail {
 
-template <typename To, typename From> To bit_cast(const From &src) noexcept {
+template <typename To, typename From> constexpr To bit_cast(const From &src) noexcept {
   static_assert(sizeof(To) == sizeof(From), "not same size");
   static_assert(std::is_trivially_copyable<From>::value, "From not trivially copyable");
   static_assert(std::is_trivially_copyable<To>::value, "To not trivially copyable");
   static_assert(std::is_trivially_constructible<To>::value, "not trivially constructible");
 
-  To dst;
-  std::memcpy(&dst, &src, sizeof(To));
-  return dst;
+  return std::bit_cast<To>(src);
 }
 
 struct condition_violated {};
@@ -25,6 +24,50 @@ struct condition_violated {};
 } // namespace detail
 } // namespace parallelism_v2
 
+/// Contract levels selectable by defining SIMD_CONTRACT_LEVEL:
+/// - SIMD_CONTRACT_OFF: preconditions are neither evaluated nor checked.
+/// - SIMD_CONTRACT_ASSUME: preconditions are not checked, but the optimizer may assume that they hold.
+/// - SIMD_CONTRACT_ABORT: a violated precondition calls std::abort().
+/// - SIMD_CONTRACT_THROW: a violated precondition throws parallelism_v2::detail::condition_violated.
+///
+/// Defaults to SIMD_CONTRACT_THROW, or SIMD_CONTRACT_OFF if NDEBUG is defined.
+#define SIMD_CONTRACT_OFF 0
+#define SIMD_CONTRACT_ASSUME 1
+#define SIMD_CONTRACT_ABORT 2
+#define SIMD_CONTRACT_THROW 3
+
+#if !defined(SIMD_CONTRACT_LEVEL)
+#if defined(NDEBUG)
+#define SIMD_CONTRACT_LEVEL SIMD_CONTRACT_OFF
+#else
+#define SIMD_CONTRACT_LEVEL SIMD_CONTRACT_THROW
+#endif
+#endif
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_OFF
+#define ENSURES(c)                                                                                                     \
+  do {                                                                                                                 \
+  } while (false)
+#elif SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_ASSUME
+#if defined(__clang__)
+#define ENSURES(c) __builtin_assume(c)
+#else
+#define ENSURES(c)                                                                                                     \
+  do {                                                                                                                 \
+    if (!(c)) {                                                                                                        \
+      __builtin_unreachable();                                                                                         \
+    }                                                                                                                  \
+  } while (false)
+#endif
+#elif SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_ABORT
+#define ENSURES(c)                                                                                                     \
+  do {                                                                                                                 \
+    const bool condition{c};                                                                                           \
+    if (!condition) {                                                                                                  \
+      std::abort();                                                                                                    \
+    }                                                                                                                  \
+  } while (false)
+#elif SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
 #define ENSURES(c)                                                                                                     \
   do {                                                                                                                 \
     const bool condition{c};                                                                                           \
@@ -32,5 +75,8 @@ struct condition_violated {};
       throw parallelism_v2::detail::condition_violated{};                                                              \
     }                                                                                                                  \
   } while (false)
+#else
+#error "unknown SIMD_CONTRACT_LEVEL"
+#endif
 
 #endif // DETAIL_UTILITIES_H
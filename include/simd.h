@@ -3,7 +3,9 @@
 #ifndef SIMD_H
 #define SIMD_H
 
-#if defined(__SSE4_2__) && defined(__linux__)
+#if defined(SIMD_VECTOR_EXTENSION_BACKEND)
+#include "detail/simd_vector_extension_backend.h"
+#elif defined(__SSE4_2__) && defined(__linux__)
 #include "detail/simd_sse_backend.h"
 #else
 #include "detail/simd_default_backend.h"
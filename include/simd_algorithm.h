@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_ALGORITHM_H
+#define SIMD_ALGORITHM_H
+
+#include "simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace parallelism_v2 {
+
+/// @brief Writes the inclusive prefix sums of [first, last) to [out, out + (last - first)).
+///
+/// Each chunk of simd<T, Abi>::size() elements is scanned in registers and the running total of the preceding chunks
+/// is carried as a broadcast. Two chunks are combined before the carry is added such that the loop-carried dependency
+/// is a single addition per two chunks. The remaining elements are scanned one by one. Returns the end of the output
+/// range.
+///
+/// @pre [out, out + (last - first)) is a valid range which is either equal to or does not overlap [first, last).
+template <typename T, typename Abi = simd_abi::compatible<T>>
+T *simd_inclusive_scan(const T *first, const T *const last, T *out) noexcept {
+  using V = simd<T, Abi>;
+  constexpr std::size_t size{V::size()};
+
+  V carry{T{}};
+  for (; static_cast<std::size_t>(last - first) >= 2U * size; first += 2U * size, out += 2U * size) {
+    V a;
+    V b;
+    a.copy_from(first, element_aligned);
+    b.copy_from(first + size, element_aligned);
+    a = inclusive_scan(a);
+    b = inclusive_scan(b) + V{extract<size - 1U>(a)};
+    const V total{extract<size - 1U>(b)};
+    (a + carry).copy_to(out, element_aligned);
+    (b + carry).copy_to(out + size, element_aligned);
+    carry += total;
+  }
+  for (; static_cast<std::size_t>(last - first) >= size; first += size, out += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    v = inclusive_scan(v) + carry;
+    v.copy_to(out, element_aligned);
+    carry = V{extract<size - 1U>(v)};
+  }
+
+  T sum{extract<0U>(carry)};
+  for (; first != last; ++first, ++out) {
+    sum += *first;
+    *out = sum;
+  }
+  return out;
+}
+
+namespace detail {
+
+template <typename Abi> using index_simd = simd<std::int32_t, Abi>;
+
+// element i is i
+template <typename Abi> constexpr index_simd<Abi> lane_indices() noexcept {
+  return exclusive_scan(index_simd<Abi>{1});
+}
+
+// true for the first n <= size() elements, the lane indices are exact in every element type
+template <typename T, typename Abi> constexpr simd_mask<T, Abi> first_n(const std::size_t n) noexcept {
+  return exclusive_scan(simd<T, Abi>{T{1}}) < simd<T, Abi>{static_cast<T>(n)};
+}
+
+// loads the n < size() remaining elements of a range without reading past its end, the other elements are value
+template <typename V>
+V load_partial(const typename V::value_type *const first, const std::size_t n, const typename V::value_type value) {
+  typename V::value_type buffer[V::size()];
+  for (std::size_t i{}; i < V::size(); ++i) {
+    buffer[i] = (i < n) ? first[i] : value;
+  }
+  V v;
+  v.copy_from(buffer, element_aligned);
+  return v;
+}
+
+// Index of the first element of the non-empty range [first, last) whose key, i.e., the result of key(), is the minimum
+// or, if Greater is true, the maximum. Every element keeps the best key and the index of the first element which maps
+// to it. Four such accumulators process consecutive chunks independently, which hides the latency of the compare and
+// blend, before they are combined. A final horizontal reduction selects the smallest index of the best key.
+template <bool Greater, typename T, typename Abi, typename Key>
+std::ptrdiff_t select_index(const T *first, const T *const last, Key key) {
+  using V = simd<T, Abi>;
+  using I = index_simd<Abi>;
+  using M = simd_mask<std::int32_t, Abi>;
+  static_assert(sizeof(T) == sizeof(std::int32_t), "index elements are of a different size");
+  constexpr std::size_t size{V::size()};
+  constexpr std::size_t unroll{4U};
+  const auto better = [](const V &a, const V &b) {
+    if constexpr (Greater) {
+      return a > b;
+    } else {
+      return a < b;
+    }
+  };
+
+  const T *const begin{first};
+  V best[unroll];
+  I best_index[unroll];
+  for (std::size_t j{}; j < unroll; ++j) {
+    best[j] = key(V{*first});
+    best_index[j] = I{0};
+  }
+  I index{lane_indices<Abi>()};
+  for (; static_cast<std::size_t>(last - first) >= unroll * size; first += unroll * size) {
+    for (std::size_t j{}; j < unroll; ++j) {
+      V v;
+      v.copy_from(first + j * size, element_aligned);
+      v = key(v);
+      const typename V::mask_type m{better(v, best[j])};
+      where(m, best[j]) = v;
+      where(M{m}, best_index[j]) = index + I{static_cast<std::int32_t>(j * size)};
+    }
+    index += I{static_cast<std::int32_t>(unroll * size)};
+  }
+  for (std::size_t j{1U}; j < unroll; ++j) {
+    const typename V::mask_type m{better(best[j], best[0U]) ||
+                                  ((best[j] == best[0U]) && typename V::mask_type{best_index[j] < best_index[0U]})};
+    where(m, best[0U]) = best[j];
+    where(M{m}, best_index[0U]) = best_index[j];
+  }
+
+  for (; static_cast<std::size_t>(last - first) >= size; first += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    v = key(v);
+    const typename V::mask_type m{better(v, best[0U])};
+    where(m, best[0U]) = v;
+    where(M{m}, best_index[0U]) = index;
+    index += I{static_cast<std::int32_t>(size)};
+  }
+  if (first != last) {
+    const std::size_t n{static_cast<std::size_t>(last - first)};
+    const V v{key(load_partial<V>(first, n, *begin))};
+    const typename V::mask_type m{better(v, best[0U]) && first_n<T, Abi>(n)};
+    where(m, best[0U]) = v;
+    where(M{m}, best_index[0U]) = index;
+  }
+
+  const typename V::mask_type m{best[0U] == V{Greater ? hmax(best[0U]) : hmin(best[0U])}};
+  if (none_of(m)) {
+    return 0; // the key of the first element is NaN, which no other key compares to
+  }
+  where(M{!m}, best_index[0U]) = I{std::numeric_limits<std::int32_t>::max()};
+  return hmin(best_index[0U]);
+}
+
+} // namespace detail
+
+/// @brief Returns the first element in [first, last) for which pred is true, or last if there is none.
+///
+/// pred is called with a simd<T, Abi> and returns the corresponding mask. The search tests four chunks of
+/// simd<T, Abi>::size() elements at once and stops at the first chunk with any true element. The remaining elements at
+/// the end are loaded into a padded register such that no element past last is read.
+template <typename T, typename Abi = simd_abi::compatible<T>, typename Predicate>
+const T *simd_find_if(const T *first, const T *const last, Predicate pred) {
+  using V = simd<T, Abi>;
+  using M = typename V::mask_type;
+  constexpr std::size_t size{V::size()};
+
+  for (; static_cast<std::size_t>(last - first) >= 4U * size; first += 4U * size) {
+    V a;
+    V b;
+    V c;
+    V d;
+    a.copy_from(first, element_aligned);
+    b.copy_from(first + size, element_aligned);
+    c.copy_from(first + 2U * size, element_aligned);
+    d.copy_from(first + 3U * size, element_aligned);
+    const M ma{pred(a)};
+    const M mb{pred(b)};
+    const M mc{pred(c)};
+    const M md{pred(d)};
+    if (any_of((ma || mb) || (mc || md))) {
+      if (any_of(ma)) {
+        return first + find_first_set(ma);
+      }
+      if (any_of(mb)) {
+        return first + size + find_first_set(mb);
+      }
+      if (any_of(mc)) {
+        return first + 2U * size + find_first_set(mc);
+      }
+      return first + 3U * size + find_first_set(md);
+    }
+  }
+  for (; static_cast<std::size_t>(last - first) >= size; first += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    const M m{pred(v)};
+    if (any_of(m)) {
+      return first + find_first_set(m);
+    }
+  }
+  if (first == last) {
+    return last;
+  }
+  const std::size_t n{static_cast<std::size_t>(last - first)};
+  const M m{pred(detail::load_partial<V>(first, n, T{})) && detail::first_n<T, Abi>(n)};
+  return any_of(m) ? first + find_first_set(m) : last;
+}
+
+/// @brief Returns the number of elements in [first, last) for which pred is true.
+///
+/// pred is called with a simd<T, Abi> and returns the corresponding mask. Every element of an index vector counts the
+/// true elements of its lane, four of them count consecutive chunks independently. A final horizontal reduction adds
+/// them up.
+///
+/// @pre last - first <= std::numeric_limits<std::int32_t>::max()
+template <typename T, typename Abi = simd_abi::compatible<T>, typename Predicate>
+std::ptrdiff_t simd_count_if(const T *first, const T *const last, Predicate pred) {
+  using V = simd<T, Abi>;
+  using I = detail::index_simd<Abi>;
+  using M = simd_mask<std::int32_t, Abi>;
+  static_assert(sizeof(T) == sizeof(std::int32_t), "index elements are of a different size");
+  constexpr std::size_t size{V::size()};
+  constexpr std::size_t unroll{4U};
+
+  I counts[unroll];
+  for (std::size_t j{}; j < unroll; ++j) {
+    counts[j] = I{0};
+  }
+  for (; static_cast<std::size_t>(last - first) >= unroll * size; first += unroll * size) {
+    for (std::size_t j{}; j < unroll; ++j) {
+      V v;
+      v.copy_from(first + j * size, element_aligned);
+      where(M{pred(v)}, counts[j]) += I{1};
+    }
+  }
+
+  I count{(counts[0U] + counts[1U]) + (counts[2U] + counts[3U])};
+  for (; static_cast<std::size_t>(last - first) >= size; first += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    where(M{pred(v)}, count) += I{1};
+  }
+  if (first != last) {
+    const std::size_t n{static_cast<std::size_t>(last - first)};
+    where(M{pred(detail::load_partial<V>(first, n, T{})) && detail::first_n<T, Abi>(n)}, count) += I{1};
+  }
+  return reduce(count);
+}
+
+/// @brief Returns the first smallest element in [first, last), or last if the range is empty.
+///
+/// NaN elements are never selected unless the first element is NaN.
+///
+/// @pre last - first <= std::numeric_limits<std::int32_t>::max()
+template <typename T, typename Abi = simd_abi::compatible<T>>
+const T *simd_min_element(const T *const first, const T *const last) {
+  if (first == last) {
+    return last;
+  }
+  return first + detail::select_index<false, T, Abi>(first, last, [](const simd<T, Abi> &v) { return v; });
+}
+
+/// @brief Returns the first greatest element in [first, last), or last if the range is empty.
+///
+/// NaN elements are never selected unless the first element is NaN.
+///
+/// @pre last - first <= std::numeric_limits<std::int32_t>::max()
+template <typename T, typename Abi = simd_abi::compatible<T>>
+const T *simd_max_element(const T *const first, const T *const last) {
+  if (first == last) {
+    return last;
+  }
+  return first + detail::select_index<true, T, Abi>(first, last, [](const simd<T, Abi> &v) { return v; });
+}
+
+/// @brief Returns the index of the first element in [first, last) for which key is smallest, or 0 if the range is
+/// empty.
+///
+/// key is called with a simd<T, Abi> and returns a simd<T, Abi>, e.g., the distance of each element to a query point.
+///
+/// @pre last - first <= std::numeric_limits<std::int32_t>::max()
+template <typename T, typename Abi = simd_abi::compatible<T>, typename Key>
+std::ptrdiff_t simd_argmin(const T *const first, const T *const last, Key key) {
+  if (first == last) {
+    return 0;
+  }
+  return detail::select_index<false, T, Abi>(first, last, key);
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_ALGORITHM_H
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_COMPLEX_H
+#define SIMD_COMPLEX_H
+
+#include "simd.h"
+#include <complex>
+#include <cstddef>
+#include <utility>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// the even elements of the concatenation of a and b
+template <typename T, typename Abi, std::size_t... I>
+constexpr simd<T, Abi> even(const simd<T, Abi> &a, const simd<T, Abi> &b, std::index_sequence<I...>) noexcept {
+  return shuffle<(2U * I)...>(a, b);
+}
+
+// the odd elements of the concatenation of a and b
+template <typename T, typename Abi, std::size_t... I>
+constexpr simd<T, Abi> odd(const simd<T, Abi> &a, const simd<T, Abi> &b, std::index_sequence<I...>) noexcept {
+  return shuffle<(2U * I + 1U)...>(a, b);
+}
+
+// the elements [Offset, Offset + size()) of the interleaving a[0], b[0], a[1], b[1], ...
+template <std::size_t Offset, typename T, typename Abi, std::size_t... I>
+constexpr simd<T, Abi> interleave(const simd<T, Abi> &a, const simd<T, Abi> &b, std::index_sequence<I...>) noexcept {
+  return shuffle<((Offset + I) % 2U == 0U ? (Offset + I) / 2U : simd_size_v<T, Abi> + (Offset + I) / 2U)...>(a, b);
+}
+
+} // namespace detail
+
+/// @brief Data-parallel type of simd<T, Abi>::size() complex numbers.
+///
+/// The real and imaginary parts are held in separate registers, i.e., the split layout, such that the arithmetic needs
+/// no shuffles. Interleaved arrays of std::complex<T> are deinterleaved with shuffles on load and interleaved again on
+/// store, split arrays of real and imaginary parts are loaded directly.
+///
+/// The multiplication, division and abs use the textbook formulas, i.e., unlike std::complex without the special
+/// handling of infinities and NaN nor the scaling of std::hypot against overflow.
+template <typename T, typename Abi = simd_abi::compatible<T>> class complex_simd {
+public:
+  using value_type = std::complex<T>;
+  using real_type = simd<T, Abi>;
+
+  /// @brief Returns the number of elements.
+  static constexpr std::size_t size() noexcept { return real_type::size(); }
+
+  /// @brief Default initialize.
+  complex_simd() noexcept = default;
+
+  /// @brief Initializes the real and imaginary parts of the elements.
+  constexpr complex_simd(const real_type &re, const real_type &im) noexcept : re_{re}, im_{im} {}
+
+  /// @brief Broadcasts v to all elements.
+  constexpr explicit complex_simd(const value_type v) noexcept : re_{v.real()}, im_{v.imag()} {}
+
+  /// @brief Loads the elements from the interleaved array v.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  void copy_from(const value_type *const v, element_aligned_tag) noexcept {
+    const T *const p{reinterpret_cast<const T *>(v)};
+    real_type a;
+    real_type b;
+    a.copy_from(p, element_aligned);
+    b.copy_from(p + size(), element_aligned);
+    re_ = detail::even(a, b, std::make_index_sequence<size()>{});
+    im_ = detail::odd(a, b, std::make_index_sequence<size()>{});
+  }
+
+  /// @brief Loads the real parts from re and the imaginary parts from im.
+  ///
+  /// @pre [re, re + size()) and [im, im + size()) are valid ranges.
+  constexpr void copy_from(const T *const re, const T *const im, element_aligned_tag) noexcept {
+    re_.copy_from(re, element_aligned);
+    im_.copy_from(im, element_aligned);
+  }
+
+  /// @brief Stores the elements to the interleaved array v.
+  ///
+  /// @pre [v, v + size()) is a valid range.
+  void copy_to(value_type *const v, element_aligned_tag) const noexcept {
+    T *const p{reinterpret_cast<T *>(v)};
+    detail::interleave<0U>(re_, im_, std::make_index_sequence<size()>{}).copy_to(p, element_aligned);
+    detail::interleave<size()>(re_, im_, std::make_index_sequence<size()>{}).copy_to(p + size(), element_aligned);
+  }
+
+  /// @brief Stores the real parts to re and the imaginary parts to im.
+  ///
+  /// @pre [re, re + size()) and [im, im + size()) are valid ranges.
+  constexpr void copy_to(T *const re, T *const im, element_aligned_tag) const noexcept {
+    re_.copy_to(re, element_aligned);
+    im_.copy_to(im, element_aligned);
+  }
+
+  /// @brief The real parts of the elements.
+  constexpr const real_type &real() const noexcept { return re_; }
+
+  /// @brief The imaginary parts of the elements.
+  constexpr const real_type &imag() const noexcept { return im_; }
+
+  /// @brief The value of the ith element.
+  ///
+  /// @pre i < size()
+  constexpr value_type operator[](const std::size_t i) const {
+    ENSURES(i < size());
+    return value_type{re_[i], im_[i]};
+  }
+
+  /// @brief Same as -1 * *this.
+  constexpr complex_simd operator-() const noexcept { return complex_simd{-re_, -im_}; }
+
+  /// @brief Addition assignment operator.
+  constexpr complex_simd &operator+=(const complex_simd &other) noexcept {
+    re_ += other.re_;
+    im_ += other.im_;
+    return *this;
+  }
+
+  /// @brief Subtraction assignment operator.
+  constexpr complex_simd &operator-=(const complex_simd &other) noexcept {
+    re_ -= other.re_;
+    im_ -= other.im_;
+    return *this;
+  }
+
+  /// @brief Multiplication assignment operator.
+  ///
+  /// (a + bi)(c + di) = (ac - bd) + (ad + bc)i with two multiplications and two FMAs.
+  constexpr complex_simd &operator*=(const complex_simd &other) noexcept {
+    const real_type re{fma(re_, other.re_, -(im_ * other.im_))};
+    im_ = fma(re_, other.im_, im_ * other.re_);
+    re_ = re;
+    return *this;
+  }
+
+  /// @brief Division assignment operator.
+  ///
+  /// (a + bi) / (c + di) = (a + bi)(c - di) / (c^2 + d^2)
+  constexpr complex_simd &operator/=(const complex_simd &other) noexcept {
+    const real_type n{fma(other.re_, other.re_, other.im_ * other.im_)};
+    const real_type re{fma(re_, other.re_, im_ * other.im_)};
+    im_ = fma(im_, other.re_, -(re_ * other.im_)) / n;
+    re_ = re / n;
+    return *this;
+  }
+
+private:
+  real_type re_;
+  real_type im_;
+};
+
+/// @brief Addition operator.
+template <typename T, typename Abi>
+constexpr complex_simd<T, Abi> operator+(const complex_simd<T, Abi> &lhs, const complex_simd<T, Abi> &rhs) noexcept {
+  complex_simd<T, Abi> tmp{lhs};
+  return tmp += rhs;
+}
+
+/// @brief Subtraction operator.
+template <typename T, typename Abi>
+constexpr complex_simd<T, Abi> operator-(const complex_simd<T, Abi> &lhs, const complex_simd<T, Abi> &rhs) noexcept {
+  complex_simd<T, Abi> tmp{lhs};
+  return tmp -= rhs;
+}
+
+/// @brief Multiplication operator.
+template <typename T, typename Abi>
+constexpr complex_simd<T, Abi> operator*(const complex_simd<T, Abi> &lhs, const complex_simd<T, Abi> &rhs) noexcept {
+  complex_simd<T, Abi> tmp{lhs};
+  return tmp *= rhs;
+}
+
+/// @brief Division operator.
+template <typename T, typename Abi>
+constexpr complex_simd<T, Abi> operator/(const complex_simd<T, Abi> &lhs, const complex_simd<T, Abi> &rhs) noexcept {
+  complex_simd<T, Abi> tmp{lhs};
+  return tmp /= rhs;
+}
+
+/// @brief Returns the complex conjugates of the elements of v.
+template <typename T, typename Abi> constexpr complex_simd<T, Abi> conj(const complex_simd<T, Abi> &v) noexcept {
+  return complex_simd<T, Abi>{v.real(), -v.imag()};
+}
+
+/// @brief Returns the squared magnitudes of the elements of v.
+template <typename T, typename Abi> constexpr simd<T, Abi> norm(const complex_simd<T, Abi> &v) noexcept {
+  return fma(v.real(), v.real(), v.imag() * v.imag());
+}
+
+/// @brief Returns the magnitudes of the elements of v.
+///
+/// Not usable in constant expressions.
+template <typename T, typename Abi> simd<T, Abi> abs(const complex_simd<T, Abi> &v) noexcept {
+  return sqrt(norm(v));
+}
+
+/// @brief Returns the products of the complex numbers interleaved in a and b, i.e., real parts in the even and
+/// imaginary parts in the odd elements.
+///
+/// For data which stays interleaved: the real parts of b are duplicated into a product with a, the imaginary parts
+/// into a product with the swapped a, and both products are combined by addsub. These are three shuffles, two
+/// multiplications and an ADDSUBPS per size() / 2 complex numbers.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> multiply_interleaved(const simd<T, Abi> &a, const simd<T, Abi> &b) noexcept {
+  static_assert(simd_size_v<T, Abi> == 4U, "shuffles written for four elements");
+  const simd<T, Abi> re{shuffle<0U, 0U, 2U, 2U>(b, b)};
+  const simd<T, Abi> im{shuffle<1U, 1U, 3U, 3U>(b, b)};
+  const simd<T, Abi> swapped{shuffle<1U, 0U, 3U, 2U>(a, a)};
+  return addsub(a * re, swapped * im);
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_COMPLEX_H
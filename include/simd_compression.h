@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_COMPRESSION_H
+#define SIMD_COMPRESSION_H
+
+#include "simd.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace parallelism_v2 {
+
+/// @brief The number of integers of a block of bitpack, i.e., 32 rows of simd<std::uint32_t, Abi>::size() integers.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+constexpr std::size_t bitpack_block_size{32U * simd_size_v<std::uint32_t, Abi>};
+
+/// @brief The number of words of n integers packed by bitpack with bits per integer, i.e., bits words per lane and
+/// started block.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+constexpr std::size_t bitpack_words(const std::size_t n, const unsigned bits) noexcept {
+  constexpr std::size_t block{bitpack_block_size<Abi>};
+  return (n + block - 1U) / block * bits * simd_size_v<std::uint32_t, Abi>;
+}
+
+namespace detail {
+
+// every element is the last element of v, by a shuffle which stays in the register
+template <typename V, std::size_t... I> constexpr V last_element(const V &v, std::index_sequence<I...>) noexcept {
+  return shuffle<(static_cast<void>(I), V::size() - 1U)...>(v, v);
+}
+
+// Packs a block of 32 rows of V::size() integers. Lane j of the rows is packed into lane j of Bits consecutive
+// words, i.e., the rows are shifted into place in registers without moving integers between lanes.
+template <unsigned Bits, typename V> void pack_block(const std::uint32_t *const in, std::uint32_t *out) noexcept {
+  constexpr std::size_t size{V::size()};
+  if constexpr (Bits != 0U) {
+    V word{0U};
+    unsigned shift{};
+    for (std::size_t r{}; r < 32U; ++r) {
+      V x;
+      x.copy_from(in + r * size, element_aligned);
+      word |= x << static_cast<int>(shift);
+      shift += Bits;
+      if (shift >= 32U) {
+        word.copy_to(out, element_aligned);
+        out += size;
+        shift -= 32U;
+        // the upper bits of x which did not fit
+        word = (shift == 0U) ? V{0U} : x >> static_cast<int>(Bits - shift);
+      }
+    }
+  }
+}
+
+// Unpacks a block of pack_block and, if Delta, adds the prefix sums of the rows to carry.
+template <unsigned Bits, bool Delta, typename V>
+void unpack_block(const std::uint32_t *in, std::uint32_t *const out, V &carry) noexcept {
+  constexpr std::size_t size{V::size()};
+  constexpr std::uint32_t mask{(Bits == 32U) ? ~0U : (1U << Bits) - 1U};
+  // a local copy stays in a register, the stores to out may alias carry
+  V sum{carry};
+  V word{0U};
+  if constexpr (Bits != 0U) {
+    word.copy_from(in, element_aligned);
+    in += size;
+  }
+  unsigned shift{};
+  for (std::size_t r{}; r < 32U; ++r) {
+    V x{word >> static_cast<int>(shift)};
+    shift += Bits;
+    if (shift >= 32U) {
+      // the last row ends at a word boundary, i.e., no word past the block is loaded
+      shift -= 32U;
+      if (r != 31U) {
+        word.copy_from(in, element_aligned);
+        in += size;
+      }
+      if (shift != 0U) {
+        x |= word << static_cast<int>(Bits - shift);
+      }
+    }
+    x &= V{mask};
+    if constexpr (Delta) {
+      x = inclusive_scan(x) + sum;
+      sum = last_element(x, std::make_index_sequence<size>{});
+    }
+    x.copy_to(out + r * size, element_aligned);
+  }
+  carry = sum;
+}
+
+template <typename V> using pack_kernel = void (*)(const std::uint32_t *, std::uint32_t *) noexcept;
+template <typename V> using unpack_kernel = void (*)(const std::uint32_t *, std::uint32_t *, V &) noexcept;
+
+// one kernel per bit width such that the shifts of the unrolled rows are constants
+template <typename V, std::size_t... Bits>
+constexpr std::array<pack_kernel<V>, sizeof...(Bits)> pack_kernels(std::index_sequence<Bits...>) noexcept {
+  return {&pack_block<Bits, V>...};
+}
+
+template <bool Delta, typename V, std::size_t... Bits>
+constexpr std::array<unpack_kernel<V>, sizeof...(Bits)> unpack_kernels(std::index_sequence<Bits...>) noexcept {
+  return {&unpack_block<Bits, Delta, V>...};
+}
+
+template <bool Delta, typename Abi>
+const std::uint32_t *bitunpack(const std::uint32_t *in, const std::size_t n, const unsigned bits,
+                               std::uint32_t *out) {
+  using V = simd<std::uint32_t, Abi>;
+  constexpr std::size_t block{bitpack_block_size<Abi>};
+  constexpr auto kernels{unpack_kernels<Delta, V>(std::make_index_sequence<33U>{})};
+  ENSURES(bits <= 32U);
+  const unpack_kernel<V> kernel{kernels[bits]};
+  const std::size_t words{bits * V::size()};
+
+  V carry{0U};
+  std::size_t i{};
+  for (; i + block <= n; i += block, in += words) {
+    kernel(in, out + i, carry);
+  }
+  if (i != n) {
+    std::uint32_t buffer[block];
+    kernel(in, buffer, carry);
+    std::copy(buffer, buffer + (n - i), out + i);
+    in += words;
+  }
+  return in;
+}
+
+// byte i of the shuffle of a control byte is the offset of the byte of the data which goes to byte i of the
+// integers, or 0xFF for the zero upper bytes of short integers
+struct stream_vbyte_table {
+  constexpr stream_vbyte_table() noexcept : shuffle{}, length{} {
+    for (std::size_t c{}; c < 256U; ++c) {
+      std::uint32_t offset{};
+      for (std::size_t k{}; k < 4U; ++k) {
+        const std::uint32_t n{static_cast<std::uint32_t>((c >> (2U * k)) & 3U) + 1U};
+        std::uint32_t word{~0U};
+        for (std::uint32_t b{}; b < n; ++b) {
+          word = (word & ~(0xFFU << (8U * b))) | ((offset + b) << (8U * b));
+        }
+        shuffle[c][k] = word;
+        offset += n;
+      }
+      length[c] = static_cast<std::uint8_t>(offset);
+    }
+  }
+
+  std::array<std::array<std::uint32_t, 4U>, 256U> shuffle;
+  std::array<std::uint8_t, 256U> length;
+};
+
+inline constexpr stream_vbyte_table stream_vbyte_tables{};
+
+template <bool Delta, typename Abi>
+const std::uint8_t *stream_vbyte_decode(const std::uint8_t *const first, const std::uint8_t *const last,
+                                        const std::size_t n, std::uint32_t *out) {
+  using V = simd<std::uint32_t, Abi>;
+  static_assert(V::size() == 4U, "a control byte describes four integers");
+  const std::size_t groups{n / 4U};
+  ENSURES(static_cast<std::size_t>(last - first) >= (n + 3U) / 4U);
+  const std::uint8_t *const control{first};
+  const std::uint8_t *data{first + (n + 3U) / 4U};
+
+  V carry{0U};
+  for (std::size_t g{}; g < groups; ++g, out += 4U) {
+    const std::uint8_t c{control[g]};
+    std::uint32_t bytes[4U]{};
+    if (last - data >= 16) {
+      std::memcpy(bytes, data, sizeof(bytes));
+    } else {
+      // the last integers are copied such that no byte past last is read, corrupt control bytes may skip past last
+      ENSURES(data <= last);
+      std::memcpy(bytes, data, static_cast<std::size_t>(last - data));
+    }
+    V v;
+    V shuffle;
+    v.copy_from(bytes, element_aligned);
+    shuffle.copy_from(stream_vbyte_tables.shuffle[c].data(), element_aligned);
+    V x{permute_bytes(v, shuffle)};
+    if constexpr (Delta) {
+      x = inclusive_scan(x) + carry;
+      carry = last_element(x, std::make_index_sequence<4U>{});
+    }
+    x.copy_to(out, element_aligned);
+    data += stream_vbyte_tables.length[c];
+  }
+
+  std::uint32_t sum{extract<0U>(carry)};
+  for (std::size_t k{}; k < n % 4U; ++k, ++out) {
+    const std::uint32_t length{((control[groups] >> (2U * k)) & 3U) + 1U};
+    ENSURES((data <= last) && (static_cast<std::size_t>(last - data) >= length));
+    std::uint32_t x{};
+    for (std::uint32_t b{}; b < length; ++b) {
+      x |= std::uint32_t{*data++} << (8U * b);
+    }
+    sum = Delta ? sum + x : x;
+    *out = sum;
+  }
+  return data;
+}
+
+// element i is element i - 1 of b, element 0 is the last element of a
+template <typename V, std::size_t... I>
+constexpr V previous_elements(const V &a, const V &b, std::index_sequence<I...>) noexcept {
+  return shuffle<(V::size() - 1U + I)...>(a, b);
+}
+
+} // namespace detail
+
+/// @brief Returns the number of bits of the greatest element of [first, last), i.e., the smallest bit width which
+/// bitpack accepts for the range. The elements are combined by a bitwise or.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+unsigned bitpack_bits(const std::uint32_t *first, const std::uint32_t *const last) noexcept {
+  using V = simd<std::uint32_t, Abi>;
+  V any{0U};
+  for (; static_cast<std::size_t>(last - first) >= V::size(); first += V::size()) {
+    V v;
+    v.copy_from(first, element_aligned);
+    any |= v;
+  }
+  std::uint32_t x{};
+  for (std::size_t i{}; i < V::size(); ++i) {
+    x |= any[i];
+  }
+  for (; first != last; ++first) {
+    x |= *first;
+  }
+  unsigned bits{};
+  for (; x != 0U; x >>= 1U) {
+    ++bits;
+  }
+  return bits;
+}
+
+/// @brief Packs the integers of [first, last) by bits per integer into [out, out + bitpack_words(last - first, bits))
+/// and returns the end of the output.
+///
+/// The integers are packed by blocks of bitpack_block_size: lane j of the 32 rows of simd<std::uint32_t, Abi> of a
+/// block goes to lane j of bits consecutive words, the integers of a lane are in the order of the rows from the least
+/// significant bit. A partial last block is padded with zeros.
+///
+/// @pre bits <= 32 and every element of [first, last) is less than 2^bits
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+std::uint32_t *bitpack(const std::uint32_t *first, const std::uint32_t *const last, const unsigned bits,
+                       std::uint32_t *out) {
+  using V = simd<std::uint32_t, Abi>;
+  constexpr std::size_t block{bitpack_block_size<Abi>};
+  constexpr auto kernels{detail::pack_kernels<V>(std::make_index_sequence<33U>{})};
+  ENSURES(bits <= 32U);
+  const detail::pack_kernel<V> kernel{kernels[bits]};
+  const std::size_t words{bits * V::size()};
+
+  for (; static_cast<std::size_t>(last - first) >= block; first += block, out += words) {
+    kernel(first, out);
+  }
+  if (first != last) {
+    std::uint32_t buffer[block]{};
+    std::copy(first, last, buffer);
+    kernel(buffer, out);
+    out += words;
+  }
+  return out;
+}
+
+/// @brief Unpacks n integers packed by bitpack with bits per integer into [out, out + n) and returns the end of the
+/// packed input.
+///
+/// Every row is shifted and masked in a register, the bit width selects a kernel in which the shifts are constants.
+///
+/// @pre bits <= 32 and [in, in + bitpack_words(n, bits)) is the output of bitpack
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+const std::uint32_t *bitunpack(const std::uint32_t *const in, const std::size_t n, const unsigned bits,
+                               std::uint32_t *const out) {
+  return detail::bitunpack<false, Abi>(in, n, bits, out);
+}
+
+/// @brief Unpacks like bitunpack and writes the inclusive prefix sums of the integers, i.e., decodes the output of
+/// delta_encode packed by bitpack. The unsigned sums wrap around.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+const std::uint32_t *bitunpack_delta(const std::uint32_t *const in, const std::size_t n, const unsigned bits,
+                                     std::uint32_t *const out) {
+  return detail::bitunpack<true, Abi>(in, n, bits, out);
+}
+
+/// @brief The maximal number of bytes of n integers encoded by stream_vbyte_encode.
+constexpr std::size_t stream_vbyte_max_bytes(const std::size_t n) noexcept { return (n + 3U) / 4U + 4U * n; }
+
+/// @brief Encodes the integers of [first, last) by Stream VByte and returns the end of the output.
+///
+/// The output starts with one control byte per four integers, whose bit pairs from the least significant one are the
+/// number of bytes minus one of the integers. The bytes of the integers follow, least significant byte first and
+/// without their zero upper bytes.
+///
+/// @pre [out, out + stream_vbyte_max_bytes(last - first)) is a valid range
+inline std::uint8_t *stream_vbyte_encode(const std::uint32_t *const first, const std::uint32_t *const last,
+                                         std::uint8_t *const out) noexcept {
+  const std::size_t n{static_cast<std::size_t>(last - first)};
+  std::uint8_t *const control{out};
+  std::uint8_t *data{out + (n + 3U) / 4U};
+  std::fill(control, data, std::uint8_t{0U});
+  for (std::size_t i{}; i < n; ++i) {
+    const std::uint32_t x{first[i]};
+    const std::uint32_t length{(x < (1U << 8U)) ? 1U : (x < (1U << 16U)) ? 2U : (x < (1U << 24U)) ? 3U : 4U};
+    control[i / 4U] = static_cast<std::uint8_t>(control[i / 4U] | ((length - 1U) << (2U * (i % 4U))));
+    for (std::uint32_t b{}; b < length; ++b) {
+      *data++ = static_cast<std::uint8_t>(x >> (8U * b));
+    }
+  }
+  return data;
+}
+
+/// @brief Decodes n integers encoded by stream_vbyte_encode from [first, last) into [out, out + n) and returns the end
+/// of the consumed input.
+///
+/// The control byte of four integers selects a table of byte indices, which moves the bytes of the integers into
+/// their elements by a single permute_bytes, i.e., PSHUFB. Sixteen bytes are loaded per four integers, the bytes at
+/// the end of the input are copied such that nothing past last is read.
+///
+/// @pre [first, last) is the output of stream_vbyte_encode for n integers
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+const std::uint8_t *stream_vbyte_decode(const std::uint8_t *const first, const std::uint8_t *const last,
+                                        const std::size_t n, std::uint32_t *const out) {
+  return detail::stream_vbyte_decode<false, Abi>(first, last, n, out);
+}
+
+/// @brief Decodes like stream_vbyte_decode and writes the inclusive prefix sums of the integers, i.e., decodes the
+/// output of delta_encode encoded by stream_vbyte_encode. The unsigned sums wrap around.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+const std::uint8_t *stream_vbyte_decode_delta(const std::uint8_t *const first, const std::uint8_t *const last,
+                                              const std::size_t n, std::uint32_t *const out) {
+  return detail::stream_vbyte_decode<true, Abi>(first, last, n, out);
+}
+
+/// @brief Writes the differences of the consecutive elements of [first, last) to [out, out + (last - first)), the
+/// first element is kept, and returns the end of the output. The unsigned differences wrap around.
+///
+/// The previous elements of a chunk are shuffled from the preceding and the current chunk. simd_inclusive_scan,
+/// bitunpack_delta and stream_vbyte_decode_delta restore the elements.
+///
+/// @pre [out, out + (last - first)) is a valid range which is either equal to or does not overlap [first, last).
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+std::uint32_t *delta_encode(const std::uint32_t *first, const std::uint32_t *const last, std::uint32_t *out) noexcept {
+  using V = simd<std::uint32_t, Abi>;
+  constexpr std::size_t size{V::size()};
+
+  V previous{0U};
+  for (; static_cast<std::size_t>(last - first) >= size; first += size, out += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    (v - detail::previous_elements(previous, v, std::make_index_sequence<size>{})).copy_to(out, element_aligned);
+    previous = v;
+  }
+
+  std::uint32_t p{extract<size - 1U>(previous)};
+  for (; first != last; ++first, ++out) {
+    const std::uint32_t x{*first};
+    *out = x - p;
+    p = x;
+  }
+  return out;
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_COMPRESSION_H
@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_COUNTING_H
+#define SIMD_COUNTING_H
+
+#include "simd.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// the operations of an impl and a mask_impl of an ABI, shuffle, extract<I> and insert<I> are function templates
+#define SIMD_COUNTING_OPERATIONS(X)                                                                                    \
+  X(broadcast)                                                                                                         \
+  X(init)                                                                                                              \
+  X(load)                                                                                                              \
+  X(load_aligned)                                                                                                      \
+  X(store)                                                                                                             \
+  X(store_aligned)                                                                                                     \
+  X(load_float16)                                                                                                      \
+  X(store_float16)                                                                                                     \
+  X(load_bfloat16)                                                                                                     \
+  X(store_bfloat16)                                                                                                    \
+  X(extract)                                                                                                           \
+  X(insert)                                                                                                            \
+  X(permute)                                                                                                           \
+  X(gather)                                                                                                            \
+  X(permute_bytes)                                                                                                     \
+  X(madd_bytes)                                                                                                        \
+  X(madd_halves)                                                                                                       \
+  X(convert_to_int32)                                                                                                  \
+  X(convert_to_float)                                                                                                  \
+  X(add)                                                                                                               \
+  X(subtract)                                                                                                          \
+  X(multiply)                                                                                                          \
+  X(divide)                                                                                                            \
+  X(negate)                                                                                                            \
+  X(bitwise_not)                                                                                                       \
+  X(bitwise_and)                                                                                                       \
+  X(bitwise_or)                                                                                                        \
+  X(bitwise_xor)                                                                                                       \
+  X(shift_left)                                                                                                        \
+  X(shift_right)                                                                                                       \
+  X(mulhi)                                                                                                             \
+  X(fma)                                                                                                               \
+  X(addsub)                                                                                                            \
+  X(sqrt)                                                                                                              \
+  X(equal)                                                                                                             \
+  X(not_equal)                                                                                                         \
+  X(less_than)                                                                                                         \
+  X(less_equal)                                                                                                        \
+  X(greater_than)                                                                                                      \
+  X(greater_equal)                                                                                                     \
+  X(min)                                                                                                               \
+  X(max)                                                                                                               \
+  X(inclusive_scan)                                                                                                    \
+  X(exclusive_scan)                                                                                                    \
+  X(reduce)                                                                                                            \
+  X(hmin)                                                                                                              \
+  X(hmax)                                                                                                              \
+  X(is_any_of)                                                                                                         \
+  X(is_in_ranges)                                                                                                      \
+  X(is_nan)                                                                                                            \
+  X(abs)                                                                                                               \
+  X(copysign)                                                                                                          \
+  X(floor)                                                                                                             \
+  X(ceil)                                                                                                              \
+  X(trunc)                                                                                                             \
+  X(round)                                                                                                             \
+  X(is_inf)                                                                                                            \
+  X(is_finite)                                                                                                         \
+  X(signbit)                                                                                                           \
+  X(blend)
+
+#define SIMD_COUNTING_MASK_OPERATIONS(X)                                                                               \
+  X(broadcast)                                                                                                         \
+  X(init)                                                                                                              \
+  X(extract)                                                                                                           \
+  X(logical_not)                                                                                                       \
+  X(logical_and)                                                                                                       \
+  X(logical_or)                                                                                                        \
+  X(all_of)                                                                                                            \
+  X(any_of)                                                                                                            \
+  X(none_of)                                                                                                           \
+  X(popcount)                                                                                                          \
+  X(find_first_set)
+
+namespace parallelism_v2 {
+
+/// @brief The operations counted by simd_abi::counting, i.e., the operations of the wrapped ABI.
+enum class simd_operation : std::size_t {
+#define SIMD_COUNTING_ENUMERATOR(name) name,
+#define SIMD_COUNTING_MASK_ENUMERATOR(name) mask_##name,
+  SIMD_COUNTING_OPERATIONS(SIMD_COUNTING_ENUMERATOR) shuffle,
+  SIMD_COUNTING_MASK_OPERATIONS(SIMD_COUNTING_MASK_ENUMERATOR) count
+#undef SIMD_COUNTING_MASK_ENUMERATOR
+#undef SIMD_COUNTING_ENUMERATOR
+};
+
+/// @brief The name of the operation, e.g., "add" or "mask_all_of".
+constexpr std::string_view to_string(const simd_operation op) noexcept {
+  constexpr std::array<std::string_view, static_cast<std::size_t>(simd_operation::count)> names{
+#define SIMD_COUNTING_NAME(name) #name,
+#define SIMD_COUNTING_MASK_NAME(name) "mask_" #name,
+      SIMD_COUNTING_OPERATIONS(SIMD_COUNTING_NAME) "shuffle", SIMD_COUNTING_MASK_OPERATIONS(SIMD_COUNTING_MASK_NAME)
+#undef SIMD_COUNTING_MASK_NAME
+#undef SIMD_COUNTING_NAME
+  };
+  return names[static_cast<std::size_t>(op)];
+}
+
+/// @brief The number of executions of each operation.
+class simd_operation_counts {
+public:
+  /// @brief The number of executions of op.
+  constexpr std::uint64_t operator[](const simd_operation op) const noexcept {
+    return counts_[static_cast<std::size_t>(op)];
+  }
+
+  /// @brief The number of executions of op.
+  constexpr std::uint64_t &operator[](const simd_operation op) noexcept {
+    return counts_[static_cast<std::size_t>(op)];
+  }
+
+  /// @brief The number of executions of all operations.
+  constexpr std::uint64_t total() const noexcept {
+    std::uint64_t r{};
+    for (const std::uint64_t c : counts_) {
+      r += c;
+    }
+    return r;
+  }
+
+  /// @brief The executions since the earlier counts b.
+  friend constexpr simd_operation_counts operator-(const simd_operation_counts &a,
+                                                   const simd_operation_counts &b) noexcept {
+    simd_operation_counts r;
+    for (std::size_t i{}; i < r.counts_.size(); ++i) {
+      r.counts_[i] = a.counts_[i] - b.counts_[i];
+    }
+    return r;
+  }
+
+  /// @brief Writes the non-zero counts in the order of simd_operation, e.g., "load=2 add=1 store=1".
+  friend std::ostream &operator<<(std::ostream &os, const simd_operation_counts &c) {
+    const char *separator{""};
+    for (std::size_t i{}; i < c.counts_.size(); ++i) {
+      if (c.counts_[i] != 0U) {
+        os << separator << to_string(static_cast<simd_operation>(i)) << '=' << c.counts_[i];
+        separator = " ";
+      }
+    }
+    return os;
+  }
+
+private:
+  std::array<std::uint64_t, static_cast<std::size_t>(simd_operation::count)> counts_{};
+};
+
+namespace detail {
+
+inline simd_operation_counts &counting_counters() noexcept {
+  thread_local simd_operation_counts counters{};
+  return counters;
+}
+
+// not counted during constant evaluation
+constexpr void count(const simd_operation op) noexcept {
+  if (!std::is_constant_evaluated()) {
+    ++counting_counters()[op];
+  }
+}
+
+// the arguments are deduced as the storage types, e.g., __m128 whose alignment attributes are irrelevant when forwarded
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+
+template <typename Impl> struct counting_impl {
+#define SIMD_COUNTING_FORWARD(name)                                                                                    \
+  template <typename... Args> static constexpr decltype(auto) name(const Args &...args) noexcept {                     \
+    count(simd_operation::name);                                                                                       \
+    return Impl::name(args...);                                                                                        \
+  }
+  SIMD_COUNTING_OPERATIONS(SIMD_COUNTING_FORWARD)
+#undef SIMD_COUNTING_FORWARD
+
+  template <std::size_t I, typename V> static constexpr decltype(auto) extract(const V &v) noexcept {
+    count(simd_operation::extract);
+    return Impl::template extract<I>(v);
+  }
+
+  template <std::size_t I, typename V, typename U>
+  static constexpr decltype(auto) insert(const V &v, const U &x) noexcept {
+    count(simd_operation::insert);
+    return Impl::template insert<I>(v, x);
+  }
+
+  template <std::size_t... I, typename V> static constexpr decltype(auto) shuffle(const V &a, const V &b) noexcept {
+    count(simd_operation::shuffle);
+    return Impl::template shuffle<I...>(a, b);
+  }
+};
+
+template <typename Impl> struct counting_mask_impl {
+#define SIMD_COUNTING_FORWARD(name)                                                                                    \
+  template <typename... Args> static constexpr decltype(auto) name(const Args &...args) noexcept {                     \
+    count(simd_operation::mask_##name);                                                                                \
+    return Impl::name(args...);                                                                                        \
+  }
+  SIMD_COUNTING_MASK_OPERATIONS(SIMD_COUNTING_FORWARD)
+#undef SIMD_COUNTING_FORWARD
+};
+
+#pragma GCC diagnostic pop
+
+/// @brief ABI which forwards every operation to Abi and counts it per thread.
+template <typename Abi> struct counting {
+  static_assert(is_abi_tag_v<Abi>, "not an abi tag");
+
+  template <typename T> using storage_type = typename Abi::template storage_type<T>;
+  template <typename T> using mask_storage_type = typename Abi::template mask_storage_type<T>;
+  template <typename T> static constexpr std::size_t simd_size{Abi::template simd_size<T>};
+  template <typename T> using impl = counting_impl<typename Abi::template impl<T>>;
+  template <typename T> using mask_impl = counting_mask_impl<typename Abi::template mask_impl<T>>;
+};
+
+} // namespace detail
+
+namespace simd_abi {
+/// @brief Instrumentation of Abi, e.g., simd<float, simd_abi::counting<simd_abi::compatible<float>>>.
+///
+/// Executes the same instructions as Abi and additionally counts each operation in thread local counters. Drops into
+/// existing code by changing only the ABI template argument and reveals, e.g., element accesses by extract or
+/// unnecessary blends.
+template <typename Abi> using counting = detail::counting<Abi>;
+} // namespace simd_abi
+
+template <typename Abi> struct is_abi_tag<detail::counting<Abi>> : is_abi_tag<Abi> {};
+template <typename T, typename Abi> struct is_simd<simd<T, detail::counting<Abi>>> : is_simd<simd<T, Abi>> {};
+template <typename T, typename Abi>
+struct is_simd_mask<simd_mask<T, detail::counting<Abi>>> : is_simd_mask<simd_mask<T, Abi>> {};
+
+/// @brief The operations executed by the calling thread so far.
+inline simd_operation_counts simd_operation_counters() noexcept { return detail::counting_counters(); }
+
+/// @brief Counts the operations executed by the calling thread during its lifetime and writes them on destruction.
+///
+/// Scopes may be nested, each one writes "name: " followed by the counts, e.g., "saxpy: load=2 fma=1 store=1".
+class counting_scope {
+public:
+  /// @brief Starts counting.
+  explicit counting_scope(std::string name, std::ostream &os = std::clog)
+      : name_{std::move(name)}, os_{os}, start_{simd_operation_counters()} {}
+
+  counting_scope(const counting_scope &) = delete;
+  counting_scope &operator=(const counting_scope &) = delete;
+
+  /// @brief Writes the counts.
+  ~counting_scope() { os_ << name_ << ": " << counts() << '\n'; }
+
+  /// @brief The operations executed since the start of the scope.
+  simd_operation_counts counts() const noexcept { return simd_operation_counters() - start_; }
+
+private:
+  std::string name_;
+  std::ostream &os_;
+  simd_operation_counts start_;
+};
+
+} // namespace parallelism_v2
+
+#undef SIMD_COUNTING_MASK_OPERATIONS
+#undef SIMD_COUNTING_OPERATIONS
+
+#endif // SIMD_COUNTING_H
@@ -0,0 +1,433 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_FFT_H
+#define SIMD_FFT_H
+
+#include "simd_complex.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// A pass of the Stockham FFT: the subsequences of length n, whose elements are s apart, are split into 4 (or 2)
+// subsequences of length n / 4 (or n / 2), whose elements are 4 * s (or 2 * s) apart. Element q + s * p of the
+// subsequences, p < n / 4, is the input of the butterfly whose outputs are elements q + s * (4 * p + k), i.e., the
+// output is in natural order after the last pass and no bit reversal is needed.
+struct fft_pass {
+  std::size_t n;
+  std::size_t s;
+  // the twiddles W^p, W^2p and W^3p of W = exp(-2 pi i / n) for p < n / 4, one after another
+  std::size_t twiddles;
+  // the twiddles of the elements j, j + 1, ... of the passes which are vectorized over p, i.e., s < size()
+  std::size_t lanes;
+};
+
+template <typename C> C multiply_by_i(const C &v) noexcept { return C{-v.imag(), v.real()}; }
+
+// the radix-4 butterfly without twiddles, the outputs k = 1, 2, 3 are multiplied by W^kp
+template <typename C>
+void fft_butterfly(const C &a, const C &b, const C &c, const C &d, C &y0, C &y1, C &y2, C &y3) noexcept {
+  const C apc{a + c};
+  const C amc{a - c};
+  const C bpd{b + d};
+  const C jbmd{multiply_by_i(b - d)};
+  y0 = apc + bpd;
+  y1 = amc - jbmd;
+  y2 = apc - bpd;
+  y3 = amc + jbmd;
+}
+
+constexpr std::size_t fft_zip_index(const std::size_t g, const std::size_t block, const std::size_t size) noexcept {
+  return (g / (2U * block)) * block + g % block + ((g % (2U * block) >= block) ? size : 0U);
+}
+
+// the elements [Offset, Offset + size()) of the interleaving of the blocks of Block elements of a and b
+template <std::size_t Block, std::size_t Offset, typename V, std::size_t... I>
+V fft_zip(const V &a, const V &b, std::index_sequence<I...>) noexcept {
+  return shuffle<fft_zip_index(Offset + I, Block, V::size())...>(a, b);
+}
+
+// Stores the outputs of the butterflies of the elements j, ..., j + size() - 1 of a pass with s = Block < size(),
+// which are the interleaving of the blocks of Block elements of y0, y1, y2 and y3 at 4 * j.
+template <std::size_t Block, typename V>
+void fft_store_interleaved(const V (&y)[4], float *const out) noexcept {
+  constexpr std::size_t size{V::size()};
+  const auto index = std::make_index_sequence<size>{};
+  const V z0{fft_zip<Block, 0U>(y[0], y[2], index)};
+  const V z1{fft_zip<Block, size>(y[0], y[2], index)};
+  const V z2{fft_zip<Block, 0U>(y[1], y[3], index)};
+  const V z3{fft_zip<Block, size>(y[1], y[3], index)};
+  fft_zip<Block, 0U>(z0, z2, index).copy_to(out, element_aligned);
+  fft_zip<Block, size>(z0, z2, index).copy_to(out + size, element_aligned);
+  fft_zip<Block, 0U>(z1, z3, index).copy_to(out + 2U * size, element_aligned);
+  fft_zip<Block, size>(z1, z3, index).copy_to(out + 3U * size, element_aligned);
+}
+
+template <std::size_t Block, typename V>
+void fft_store_interleaved(const std::size_t s, const V (&re)[4], const V (&im)[4], float *const yr,
+                           float *const yi) noexcept {
+  if constexpr (Block < V::size()) {
+    if (s != Block) {
+      fft_store_interleaved<4U * Block>(s, re, im, yr, yi);
+      return;
+    }
+    fft_store_interleaved<Block>(re, yr);
+    fft_store_interleaved<Block>(im, yi);
+  }
+}
+
+// A radix-4 pass of a single transform of size n over split arrays. The butterflies of the consecutive elements
+// j = q + s * p, which are n / 4 apart in each of the four inputs, are computed at once. Passes with s >= size() share
+// p in a chunk, i.e., broadcast its twiddles, and store each output to a contiguous chunk. The other passes load the
+// twiddles of every element and interleave the outputs.
+template <typename Abi>
+void fft_radix4(const fft_pass &pass, const std::size_t n, const std::complex<float> *const twiddles,
+                const complex_simd<float, Abi> *lanes, const float *const xr, const float *const xi, float *const yr,
+                float *const yi) noexcept {
+  using C = complex_simd<float, Abi>;
+  using V = simd<float, Abi>;
+  constexpr std::size_t size{V::size()};
+  const std::size_t quarter{n / 4U};
+  const std::size_t s{pass.s};
+  for (std::size_t j{}; j < quarter; j += size) {
+    C a;
+    C b;
+    C c;
+    C d;
+    a.copy_from(xr + j, xi + j, element_aligned);
+    b.copy_from(xr + j + quarter, xi + j + quarter, element_aligned);
+    c.copy_from(xr + j + 2U * quarter, xi + j + 2U * quarter, element_aligned);
+    d.copy_from(xr + j + 3U * quarter, xi + j + 3U * quarter, element_aligned);
+    C y[4];
+    fft_butterfly(a, b, c, d, y[0], y[1], y[2], y[3]);
+    if (s >= size) {
+      const std::size_t p{j / s};
+      const std::size_t q{j % s};
+      if (p != 0U) {
+        y[1] *= C{twiddles[3U * p]};
+        y[2] *= C{twiddles[3U * p + 1U]};
+        y[3] *= C{twiddles[3U * p + 2U]};
+      }
+      for (std::size_t k{}; k < 4U; ++k) {
+        y[k].copy_to(yr + q + s * (4U * p + k), yi + q + s * (4U * p + k), element_aligned);
+      }
+    } else {
+      y[1] *= lanes[0];
+      y[2] *= lanes[1];
+      y[3] *= lanes[2];
+      lanes += 3;
+      const V re[4]{y[0].real(), y[1].real(), y[2].real(), y[3].real()};
+      const V im[4]{y[0].imag(), y[1].imag(), y[2].imag(), y[3].imag()};
+      fft_store_interleaved<1U>(s, re, im, yr + 4U * j, yi + 4U * j);
+    }
+  }
+}
+
+// the last pass if n is not a power of four, s = n / 2 and all twiddles are 1
+template <typename C>
+void fft_radix2(const std::size_t n, const float *const xr, const float *const xi, float *const yr,
+                float *const yi) noexcept {
+  const std::size_t half{n / 2U};
+  for (std::size_t j{}; j < half; j += C::size()) {
+    C a;
+    C b;
+    a.copy_from(xr + j, xi + j, element_aligned);
+    b.copy_from(xr + j + half, xi + j + half, element_aligned);
+    (a + b).copy_to(yr + j, yi + j, element_aligned);
+    (a - b).copy_to(yr + j + half, yi + j + half, element_aligned);
+  }
+}
+
+// A pass of size() transforms at once, element i of transform l is element l of the chunk i of the split arrays.
+// Every butterfly is computed on whole chunks, i.e., any size is vectorized.
+template <typename Abi>
+void fft_batch_pass(const fft_pass &pass, const std::complex<float> *const twiddles, const float *const xr,
+                    const float *const xi, float *const yr, float *const yi) noexcept {
+  using C = complex_simd<float, Abi>;
+  constexpr std::size_t size{C::size()};
+  const std::size_t s{pass.s};
+  const auto load = [&](const std::size_t i) {
+    C v;
+    v.copy_from(xr + i * size, xi + i * size, element_aligned);
+    return v;
+  };
+  const auto store = [&](const std::size_t i, const C &v) { v.copy_to(yr + i * size, yi + i * size, element_aligned); };
+
+  if (pass.n == 2U) {
+    for (std::size_t q{}; q < s; ++q) {
+      const C a{load(q)};
+      const C b{load(q + s)};
+      store(q, a + b);
+      store(q + s, a - b);
+    }
+    return;
+  }
+  const std::size_t quarter{pass.n / 4U};
+  for (std::size_t p{}; p < quarter; ++p) {
+    const C w1{twiddles[3U * p]};
+    const C w2{twiddles[3U * p + 1U]};
+    const C w3{twiddles[3U * p + 2U]};
+    for (std::size_t q{}; q < s; ++q) {
+      C y0;
+      C y1;
+      C y2;
+      C y3;
+      fft_butterfly(load(q + s * p), load(q + s * (p + quarter)), load(q + s * (p + 2U * quarter)),
+                    load(q + s * (p + 3U * quarter)), y0, y1, y2, y3);
+      store(q + s * 4U * p, y0);
+      store(q + s * (4U * p + 1U), y1 * w1);
+      store(q + s * (4U * p + 2U), y2 * w2);
+      store(q + s * (4U * p + 3U), y3 * w3);
+    }
+  }
+}
+
+inline std::complex<float> fft_twiddle(const std::size_t k, const std::size_t n) {
+  const double angle{-2.0 * 3.14159265358979323846 * static_cast<double>(k) / static_cast<double>(n)};
+  return {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+}
+
+} // namespace detail
+
+/// @brief The complex discrete Fourier transform of a power-of-two size n, i.e., y[k] is the sum of
+/// x[j] * exp(-2 pi i j k / n) for the forward transform and of x[j] * exp(2 pi i j k / n) for the inverse transform,
+/// which is not normalized.
+///
+/// A Stockham FFT of radix-4 passes and, if n is not a power of four, a final radix-2 pass. The passes alternate
+/// between two split arrays of real and imaginary parts, such that the output is in natural order without a
+/// bit-reversal pass. The butterflies operate on complex_simd<float, Abi>: the consecutive butterflies of a pass
+/// are computed at once, the twiddles are tables computed at construction, per element of a chunk for the first
+/// passes. Sizes smaller than 4 * simd<float, Abi>::size() are computed as a batch of one transform.
+///
+/// The batch transforms compute simd<float, Abi>::size() transforms of the same size at once, one per element, i.e.,
+/// small sizes are vectorized as well.
+///
+/// An object holds the work arrays, i.e., it is not shared between threads.
+template <typename Abi = simd_abi::compatible<float>> class simd_fft {
+  using C = complex_simd<float, Abi>;
+  static constexpr std::size_t lanes{C::size()};
+
+public:
+  /// @brief Plans the transforms of size n.
+  ///
+  /// @pre n is a power of two
+  explicit simd_fft(const std::size_t n) : n_{n} {
+    ENSURES((n != 0U) && ((n & (n - 1U)) == 0U));
+    std::size_t s{1U};
+    std::size_t m{n};
+    for (; m >= 4U; m /= 4U, s *= 4U) {
+      passes_.push_back({m, s, twiddles_.size(), lanes_.size()});
+      for (std::size_t p{}; p < m / 4U; ++p) {
+        for (std::size_t k{1U}; k < 4U; ++k) {
+          twiddles_.push_back(detail::fft_twiddle(k * p, m));
+        }
+      }
+      if ((s < lanes) && (n >= 4U * lanes)) {
+        for (std::size_t j{}; j < n / 4U; j += lanes) {
+          for (std::size_t k{1U}; k < 4U; ++k) {
+            float re[lanes];
+            float im[lanes];
+            for (std::size_t l{}; l < lanes; ++l) {
+              const std::complex<float> w{detail::fft_twiddle(k * ((j + l) / s), m)};
+              re[l] = w.real();
+              im[l] = w.imag();
+            }
+            C w;
+            w.copy_from(re, im, element_aligned);
+            lanes_.push_back(w);
+          }
+        }
+      }
+    }
+    if (m == 2U) {
+      passes_.push_back({2U, s, twiddles_.size(), lanes_.size()});
+    }
+    for (std::vector<float> &v : work_) {
+      v.resize(vectorized() ? n : n * lanes);
+    }
+  }
+
+  /// @brief Returns the size of the transforms.
+  std::size_t size() const noexcept { return n_; }
+
+  /// @brief Writes the forward transform of [in, in + size()) to [out, out + size()), in and out may be equal.
+  void forward(const std::complex<float> *const in, std::complex<float> *const out) { transform<false>(in, out, 1U); }
+
+  /// @brief Writes the inverse transform of [in, in + size()) to [out, out + size()), in and out may be equal.
+  void inverse(const std::complex<float> *const in, std::complex<float> *const out) { transform<true>(in, out, 1U); }
+
+  /// @brief Writes the forward transforms of the count sequences of size() elements, one after another, starting at
+  /// in to the count sequences starting at out, in and out may be equal.
+  void forward(const std::complex<float> *const in, std::complex<float> *const out, const std::size_t count) {
+    transform<false>(in, out, count);
+  }
+
+  /// @brief Writes the inverse transforms of count sequences like forward.
+  void inverse(const std::complex<float> *const in, std::complex<float> *const out, const std::size_t count) {
+    transform<true>(in, out, count);
+  }
+
+private:
+  bool vectorized() const noexcept { return n_ >= 4U * lanes; }
+
+  // The conjugate of the forward transform of the conjugate is the inverse transform.
+  template <bool Inverse>
+  void transform(const std::complex<float> *in, std::complex<float> *out, const std::size_t count) {
+    if (vectorized()) {
+      for (std::size_t t{}; t < count; ++t, in += n_, out += n_) {
+        for (std::size_t i{}; i < n_; i += lanes) {
+          C v;
+          v.copy_from(in + i, element_aligned);
+          (Inverse ? conj(v) : v).copy_to(&work_[0][i], &work_[1][i], element_aligned);
+        }
+        const std::size_t r{run()};
+        for (std::size_t i{}; i < n_; i += lanes) {
+          C v;
+          v.copy_from(&work_[r][i], &work_[r + 1U][i], element_aligned);
+          (Inverse ? conj(v) : v).copy_to(out + i, element_aligned);
+        }
+      }
+      return;
+    }
+    for (std::size_t t{}; t < count; t += lanes) {
+      const std::size_t batch{std::min(lanes, count - t)};
+      const float sign{Inverse ? -1.0F : 1.0F};
+      for (std::size_t i{}; i < n_; ++i) {
+        for (std::size_t l{}; l < lanes; ++l) {
+          const std::complex<float> x{(l < batch) ? in[(t + l) * n_ + i] : std::complex<float>{}};
+          work_[0][i * lanes + l] = x.real();
+          work_[1][i * lanes + l] = sign * x.imag();
+        }
+      }
+      const std::size_t r{run_batch()};
+      for (std::size_t i{}; i < n_; ++i) {
+        for (std::size_t l{}; l < batch; ++l) {
+          out[(t + l) * n_ + i] = {work_[r][i * lanes + l], sign * work_[r + 1U][i * lanes + l]};
+        }
+      }
+    }
+  }
+
+  // the passes of a single transform from work_[0], work_[1], returns the index of the real parts of the result
+  std::size_t run() noexcept {
+    std::size_t x{0U};
+    for (const detail::fft_pass &pass : passes_) {
+      const std::size_t y{2U - x};
+      if (pass.n == 2U) {
+        detail::fft_radix2<C>(n_, work_[x].data(), work_[x + 1U].data(), work_[y].data(), work_[y + 1U].data());
+      } else {
+        detail::fft_radix4<Abi>(pass, n_, &twiddles_[pass.twiddles], lanes_.data() + pass.lanes, work_[x].data(),
+                                work_[x + 1U].data(), work_[y].data(), work_[y + 1U].data());
+      }
+      x = y;
+    }
+    return x;
+  }
+
+  std::size_t run_batch() noexcept {
+    std::size_t x{0U};
+    for (const detail::fft_pass &pass : passes_) {
+      const std::size_t y{2U - x};
+      detail::fft_batch_pass<Abi>(pass, twiddles_.data() + pass.twiddles, work_[x].data(), work_[x + 1U].data(),
+                                  work_[y].data(), work_[y + 1U].data());
+      x = y;
+    }
+    return x;
+  }
+
+  std::size_t n_;
+  std::vector<detail::fft_pass> passes_;
+  std::vector<std::complex<float>> twiddles_;
+  std::vector<C> lanes_;
+  // the real and imaginary parts of the two arrays of the passes
+  std::vector<float> work_[4U];
+};
+
+/// @brief The discrete Fourier transform of n real numbers of a power-of-two size n >= 2, i.e., the bins
+/// y[0], ..., y[n / 2] of the complex transform, the other bins are their complex conjugates.
+///
+/// The even and odd elements are the real and imaginary parts of a complex transform of size n / 2 by simd_fft. Its
+/// bins k and n / 2 - k are combined into the bin k, chunk by chunk with the chunk of the bins n / 2 - k reversed.
+template <typename Abi = simd_abi::compatible<float>> class simd_real_fft {
+  using C = complex_simd<float, Abi>;
+  using V = simd<float, Abi>;
+
+public:
+  /// @brief Plans the transforms of size n.
+  ///
+  /// @pre n >= 2 is a power of two
+  explicit simd_real_fft(const std::size_t n) : fft_{std::max(n / 2U, std::size_t{1U})} {
+    ENSURES((n >= 2U) && ((n & (n - 1U)) == 0U));
+    for (std::size_t k{}; k <= n / 2U; ++k) {
+      const std::complex<float> w{detail::fft_twiddle(k, n)};
+      re_.push_back(w.real());
+      im_.push_back(w.imag());
+    }
+  }
+
+  /// @brief Returns the size of the transforms.
+  std::size_t size() const noexcept { return 2U * fft_.size(); }
+
+  /// @brief Writes the bins [0, size() / 2] of the forward transform of [in, in + size()) to
+  /// [out, out + size() / 2 + 1).
+  void forward(const float *const in, std::complex<float> *const out) {
+    const std::size_t m{fft_.size()};
+    // the pairs of real numbers are complex numbers, std::complex<float> has the layout of float[2]
+    std::vector<std::complex<float>> &z{z_};
+    z.assign(reinterpret_cast<const std::complex<float> *>(in), reinterpret_cast<const std::complex<float> *>(in) + m);
+    fft_.forward(z.data(), z.data());
+    zr_.resize(m);
+    zi_.resize(m);
+    for (std::size_t i{}; i < m; ++i) {
+      zr_[i] = z[i].real();
+      zi_[i] = z[i].imag();
+    }
+
+    // X[k] = (Z[k] + conj(Z[m - k])) / 2 - i W^k (Z[k] - conj(Z[m - k])) / 2
+    out[0] = {zr_[0] + zi_[0], 0.0F};
+    out[m] = {zr_[0] - zi_[0], 0.0F};
+    const V half{0.5F};
+    std::size_t k{1U};
+    for (; k + V::size() <= m; k += V::size()) {
+      C a;
+      C b;
+      C w;
+      a.copy_from(&zr_[k], &zi_[k], element_aligned);
+      b.copy_from(&zr_[m - k - (V::size() - 1U)], &zi_[m - k - (V::size() - 1U)], element_aligned);
+      b = C{reverse(b.real(), std::make_index_sequence<V::size()>{}),
+            -reverse(b.imag(), std::make_index_sequence<V::size()>{})};
+      w.copy_from(&re_[k], &im_[k], element_aligned);
+      const C even{a + b};
+      const C odd{detail::multiply_by_i(w * (a - b))};
+      const C sum{even - odd};
+      C{half * sum.real(), half * sum.imag()}.copy_to(out + k, element_aligned);
+    }
+    for (; k < m; ++k) {
+      const std::complex<float> a{zr_[k], zi_[k]};
+      const std::complex<float> b{zr_[m - k], -zi_[m - k]};
+      const std::complex<float> w{re_[k], im_[k]};
+      out[k] = 0.5F * ((a + b) - std::complex<float>{0.0F, 1.0F} * w * (a - b));
+    }
+  }
+
+private:
+  template <std::size_t... I> static V reverse(const V &v, std::index_sequence<I...>) noexcept {
+    return shuffle<(V::size() - 1U - I)...>(v, v);
+  }
+
+  simd_fft<Abi> fft_;
+  std::vector<float> re_;
+  std::vector<float> im_;
+  std::vector<std::complex<float>> z_;
+  std::vector<float> zr_;
+  std::vector<float> zi_;
+};
+
+} // namespace parallelism_v2
+
+#endif // SIMD_FFT_H
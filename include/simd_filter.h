@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_FILTER_H
+#define SIMD_FILTER_H
+
+#include "simd_algorithm.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// The columns of a strip. The filtered rows of a strip, which the vertical pass combines, stay in L1 or L2
+// independent of the width of the image.
+constexpr std::size_t filter_tile{512U};
+
+// the index clamped to [0, n), i.e., the border element is repeated
+constexpr std::size_t clamp_index(const std::ptrdiff_t i, const std::size_t n) noexcept {
+  return static_cast<std::size_t>(std::clamp(i, std::ptrdiff_t{0}, static_cast<std::ptrdiff_t>(n) - 1));
+}
+
+// Elements x, ..., x + size() - 1 of the row of width elements. The chunks which extend past a border are gathered by
+// clamped indices.
+template <typename V> V load_clamped(const float *const row, const std::ptrdiff_t x, const std::size_t width) noexcept {
+  using Abi = typename V::abi_type;
+  if ((x >= 0) && (static_cast<std::size_t>(x) + V::size() <= width)) {
+    V v;
+    v.copy_from(row + x, element_aligned);
+    return v;
+  }
+  const index_simd<Abi> i{lane_indices<Abi>() + index_simd<Abi>{static_cast<std::int32_t>(x)}};
+  return gather(row, min(max(i, index_simd<Abi>{0}), index_simd<Abi>{static_cast<std::int32_t>(width) - 1}));
+}
+
+// stores the first n <= size() elements of v
+template <typename V> void store_first(const V &v, float *const out, const std::size_t n) noexcept {
+  if (n == V::size()) {
+    v.copy_to(out, element_aligned);
+  } else {
+    float buffer[V::size()];
+    v.copy_to(buffer, element_aligned);
+    std::copy(buffer, buffer + n, out);
+  }
+}
+
+// the taps of a kernel broadcast once, the kernel may alias the output as far as the compiler knows
+template <typename V, std::size_t N> std::array<V, N> broadcast_kernel(const std::array<float, N> &kernel) noexcept {
+  std::array<V, N> taps;
+  for (std::size_t j{}; j < N; ++j) {
+    taps[j] = V{kernel[j]};
+  }
+  return taps;
+}
+
+// Writes the elements [first, last) of the row convolved with the taps to out, a broadcast tap and an FMA per tap and
+// chunk. The chunks in the interior are loaded and stored directly, the chunks at the borders are gathered by
+// clamped indices and the last chunk is stored partially.
+template <typename V, std::size_t N>
+void convolve_row(const std::array<V, N> &taps, const float *const row, const std::size_t width,
+                  const std::size_t first, const std::size_t last, float *const out) noexcept {
+  constexpr std::size_t radius{N / 2U};
+  const auto border = [&](const std::size_t x) {
+    V sum{0.0F};
+    for (std::size_t j{}; j < N; ++j) {
+      sum = fma(taps[j], load_clamped<V>(row, static_cast<std::ptrdiff_t>(x + j) - std::ptrdiff_t{radius}, width), sum);
+    }
+    store_first(sum, out + (x - first), std::min(V::size(), last - x));
+  };
+
+  std::size_t x{first};
+  for (; (x < last) && (x < radius); x += V::size()) {
+    border(x);
+  }
+  for (; (x + V::size() <= last) && (x + V::size() + radius <= width); x += V::size()) {
+    V sum{0.0F};
+    for (std::size_t j{}; j < N; ++j) {
+      V v;
+      v.copy_from(row + (x + j - radius), element_aligned);
+      sum = fma(taps[j], v, sum);
+    }
+    sum.copy_to(out + (x - first), element_aligned);
+  }
+  for (; x < last; x += V::size()) {
+    border(x);
+  }
+}
+
+// Writes the elements [first, last) of the sums of the 2 * radius + 1 elements around each element of the row to out.
+// Consecutive sums differ by the element entering and the element leaving the window, i.e., the sums of a chunk are the
+// inclusive prefix sums of these differences plus the last sum of the preceding chunk.
+template <typename V>
+void box_row(const std::size_t radius, const float *const row, const std::size_t width, const std::size_t first,
+             const std::size_t last, float *const out) noexcept {
+  const std::ptrdiff_t r{static_cast<std::ptrdiff_t>(radius)};
+  const std::ptrdiff_t f{static_cast<std::ptrdiff_t>(first)};
+  float previous{};
+  for (std::ptrdiff_t i{f - 1 - r}; i <= f - 1 + r; ++i) {
+    previous += row[clamp_index(i, width)];
+  }
+  V carry{previous};
+  for (std::size_t x{first}; x < last; x += V::size()) {
+    const std::ptrdiff_t i{static_cast<std::ptrdiff_t>(x)};
+    const V sum{inclusive_scan(load_clamped<V>(row, i + r, width) - load_clamped<V>(row, i - r - 1, width)) + carry};
+    store_first(sum, out + (x - first), std::min(V::size(), last - x));
+    carry = V{extract<V::size() - 1U>(sum)};
+  }
+}
+
+} // namespace detail
+
+/// @brief Convolves the rows of the row-major width x height image in with the kernel and writes the result to out,
+/// i.e., out[y][x] is the sum of kernel[j] * in[y][x + j - N / 2]. The kernel is not flipped, the borders are
+/// extended by repeating the border elements.
+///
+/// The loads of the chunks which extend past the left or right border are gathered by clamped indices, the last chunk
+/// of a row is stored partially. in_stride and out_stride are the distances between the rows.
+///
+/// @pre in_stride >= width, out_stride >= width, width < 2^31 and out does not overlap in
+template <std::size_t N, typename Abi = simd_abi::compatible<float>>
+void simd_convolve_rows(const std::array<float, N> &kernel, const std::size_t width, const std::size_t height,
+                        const float *const in, const std::size_t in_stride, float *const out,
+                        const std::size_t out_stride) {
+  static_assert(N % 2U == 1U, "kernel of odd size");
+  ENSURES((in_stride >= width) && (out_stride >= width));
+  ENSURES(width <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+  const auto taps{detail::broadcast_kernel<simd<float, Abi>>(kernel)};
+  for (std::size_t y{}; y < height; ++y) {
+    detail::convolve_row(taps, in + y * in_stride, width, 0U, width, out + y * out_stride);
+  }
+}
+
+/// @brief Convolves the columns of the row-major width x height image in with the kernel and writes the result to
+/// out, i.e., out[y][x] is the sum of kernel[j] * in[y + j - N / 2][x]. The kernel is not flipped, the borders are
+/// extended by repeating the border rows.
+///
+/// The image is processed in strips of columns such that the N rows of a strip which an output row combines stay in
+/// the cache. The last chunk of a row is loaded and stored partially. in_stride and out_stride are the distances
+/// between the rows.
+///
+/// @pre in_stride >= width, out_stride >= width and out does not overlap in
+template <std::size_t N, typename Abi = simd_abi::compatible<float>>
+void simd_convolve_columns(const std::array<float, N> &kernel, const std::size_t width, const std::size_t height,
+                           const float *const in, const std::size_t in_stride, float *const out,
+                           const std::size_t out_stride) {
+  using V = simd<float, Abi>;
+  static_assert(N % 2U == 1U, "kernel of odd size");
+  ENSURES((in_stride >= width) && (out_stride >= width));
+  constexpr std::ptrdiff_t radius{N / 2U};
+  const auto taps{detail::broadcast_kernel<V>(kernel)};
+  for (std::size_t x0{}; x0 < width; x0 += detail::filter_tile) {
+    const std::size_t x1{std::min(width, x0 + detail::filter_tile)};
+    for (std::size_t y{}; y < height; ++y) {
+      std::array<const float *, N> rows;
+      for (std::size_t j{}; j < N; ++j) {
+        rows[j] = in + detail::clamp_index(static_cast<std::ptrdiff_t>(y + j) - radius, height) * in_stride;
+      }
+      for (std::size_t x{x0}; x < x1; x += V::size()) {
+        const std::size_t n{std::min(V::size(), x1 - x)};
+        V sum{0.0F};
+        for (std::size_t j{}; j < N; ++j) {
+          V v;
+          if (n == V::size()) {
+            v.copy_from(rows[j] + x, element_aligned);
+          } else {
+            v = detail::load_partial<V>(rows[j] + x, n, 0.0F);
+          }
+          sum = fma(taps[j], v, sum);
+        }
+        detail::store_first(sum, out + y * out_stride + x, n);
+      }
+    }
+  }
+}
+
+/// @brief Filters the row-major width x height image in by the separable kernel, i.e., convolves its rows with
+/// row_kernel and the columns of the result with column_kernel, and writes the result to out. The borders are
+/// extended as by simd_convolve_rows and simd_convolve_columns.
+///
+/// E.g., the 3 x 3 Sobel operator in x is the row kernel {-1, 0, 1} and the column kernel {1, 2, 1}, a Gaussian blur
+/// is the same sampled Gaussian in both directions.
+///
+/// The image is processed in strips of columns. The rows of a strip are convolved into a ring buffer of M rows, from
+/// which the column kernel is applied as soon as the rows below an output row are available, i.e., the intermediate
+/// image is never written to memory.
+///
+/// @pre in_stride >= width, out_stride >= width, width < 2^31 and out does not overlap in
+template <std::size_t N, std::size_t M, typename Abi = simd_abi::compatible<float>>
+void simd_separable_filter(const std::array<float, N> &row_kernel, const std::array<float, M> &column_kernel,
+                           const std::size_t width, const std::size_t height, const float *const in,
+                           const std::size_t in_stride, float *const out, const std::size_t out_stride) {
+  using V = simd<float, Abi>;
+  static_assert((N % 2U == 1U) && (M % 2U == 1U), "kernels of odd size");
+  static_assert(detail::filter_tile % V::size() == 0U, "strips of whole chunks");
+  ENSURES((in_stride >= width) && (out_stride >= width));
+  ENSURES(width <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+  constexpr std::size_t tile{detail::filter_tile};
+  constexpr std::ptrdiff_t radius{M / 2U};
+  // row i of the image is filtered into slot i % M, the M rows around an output row are distinct slots
+  std::vector<float> ring(M * tile, 0.0F);
+  const auto row_taps{detail::broadcast_kernel<V>(row_kernel)};
+  const auto column_taps{detail::broadcast_kernel<V>(column_kernel)};
+
+  for (std::size_t x0{}; x0 < width; x0 += tile) {
+    const std::size_t n{std::min(tile, width - x0)};
+    std::size_t next{};
+    for (std::size_t y{}; y < height; ++y) {
+      for (; next <= std::min(height - 1U, y + M / 2U); ++next) {
+        detail::convolve_row(row_taps, in + next * in_stride, width, x0, x0 + n, &ring[(next % M) * tile]);
+      }
+      std::array<const float *, M> rows;
+      for (std::size_t j{}; j < M; ++j) {
+        rows[j] = &ring[detail::clamp_index(static_cast<std::ptrdiff_t>(y + j) - radius, height) % M * tile];
+      }
+      for (std::size_t x{}; x < n; x += V::size()) {
+        V sum{0.0F};
+        for (std::size_t j{}; j < M; ++j) {
+          V v;
+          v.copy_from(rows[j] + x, element_aligned);
+          sum = fma(column_taps[j], v, sum);
+        }
+        detail::store_first(sum, out + y * out_stride + x0 + x, std::min(V::size(), n - x));
+      }
+    }
+  }
+}
+
+/// @brief Writes the means of the (2 * radius + 1) x (2 * radius + 1) boxes around each element of the row-major
+/// width x height image in to out. The borders are extended as by simd_separable_filter.
+///
+/// The cost does not depend on the radius: the sums along a row are running sums, i.e., prefix sums of the elements
+/// entering and leaving the box by inclusive_scan, and the sums along the columns are updated by the rows entering
+/// and leaving the box chunk by chunk. The image is processed in strips as by simd_separable_filter. Like any running
+/// sum, the rounding errors accumulate along the rows and columns.
+///
+/// @pre in_stride >= width, out_stride >= width, width < 2^31 and out does not overlap in
+template <typename Abi = simd_abi::compatible<float>>
+void simd_box_filter(const std::size_t radius, const std::size_t width, const std::size_t height,
+                     const float *const in, const std::size_t in_stride, float *const out,
+                     const std::size_t out_stride) {
+  using V = simd<float, Abi>;
+  static_assert(detail::filter_tile % V::size() == 0U, "strips of whole chunks");
+  ENSURES((in_stride >= width) && (out_stride >= width));
+  ENSURES(width <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()));
+  // the sums of the first row read the border rows, which an empty image does not have
+  if ((width == 0U) || (height == 0U)) {
+    return;
+  }
+  constexpr std::size_t tile{detail::filter_tile};
+  const std::ptrdiff_t r{static_cast<std::ptrdiff_t>(radius)};
+  const V scale{1.0F / static_cast<float>((2U * radius + 1U) * (2U * radius + 1U))};
+  // the rows entering and leaving the box are 2 * radius + 1 rows apart
+  const std::size_t slots{2U * radius + 2U};
+  std::vector<float> ring(slots * tile, 0.0F);
+  std::vector<float> sums(tile, 0.0F);
+
+  for (std::size_t x0{}; x0 < width; x0 += tile) {
+    const std::size_t n{std::min(tile, width - x0)};
+    std::size_t next{};
+    const auto row = [&](const std::ptrdiff_t i) {
+      const std::size_t k{detail::clamp_index(i, height)};
+      for (; next <= k; ++next) {
+        detail::box_row<V>(radius, in + next * in_stride, width, x0, x0 + n, &ring[(next % slots) * tile]);
+      }
+      return &ring[k % slots * tile];
+    };
+
+    std::fill(sums.begin(), sums.end(), 0.0F);
+    for (std::ptrdiff_t i{-r}; i <= r; ++i) {
+      const float *const h{row(i)};
+      for (std::size_t x{}; x < n; x += V::size()) {
+        V s;
+        V v;
+        s.copy_from(&sums[x], element_aligned);
+        v.copy_from(h + x, element_aligned);
+        (s + v).copy_to(&sums[x], element_aligned);
+      }
+    }
+
+    for (std::size_t y{}; y < height; ++y) {
+      const std::ptrdiff_t i{static_cast<std::ptrdiff_t>(y)};
+      const float *const entering{(y == 0U) ? nullptr : row(i + r)};
+      const float *const leaving{(y == 0U) ? nullptr : row(i - r - 1)};
+      for (std::size_t x{}; x < n; x += V::size()) {
+        V s;
+        s.copy_from(&sums[x], element_aligned);
+        if (y != 0U) {
+          V a;
+          V b;
+          a.copy_from(entering + x, element_aligned);
+          b.copy_from(leaving + x, element_aligned);
+          s += a - b;
+          s.copy_to(&sums[x], element_aligned);
+        }
+        detail::store_first(s * scale, out + y * out_stride + x0 + x, std::min(V::size(), n - x));
+      }
+    }
+  }
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_FILTER_H
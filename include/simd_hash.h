@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_HASH_H
+#define SIMD_HASH_H
+
+#include "simd.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace parallelism_v2 {
+
+/// @brief Returns the hash of key by the multiply-xorshift finalizer of MurmurHash3.
+///
+/// Every bit of the key affects every bit of the hash. The hash is a bijection, i.e., distinct keys never collide.
+constexpr std::uint32_t hash_mix(std::uint32_t key) noexcept {
+  key ^= key >> 16;
+  key *= 0x85EBCA6BU;
+  key ^= key >> 13;
+  key *= 0xC2B2AE35U;
+  key ^= key >> 16;
+  return key;
+}
+
+/// @brief Returns the hash_mix of all elements of keys.
+///
+/// The same multiplications, shifts and xors as for a single key but on all elements at once, i.e., PMULLD, PSRLD
+/// and PXOR with SSE4.2.
+template <typename Abi> constexpr simd<std::uint32_t, Abi> hash_mix(simd<std::uint32_t, Abi> keys) {
+  using V = simd<std::uint32_t, Abi>;
+  keys ^= keys >> 16;
+  keys *= V{0x85EBCA6BU};
+  keys ^= keys >> 13;
+  keys *= V{0xC2B2AE35U};
+  keys ^= keys >> 16;
+  return keys;
+}
+
+/// @brief Writes the hash_mix of each key in [first, last) to [out, out + (last - first)) and returns the end of the
+/// output range.
+///
+/// @pre [out, out + (last - first)) is a valid range which is either equal to or does not overlap [first, last).
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+std::uint32_t *simd_hash(const std::uint32_t *first, const std::uint32_t *const last, std::uint32_t *out) {
+  using V = simd<std::uint32_t, Abi>;
+  constexpr std::size_t size{V::size()};
+
+  for (; static_cast<std::size_t>(last - first) >= size; first += size, out += size) {
+    V v;
+    v.copy_from(first, element_aligned);
+    hash_mix(v).copy_to(out, element_aligned);
+  }
+  for (; first != last; ++first, ++out) {
+    *out = hash_mix(*first);
+  }
+  return out;
+}
+
+namespace detail {
+
+// CRC32C (Castagnoli) polynomial in bit-reflected order, i.e., x^0 is the most significant bit
+constexpr std::uint32_t crc32c_polynomial{0x82F63B78U};
+
+// a * b modulo the CRC32C polynomial
+constexpr std::uint32_t crc32c_multiply(const std::uint32_t a, std::uint32_t b) noexcept {
+  std::uint32_t r{};
+  for (std::uint32_t m{1U << 31}; m != 0U; m >>= 1) {
+    r ^= ((a & m) != 0U) ? b : 0U;
+    b = ((b & 1U) != 0U) ? (b >> 1) ^ crc32c_polynomial : b >> 1;
+  }
+  return r;
+}
+
+// x^(8 * n) modulo the CRC32C polynomial by square and multiply
+constexpr std::uint32_t crc32c_x8n(std::size_t n) noexcept {
+  std::uint32_t r{1U << 31};
+  std::uint32_t p{1U << 23};
+  for (; n != 0U; n >>= 1) {
+    r = ((n & 1U) != 0U) ? crc32c_multiply(r, p) : r;
+    p = crc32c_multiply(p, p);
+  }
+  return r;
+}
+
+// Advances a CRC register over Length zero bytes, i.e., multiplies it by x^(8 * Length). The multiplication is linear
+// in the register, hence it is a lookup and xor per byte of the register.
+template <std::size_t Length> struct crc32c_shift {
+  constexpr crc32c_shift() noexcept {
+    const std::uint32_t x{crc32c_x8n(Length)};
+    for (std::size_t k{}; k < 4U; ++k) {
+      for (std::uint32_t b{}; b < 256U; ++b) {
+        table[k][b] = crc32c_multiply(b << (8U * k), x);
+      }
+    }
+  }
+
+  constexpr std::uint32_t operator()(const std::uint32_t crc) const noexcept {
+    return table[0][crc & 0xFFU] ^ table[1][(crc >> 8) & 0xFFU] ^ table[2][(crc >> 16) & 0xFFU] ^ table[3][crc >> 24];
+  }
+
+  std::uint32_t table[4][256]{};
+};
+
+template <std::size_t Length> inline constexpr crc32c_shift<Length> crc32c_zeros{};
+
+#if defined(__SSE4_2__) && defined(__x86_64__)
+inline std::uint32_t crc32c_u8(const std::uint32_t crc, const std::uint8_t v) noexcept { return _mm_crc32_u8(crc, v); }
+inline std::uint32_t crc32c_u64(const std::uint32_t crc, const std::uint64_t v) noexcept {
+  return static_cast<std::uint32_t>(_mm_crc32_u64(crc, v));
+}
+#else
+inline std::uint32_t crc32c_u8(std::uint32_t crc, const std::uint8_t v) noexcept {
+  crc ^= v;
+  for (int i{}; i < 8; ++i) {
+    crc = ((crc & 1U) != 0U) ? (crc >> 1) ^ crc32c_polynomial : crc >> 1;
+  }
+  return crc;
+}
+inline std::uint32_t crc32c_u64(std::uint32_t crc, const std::uint64_t v) noexcept {
+  for (int i{}; i < 64; i += 8) {
+    crc = crc32c_u8(crc, static_cast<std::uint8_t>(v >> i));
+  }
+  return crc;
+}
+#endif
+
+inline std::uint64_t load_u64(const char *const p) noexcept {
+  std::uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// The CRC32 instruction has a latency of three cycles but a throughput of one per cycle. Three independent streams
+// over consecutive blocks of Length bytes keep it busy, their registers are combined by advancing the first two over
+// the bytes of the following blocks.
+template <std::size_t Length>
+const char *crc32c_streams(std::uint32_t &crc, const char *first, const char *const last) noexcept {
+  static_assert(Length % 8U == 0U, "blocks of whole words");
+  for (; static_cast<std::size_t>(last - first) >= 3U * Length; first += 3U * Length) {
+    std::uint32_t c0{crc};
+    std::uint32_t c1{};
+    std::uint32_t c2{};
+    for (std::size_t i{}; i < Length; i += 8U) {
+      c0 = crc32c_u64(c0, load_u64(first + i));
+      c1 = crc32c_u64(c1, load_u64(first + Length + i));
+      c2 = crc32c_u64(c2, load_u64(first + 2U * Length + i));
+    }
+    crc = crc32c_zeros<Length>(crc32c_zeros<Length>(c0) ^ c1) ^ c2;
+  }
+  return first;
+}
+
+} // namespace detail
+
+/// @brief Returns the CRC32C (Castagnoli) checksum of the bytes in [first, last), continuing from the checksum crc of
+/// the preceding bytes.
+///
+/// Uses the SSE4.2 CRC32 instruction on eight bytes at a time. Large ranges are split into three interleaved streams
+/// to hide the latency of the instruction, first with blocks of 8 KiB and then of 256 bytes. The rest is processed in
+/// a single stream. Falls back to a bitwise computation if SSE4.2 is not enabled.
+inline std::uint32_t simd_crc32c(const char *first, const char *const last, const std::uint32_t crc = 0U) noexcept {
+  std::uint32_t c{~crc};
+  first = detail::crc32c_streams<8192U>(c, first, last);
+  first = detail::crc32c_streams<256U>(c, first, last);
+  for (; static_cast<std::size_t>(last - first) >= 8U; first += 8) {
+    c = detail::crc32c_u64(c, detail::load_u64(first));
+  }
+  for (; first != last; ++first) {
+    c = detail::crc32c_u8(c, static_cast<std::uint8_t>(*first));
+  }
+  return ~c;
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_HASH_H
@@ -0,0 +1,280 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_KNN_H
+#define SIMD_KNN_H
+
+#include "simd.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace parallelism_v2 {
+
+/// @brief The distance of k-nearest-neighbor search, a smaller distance is a nearer neighbor.
+///
+/// - squared_l2: the squared Euclidean distance.
+/// - inner_product: the negated dot product, i.e., the neighbors of maximal inner product.
+/// - cosine: one minus the cosine similarity, which is 1 if either vector is zero.
+enum class knn_metric { squared_l2, inner_product, cosine };
+
+/// @brief A neighbor found by knn_search, i.e., the index of the database vector and its distance to the query.
+struct knn_neighbor {
+  std::size_t index;
+  float distance;
+};
+
+namespace detail {
+
+// The number of database vectors whose distances are accumulated at once. Every step loads one chunk of the query
+// and one chunk of each vector, i.e., the query chunk is reused from a register and the independent accumulators hide
+// the latency of the FMA.
+constexpr std::size_t knn_rows{4U};
+
+// the distances are computed and selected by blocks of this many vectors, which stay in L1
+constexpr std::size_t knn_block{256U};
+
+template <typename V> V knn_load(const float *const p) noexcept {
+  V v;
+  v.copy_from(p, element_aligned);
+  return v;
+}
+
+template <typename V> V knn_load(const std::uint16_t *const p) noexcept {
+  V v;
+  v.copy_from(p, float16);
+  return v;
+}
+
+// The query padded by zeros to whole chunks, which add nothing to any of the sums, and its squared norm.
+template <typename V> struct knn_query {
+  knn_query(const float *const query, const std::size_t dim) : elements(query, query + dim) {
+    elements.resize((dim + V::size() - 1U) / V::size() * V::size(), 0.0F);
+    V n{0.0F};
+    for (std::size_t j{}; j < elements.size(); j += V::size()) {
+      const V q{knn_load<V>(&elements[j])};
+      n = fma(q, q, n);
+    }
+    norm = reduce(n);
+  }
+
+  std::vector<float> elements;
+  float norm;
+};
+
+// Distances of the Rows vectors starting at rows, which are dim elements apart, to the query.
+template <std::size_t Rows, knn_metric Metric, typename V, typename S>
+void knn_kernel(const knn_query<V> &query, const S *const rows, const std::size_t dim, float *const out) noexcept {
+  constexpr std::size_t size{V::size()};
+  std::array<V, Rows> sum;
+  std::array<V, Rows> norm;
+  sum.fill(V{0.0F});
+  norm.fill(V{0.0F});
+  const auto step = [&](const V &q, const std::size_t r, const V &x) {
+    if constexpr (Metric == knn_metric::squared_l2) {
+      const V d{x - q};
+      sum[r] = fma(d, d, sum[r]);
+    } else {
+      sum[r] = fma(x, q, sum[r]);
+      if constexpr (Metric == knn_metric::cosine) {
+        norm[r] = fma(x, x, norm[r]);
+      }
+    }
+  };
+
+  std::size_t j{};
+  for (; j + size <= dim; j += size) {
+    const V q{knn_load<V>(&query.elements[j])};
+    for (std::size_t r{}; r < Rows; ++r) {
+      step(q, r, knn_load<V>(rows + r * dim + j));
+    }
+  }
+  if (j != dim) {
+    const V q{knn_load<V>(&query.elements[j])};
+    for (std::size_t r{}; r < Rows; ++r) {
+      S tail[size]{};
+      std::copy(rows + r * dim + j, rows + (r + 1U) * dim, tail);
+      step(q, r, knn_load<V>(tail));
+    }
+  }
+
+  for (std::size_t r{}; r < Rows; ++r) {
+    if constexpr (Metric == knn_metric::squared_l2) {
+      out[r] = reduce(sum[r]);
+    } else if constexpr (Metric == knn_metric::inner_product) {
+      out[r] = -reduce(sum[r]);
+    } else {
+      const float n{query.norm * reduce(norm[r])};
+      out[r] = (n > 0.0F) ? 1.0F - reduce(sum[r]) / std::sqrt(n) : 1.0F;
+    }
+  }
+}
+
+template <knn_metric Metric, typename V, typename S>
+void knn_scan(const knn_query<V> &query, const S *rows, const std::size_t count, const std::size_t dim,
+              float *out) noexcept {
+  std::size_t i{};
+  for (; i + knn_rows <= count; i += knn_rows, rows += knn_rows * dim, out += knn_rows) {
+    knn_kernel<knn_rows, Metric>(query, rows, dim, out);
+  }
+  for (; i < count; ++i, rows += dim, ++out) {
+    knn_kernel<1U, Metric>(query, rows, dim, out);
+  }
+}
+
+template <typename V, typename S>
+void knn_scan(const knn_metric metric, const knn_query<V> &query, const S *const rows, const std::size_t count,
+              const std::size_t dim, float *const out) noexcept {
+  switch (metric) {
+  case knn_metric::squared_l2:
+    knn_scan<knn_metric::squared_l2>(query, rows, count, dim, out);
+    break;
+  case knn_metric::inner_product:
+    knn_scan<knn_metric::inner_product>(query, rows, count, dim, out);
+    break;
+  case knn_metric::cosine:
+    knn_scan<knn_metric::cosine>(query, rows, count, dim, out);
+    break;
+  }
+}
+
+// nearer first, ties by the smaller index such that the result does not depend on the order of the scan
+constexpr bool knn_nearer(const knn_neighbor &a, const knn_neighbor &b) noexcept {
+  return (a.distance < b.distance) || ((a.distance == b.distance) && (a.index < b.index));
+}
+
+// The k nearest neighbors seen so far in a max-heap, whose top is the distance a candidate has to beat.
+class knn_selection {
+public:
+  explicit knn_selection(const std::size_t k) : k_{k} { heap_.reserve(k); }
+
+  float threshold() const noexcept {
+    return (heap_.size() < k_) ? std::numeric_limits<float>::infinity() : heap_.front().distance;
+  }
+
+  void push(const knn_neighbor &n) {
+    if (heap_.size() < k_) {
+      heap_.push_back(n);
+      std::push_heap(heap_.begin(), heap_.end(), knn_nearer);
+    } else if (knn_nearer(n, heap_.front())) {
+      std::pop_heap(heap_.begin(), heap_.end(), knn_nearer);
+      heap_.back() = n;
+      std::push_heap(heap_.begin(), heap_.end(), knn_nearer);
+    }
+  }
+
+  // Pushes the distances of the vectors [first, first + n). A chunk is compared with the threshold at once and only
+  // visited element-wise if any of them is nearer, which is rare once the heap is filled. NaN distances are never
+  // selected.
+  template <typename V> void push(const float *const distances, const std::size_t n, const std::size_t first) {
+    std::size_t i{};
+    for (; i + V::size() <= n; i += V::size()) {
+      if (any_of(knn_load<V>(distances + i) <= V{threshold()})) {
+        for (std::size_t j{i}; j < i + V::size(); ++j) {
+          push_if_nearer({first + j, distances[j]});
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      push_if_nearer({first + i, distances[i]});
+    }
+  }
+
+  std::vector<knn_neighbor> &heap() noexcept { return heap_; }
+
+private:
+  void push_if_nearer(const knn_neighbor &n) {
+    if (n.distance <= threshold()) {
+      push(n);
+    }
+  }
+
+  std::size_t k_;
+  std::vector<knn_neighbor> heap_;
+};
+
+template <typename V, typename S>
+void knn_select(const knn_metric metric, const knn_query<V> &query, const S *const database, const std::size_t first,
+                const std::size_t last, const std::size_t dim, knn_selection &selection) {
+  std::array<float, knn_block> distances;
+  for (std::size_t i{first}; i < last; i += knn_block) {
+    const std::size_t n{std::min(knn_block, last - i)};
+    knn_scan(metric, query, database + i * dim, n, dim, distances.data());
+    selection.push<V>(distances.data(), n, i);
+  }
+}
+
+} // namespace detail
+
+/// @brief Writes the distances of the count database vectors of dim elements, stored one after another, to the query
+/// into [out, out + count).
+///
+/// The distances of four database vectors are accumulated at once in simd<float, Abi> registers, reusing each chunk
+/// of the query. The database is either float or IEEE 754 half precision in std::uint16_t, which is converted while
+/// loading and halves the memory traffic.
+///
+/// @pre dim > 0
+template <typename Abi = simd_abi::compatible<float>, typename S>
+void knn_distances(const knn_metric metric, const float *const query, const S *const database, const std::size_t count,
+                   const std::size_t dim, float *const out) {
+  static_assert(std::is_same<S, float>::value || std::is_same<S, std::uint16_t>::value,
+                "database of float or half precision");
+  ENSURES(dim > 0U);
+  const detail::knn_query<simd<float, Abi>> q{query, dim};
+  detail::knn_scan(metric, q, database, count, dim, out);
+}
+
+/// @brief Returns the k nearest of the count database vectors of dim elements to the query, nearest first, ties by
+/// the smaller index.
+///
+/// The distances are computed by blocks as by knn_distances. Each block is compared chunk by chunk with the distance
+/// of the current k-th neighbor and only the nearer elements enter a heap. With more than one thread the database is
+/// split into contiguous ranges whose neighbors are merged, the result does not depend on the number of threads.
+///
+/// @pre dim > 0 and threads > 0
+template <typename Abi = simd_abi::compatible<float>, typename S>
+std::vector<knn_neighbor> knn_search(const knn_metric metric, const float *const query, const S *const database,
+                                     const std::size_t count, const std::size_t dim, const std::size_t k,
+                                     const std::size_t threads = 1U) {
+  static_assert(std::is_same<S, float>::value || std::is_same<S, std::uint16_t>::value,
+                "database of float or half precision");
+  ENSURES(dim > 0U);
+  ENSURES(threads > 0U);
+  using V = simd<float, Abi>;
+  const detail::knn_query<V> q{query, dim};
+
+  // every thread scans at least a block
+  const std::size_t parts{std::max(std::size_t{1U}, std::min(threads, count / detail::knn_block))};
+  std::vector<detail::knn_selection> selections(parts, detail::knn_selection{k});
+  if (k != 0U) {
+    const auto range = [&](const std::size_t p) { return count / parts * p + std::min(p, count % parts); };
+    std::vector<std::thread> workers;
+    workers.reserve(parts - 1U);
+    for (std::size_t p{1U}; p < parts; ++p) {
+      workers.emplace_back(
+          [&, p] { detail::knn_select(metric, q, database, range(p), range(p + 1U), dim, selections[p]); });
+    }
+    detail::knn_select(metric, q, database, range(0U), range(1U), dim, selections[0U]);
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+  }
+
+  std::vector<knn_neighbor> result;
+  for (detail::knn_selection &selection : selections) {
+    result.insert(result.end(), selection.heap().begin(), selection.heap().end());
+  }
+  const std::size_t n{std::min(k, result.size())};
+  std::partial_sort(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(n), result.end(), detail::knn_nearer);
+  result.resize(n);
+  return result;
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_KNN_H
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_LUT_H
+#define SIMD_LUT_H
+
+#include "simd.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace parallelism_v2 {
+
+/// @brief Lookup table of the N samples y[k] = f(x0 + k h) of a function on [x0, x1] with h = (x1 - x0) / (N - 1),
+/// interpolated linearly or cubically for the elements of a simd<float>.
+///
+/// The table stores the coefficients of a polynomial in the fraction t per segment [x0 + k h, x0 + (k + 1) h], such
+/// that an evaluation computes the segment index and the fraction in registers, fetches all coefficients by the same
+/// index and evaluates the polynomial by FMAs. The coefficients of up to 4 size() segments are held in registers and
+/// fetched by permute, larger tables are fetched from memory by gather.
+template <std::size_t N, typename Abi = simd_abi::compatible<float>> class simd_lut {
+  static_assert(N >= 2U, "at least two samples");
+
+public:
+  using simd_type = simd<float, Abi>;
+  using index_type = simd<std::int32_t, Abi>;
+
+  /// @brief Number of segments between two samples.
+  static constexpr std::size_t segments{N - 1U};
+
+  /// @brief Whether the coefficients are held in registers, otherwise in memory.
+  static constexpr bool in_registers{segments <= 4U * simd_type::size()};
+
+  /// @brief Tabulates the samples y on [x0, x1].
+  ///
+  /// The cubic interpolation extrapolates y[-1] and y[N] linearly beyond the ends of the table.
+  ///
+  /// @pre x0 < x1
+  constexpr simd_lut(const std::array<float, N> &y, const float x0, const float x1)
+      : x0_{x0}, x1_{x1}, scale_{static_cast<float>(segments) / (x1 - x0)} {
+    ENSURES(x0 < x1);
+    std::array<std::array<float, segments>, 2U> linear{};
+    std::array<std::array<float, segments>, 4U> cubic{};
+    for (std::size_t k{}; k < segments; ++k) {
+      // Catmull-Rom spline through p1 and p2 with the tangents (p2 - p0) / 2 and (p3 - p1) / 2
+      const float p0{(k == 0U) ? 2.0F * y[0] - y[1] : y[k - 1U]};
+      const float p1{y[k]};
+      const float p2{y[k + 1U]};
+      const float p3{(k + 2U == N) ? 2.0F * y[N - 1U] - y[N - 2U] : y[k + 2U]};
+      linear[0][k] = p1;
+      linear[1][k] = p2 - p1;
+      cubic[0][k] = p1;
+      cubic[1][k] = 0.5F * (p2 - p0);
+      cubic[2][k] = p0 - 2.5F * p1 + 2.0F * p2 - 0.5F * p3;
+      cubic[3][k] = 0.5F * (p3 - p0) + 1.5F * (p1 - p2);
+    }
+    linear_ = tabulate(linear);
+    cubic_ = tabulate(cubic);
+  }
+
+  /// @brief Returns the linear interpolation of the samples at the elements of x.
+  ///
+  /// Elements outside of [x0, x1] are clamped to it, NaN stays NaN.
+  constexpr simd_type linear(const simd_type &x) const {
+    const auto [index, t] = locate(x);
+    return fma(fetch(linear_[1], index), t, fetch(linear_[0], index));
+  }
+
+  /// @brief Returns the cubic Catmull-Rom interpolation of the samples at the elements of x.
+  ///
+  /// Passes through the samples with a continuous first derivative. Elements outside of [x0, x1] are clamped to it, NaN
+  /// stays NaN.
+  constexpr simd_type cubic(const simd_type &x) const {
+    const auto [index, t] = locate(x);
+    simd_type r{fetch(cubic_[3], index)};
+    r = fma(r, t, fetch(cubic_[2], index));
+    r = fma(r, t, fetch(cubic_[1], index));
+    return fma(r, t, fetch(cubic_[0], index));
+  }
+
+private:
+  static constexpr std::size_t width{simd_type::size()};
+  static_assert((width & (width - 1U)) == 0U, "width not a power of two");
+
+  // the coefficients of a power of t in registers of width segments each or in memory
+  using registers = std::array<simd_type, (segments + width - 1U) / width>;
+  using memory = std::array<float, segments>;
+  using coefficients = std::conditional_t<in_registers, registers, memory>;
+
+  template <std::size_t K>
+  static constexpr std::array<coefficients, K> tabulate(const std::array<memory, K> &c) noexcept {
+    if constexpr (in_registers) {
+      std::array<registers, K> r{};
+      for (std::size_t k{}; k < K; ++k) {
+        for (std::size_t j{}; j < r[k].size(); ++j) {
+          std::array<float, width> padded{};
+          for (std::size_t i{}; (i < width) && (j * width + i < segments); ++i) {
+            padded[i] = c[k][j * width + i];
+          }
+          r[k][j].copy_from(padded.data(), element_aligned);
+        }
+      }
+      return r;
+    } else {
+      return c;
+    }
+  }
+
+  // the segment index and the fraction within the segment
+  constexpr std::pair<index_type, simd_type> locate(const simd_type &x) const {
+    const simd_type s{(clamp(x, simd_type{x0_}, simd_type{x1_}) - simd_type{x0_}) * simd_type{scale_}};
+    // x1 belongs to the last segment, min returns its first operand for NaN such that the index stays valid
+    const simd_type f{min(simd_type{static_cast<float>(segments - 1U)}, floor(s))};
+    return {static_simd_cast<std::int32_t>(f), s - f};
+  }
+
+  static constexpr simd_type fetch(const coefficients &c, const index_type &index) noexcept {
+    if constexpr (in_registers) {
+      using mask_type = simd_mask<float, Abi>;
+      const index_type element{index & index_type{static_cast<std::int32_t>(width - 1U)}};
+      simd_type r{permute(c[0], element)};
+      for (std::size_t j{1U}; j < c.size(); ++j) {
+        where(mask_type{index >= index_type{static_cast<std::int32_t>(j * width)}}, r) = permute(c[j], element);
+      }
+      return r;
+    } else {
+      return gather(c.data(), index);
+    }
+  }
+
+  float x0_;
+  float x1_;
+  float scale_;
+  std::array<coefficients, 2U> linear_{};
+  std::array<coefficients, 4U> cubic_{};
+};
+
+} // namespace parallelism_v2
+
+#endif // SIMD_LUT_H
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_MAPPED_STREAM_H
+#define SIMD_MAPPED_STREAM_H
+
+#include "simd.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// A file mapped into memory, which is unmapped and closed on destruction. The kernel reads the pages in on the first
+// access, i.e., the data is not copied into a buffer first.
+class file_mapping {
+public:
+  // maps the whole file for reading
+  explicit file_mapping(const std::string &path) : fd_{::open(path.c_str(), O_RDONLY | O_CLOEXEC)} {
+    if (fd_ < 0) {
+      throw std::system_error{errno, std::generic_category(), "open " + path};
+    }
+    struct stat s;
+    if (::fstat(fd_, &s) != 0) {
+      fail("fstat " + path);
+    }
+    map(static_cast<std::size_t>(s.st_size), PROT_READ, MAP_PRIVATE, path);
+  }
+
+  // creates or truncates the file to the given number of bytes and maps it for writing
+  file_mapping(const std::string &path, const std::size_t bytes)
+      : fd_{::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)} {
+    if (fd_ < 0) {
+      throw std::system_error{errno, std::generic_category(), "open " + path};
+    }
+    if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+      fail("ftruncate " + path);
+    }
+    map(bytes, PROT_READ | PROT_WRITE, MAP_SHARED, path);
+  }
+
+  file_mapping(file_mapping &&other) noexcept
+      : fd_{std::exchange(other.fd_, -1)}, data_{std::exchange(other.data_, nullptr)},
+        bytes_{std::exchange(other.bytes_, 0U)} {}
+
+  file_mapping &operator=(file_mapping &&other) noexcept {
+    if (this != &other) {
+      release();
+      fd_ = std::exchange(other.fd_, -1);
+      data_ = std::exchange(other.data_, nullptr);
+      bytes_ = std::exchange(other.bytes_, 0U);
+    }
+    return *this;
+  }
+
+  ~file_mapping() noexcept { release(); }
+
+  // page aligned, nullptr for an empty file
+  std::byte *data() const noexcept { return data_; }
+  std::size_t bytes() const noexcept { return bytes_; }
+
+  // hints that the pages of [first, last) are needed soon or not needed anymore, where first is page aligned
+  void advise(const std::size_t first, const std::size_t last, const int advice) const noexcept {
+    if (first < last) {
+      static_cast<void>(::madvise(data_ + first, last - first, advice));
+    }
+  }
+
+private:
+  void map(const std::size_t bytes, const int protection, const int flags, const std::string &path) {
+    bytes_ = bytes;
+    if (bytes_ == 0U) {
+      return;
+    }
+    void *const p{::mmap(nullptr, bytes_, protection, flags, fd_, 0)};
+    if (p == MAP_FAILED) {
+      fail("mmap " + path);
+    }
+    data_ = static_cast<std::byte *>(p);
+    // doubles the read ahead of the page cache and frees pages behind the position earlier
+    static_cast<void>(::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL));
+    static_cast<void>(::madvise(data_, bytes_, MADV_SEQUENTIAL));
+  }
+
+  [[noreturn]] void fail(const std::string &what) {
+    const int error{errno};
+    release();
+    throw std::system_error{error, std::generic_category(), what};
+  }
+
+  void release() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(data_, bytes_);
+      data_ = nullptr;
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  int fd_;
+  std::byte *data_{nullptr};
+  std::size_t bytes_{};
+};
+
+// Moves a window of hints along a sequential pass over a mapping: requests the read ahead of the next window and
+// releases the previous one, i.e., the resident pages stay bounded for files larger than the memory.
+class mapping_window {
+public:
+  static constexpr std::size_t bytes{std::size_t{4U} << 20U};
+
+  // called when the position in bytes reached next()
+  void advance(const file_mapping &mapping, const std::size_t position) noexcept {
+    const std::size_t current{position / bytes * bytes};
+    const std::size_t end{mapping.bytes()};
+    if (current >= bytes) {
+      mapping.advise(current - bytes, current, MADV_DONTNEED);
+    } else {
+      // the window being read first, later it was requested as the next window already
+      mapping.advise(0U, std::min(bytes, end), MADV_WILLNEED);
+    }
+    mapping.advise(std::min(current + bytes, end), std::min(current + 2U * bytes, end), MADV_WILLNEED);
+    next_ = current + bytes;
+  }
+
+  std::size_t next() const noexcept { return next_; }
+
+private:
+  std::size_t next_{};
+};
+
+} // namespace detail
+
+/// @brief Reads the elements of a binary file of T by simd<T, Abi> chunks from a memory mapping of the file.
+///
+/// The elements are loaded from the page cache without a copy into a buffer. The chunks are aligned by
+/// memory_alignment_v as the mapping is page aligned. The stream advises the kernel of the sequential access, reads
+/// ahead and releases the pages behind the position, such that files larger than the memory are streamed with a bounded
+/// resident set. Trailing bytes which are not a whole element are ignored.
+template <typename T, typename Abi = simd_abi::compatible<T>> class mapped_simd_stream {
+public:
+  using simd_type = simd<T, Abi>;
+
+  /// @brief Maps the file at path.
+  ///
+  /// Throws std::system_error if the file cannot be opened or mapped.
+  explicit mapped_simd_stream(const std::string &path) : mapping_{path}, size_{mapping_.bytes() / sizeof(T)} {
+    window_.advance(mapping_, 0U);
+  }
+
+  /// @brief The number of elements in the file.
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief The number of elements read so far.
+  std::size_t position() const noexcept { return position_; }
+
+  /// @brief Loads the next chunk into v and returns the number of elements read, i.e., simd_type::size() except for
+  /// the tail of the file and 0 at its end.
+  ///
+  /// The elements of v beyond the tail are set to fill, which is never read from beyond the mapping.
+  std::size_t read(simd_type &v, const T fill = T{}) {
+    const std::size_t n{std::min(simd_type::size(), size_ - position_)};
+    const T *const p{reinterpret_cast<const T *>(mapping_.data()) + position_};
+    if (n == simd_type::size()) {
+      v.copy_from(p, vector_aligned);
+    } else if (n != 0U) {
+      alignas(memory_alignment_v<simd_type>) std::array<T, simd_type::size()> tail;
+      tail.fill(fill);
+      std::memcpy(tail.data(), p, n * sizeof(T));
+      v.copy_from(tail.data(), vector_aligned);
+    }
+    position_ += n;
+    if (position_ * sizeof(T) >= window_.next()) {
+      window_.advance(mapping_, position_ * sizeof(T));
+    }
+    return n;
+  }
+
+private:
+  static_assert(std::is_trivially_copyable<T>::value, "not trivially copyable");
+
+  detail::file_mapping mapping_;
+  detail::mapping_window window_;
+  std::size_t size_;
+  std::size_t position_{};
+};
+
+/// @brief Writes simd<T, Abi> chunks into a binary file of T by a memory mapping of the file.
+///
+/// The file is created or truncated to its final size up front. The chunks are stored into the page cache without a
+/// copy into a buffer and are aligned by memory_alignment_v as the mapping is page aligned. The stored elements are
+/// visible to readers of the file right away, the kernel writes the pages back to the storage in the background.
+template <typename T, typename Abi = simd_abi::compatible<T>> class mapped_simd_output {
+public:
+  using simd_type = simd<T, Abi>;
+
+  /// @brief Creates or truncates the file at path to size elements and maps it.
+  ///
+  /// Throws std::system_error if the file cannot be created or mapped.
+  mapped_simd_output(const std::string &path, const std::size_t size)
+      : mapping_{path, size * sizeof(T)}, size_{size} {}
+
+  /// @brief The number of elements of the file.
+  std::size_t size() const noexcept { return size_; }
+
+  /// @brief The number of elements written so far.
+  std::size_t position() const noexcept { return position_; }
+
+  /// @brief Stores the first n elements of v as the next elements of the file.
+  ///
+  /// Less than simd_type::size() elements are only allowed at the tail of the file.
+  ///
+  /// @pre n <= simd_type::size() and n <= size() - position()
+  /// @pre n == simd_type::size() or n == size() - position()
+  void write(const simd_type &v, const std::size_t n = simd_type::size()) {
+    ENSURES((n <= simd_type::size()) && (n <= size_ - position_));
+    ENSURES((n == simd_type::size()) || (n == size_ - position_));
+    T *const p{reinterpret_cast<T *>(mapping_.data()) + position_};
+    if (n == simd_type::size()) {
+      v.copy_to(p, vector_aligned);
+    } else if (n != 0U) {
+      alignas(memory_alignment_v<simd_type>) std::array<T, simd_type::size()> tail;
+      v.copy_to(tail.data(), vector_aligned);
+      std::memcpy(p, tail.data(), n * sizeof(T));
+    }
+    position_ += n;
+    if (position_ * sizeof(T) >= window_.next()) {
+      window_.advance(mapping_, position_ * sizeof(T));
+    }
+  }
+
+private:
+  static_assert(std::is_trivially_copyable<T>::value, "not trivially copyable");
+
+  detail::file_mapping mapping_;
+  detail::mapping_window window_;
+  std::size_t size_;
+  std::size_t position_{};
+};
+
+} // namespace parallelism_v2
+
+#endif // SIMD_MAPPED_STREAM_H
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_MATRIX_H
+#define SIMD_MATRIX_H
+
+#include "simd.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace parallelism_v2 {
+
+/// @brief A 4x4 matrix held in four registers, one row per register.
+template <typename T, typename Abi = simd_abi::fixed_size<4>> using simd_matrix4 = std::array<simd<T, Abi>, 4U>;
+
+/// @brief Transposes the 4x4 matrix whose rows are a, b, c and d in place.
+///
+/// The pattern of _MM_TRANSPOSE4_PS: the rows are interleaved pairwise and the halves of the interleaved pairs are
+/// combined, i.e., eight shuffles.
+template <typename T, typename Abi>
+constexpr void transpose4x4(simd<T, Abi> &a, simd<T, Abi> &b, simd<T, Abi> &c, simd<T, Abi> &d) noexcept {
+  static_assert(simd_size_v<T, Abi> == 4U, "transpose written for four elements");
+  const simd<T, Abi> t0{shuffle<0U, 4U, 1U, 5U>(a, b)};
+  const simd<T, Abi> t1{shuffle<2U, 6U, 3U, 7U>(a, b)};
+  const simd<T, Abi> t2{shuffle<0U, 4U, 1U, 5U>(c, d)};
+  const simd<T, Abi> t3{shuffle<2U, 6U, 3U, 7U>(c, d)};
+  a = shuffle<0U, 1U, 4U, 5U>(t0, t2);
+  b = shuffle<2U, 3U, 6U, 7U>(t0, t2);
+  c = shuffle<0U, 1U, 4U, 5U>(t1, t3);
+  d = shuffle<2U, 3U, 6U, 7U>(t1, t3);
+}
+
+/// @brief Returns the transpose of m.
+template <typename T, typename Abi> constexpr simd_matrix4<T, Abi> transpose(simd_matrix4<T, Abi> m) noexcept {
+  transpose4x4(m[0], m[1], m[2], m[3]);
+  return m;
+}
+
+/// @brief Returns the matrix-vector product m * x.
+///
+/// The element-wise products of the rows with x are reduced pairwise, i.e., the even and odd elements of two rows are
+/// added and then the lower and upper halves of the two partial sums. These are six shuffles and three additions
+/// instead of four horizontal reductions.
+template <typename T, typename Abi>
+constexpr simd<T, Abi> multiply(const simd_matrix4<T, Abi> &m, const simd<T, Abi> &x) noexcept {
+  static_assert(simd_size_v<T, Abi> == 4U, "product written for four elements");
+  const simd<T, Abi> a{m[0] * x};
+  const simd<T, Abi> b{m[1] * x};
+  const simd<T, Abi> c{m[2] * x};
+  const simd<T, Abi> d{m[3] * x};
+  const simd<T, Abi> ab{shuffle<0U, 4U, 2U, 6U>(a, b) + shuffle<1U, 5U, 3U, 7U>(a, b)};
+  const simd<T, Abi> cd{shuffle<0U, 4U, 2U, 6U>(c, d) + shuffle<1U, 5U, 3U, 7U>(c, d)};
+  return shuffle<0U, 1U, 4U, 5U>(ab, cd) + shuffle<2U, 3U, 6U, 7U>(ab, cd);
+}
+
+/// @brief Returns the matrix-matrix product a * b.
+///
+/// Row i of the product is the sum of the rows of b weighted by the elements of row i of a, i.e., a broadcast and an
+/// FMA per element of a.
+template <typename T, typename Abi>
+constexpr simd_matrix4<T, Abi> multiply(const simd_matrix4<T, Abi> &a, const simd_matrix4<T, Abi> &b) noexcept {
+  simd_matrix4<T, Abi> r;
+  for (std::size_t i{}; i < 4U; ++i) {
+    r[i] = shuffle<0U, 0U, 0U, 0U>(a[i], a[i]) * b[0];
+    r[i] = fma(shuffle<1U, 1U, 1U, 1U>(a[i], a[i]), b[1], r[i]);
+    r[i] = fma(shuffle<2U, 2U, 2U, 2U>(a[i], a[i]), b[2], r[i]);
+    r[i] = fma(shuffle<3U, 3U, 3U, 3U>(a[i], a[i]), b[3], r[i]);
+  }
+  return r;
+}
+
+namespace detail {
+
+// The micro-kernel computes a block of gemm_mr rows and gemm_nr<V> columns of C in 2 * gemm_mr registers. Each step
+// loads two registers of a row of the packed B panel and broadcasts gemm_mr elements of a column of the packed A
+// panel, which are 2 * gemm_mr independent FMAs for 2 + gemm_mr loads.
+constexpr std::size_t gemm_mr{4U};
+template <typename V> constexpr std::size_t gemm_nr{2U * V::size()};
+
+// The blocks of the packed panels, kc x nr of B stays in L1, mc x kc of A in L2 and kc x nc of B in L3.
+constexpr std::size_t gemm_kc{256U};
+constexpr std::size_t gemm_mc{96U};
+constexpr std::size_t gemm_nc{2048U};
+
+// Copies the rows [0, m) and columns [0, k) of a into panels of gemm_mr rows stored column by column, the rows past m
+// are zero.
+template <typename T>
+void pack_a(const std::size_t m, const std::size_t k, const T *const a, const std::size_t lda, T *out) noexcept {
+  for (std::size_t i{}; i < m; i += gemm_mr) {
+    for (std::size_t p{}; p < k; ++p) {
+      for (std::size_t r{}; r < gemm_mr; ++r) {
+        *out++ = (i + r < m) ? a[(i + r) * lda + p] : T{};
+      }
+    }
+  }
+}
+
+// Copies the rows [0, k) and columns [0, n) of b into panels of Nr columns stored row by row, the columns past n are
+// zero.
+template <std::size_t Nr, typename T>
+void pack_b(const std::size_t k, const std::size_t n, const T *const b, const std::size_t ldb, T *out) noexcept {
+  for (std::size_t j{}; j < n; j += Nr) {
+    for (std::size_t p{}; p < k; ++p) {
+      for (std::size_t c{}; c < Nr; ++c) {
+        *out++ = (j + c < n) ? b[p * ldb + j + c] : T{};
+      }
+    }
+  }
+}
+
+// c = a * b for a packed panel a of gemm_mr x k and a packed panel b of k x gemm_nr, or c += a * b if accumulate
+template <typename T, typename Abi>
+void gemm_kernel(const std::size_t k, const T *a, const T *b, T *const c, const std::size_t ldc,
+                 const bool accumulate) noexcept {
+  using V = simd<T, Abi>;
+  constexpr std::size_t size{V::size()};
+
+  std::array<V, gemm_mr> c0;
+  std::array<V, gemm_mr> c1;
+  c0.fill(V{T{}});
+  c1.fill(V{T{}});
+  for (std::size_t p{}; p < k; ++p, a += gemm_mr, b += 2U * size) {
+    V b0;
+    V b1;
+    b0.copy_from(b, element_aligned);
+    b1.copy_from(b + size, element_aligned);
+    for (std::size_t r{}; r < gemm_mr; ++r) {
+      const V ar{a[r]};
+      c0[r] = fma(ar, b0, c0[r]);
+      c1[r] = fma(ar, b1, c1[r]);
+    }
+  }
+  for (std::size_t r{}; r < gemm_mr; ++r) {
+    T *const row{c + r * ldc};
+    if (accumulate) {
+      V x;
+      x.copy_from(row, element_aligned);
+      c0[r] += x;
+      x.copy_from(row + size, element_aligned);
+      c1[r] += x;
+    }
+    c0[r].copy_to(row, element_aligned);
+    c1[r].copy_to(row + size, element_aligned);
+  }
+}
+
+} // namespace detail
+
+/// @brief Computes the row-major matrix product C = A * B of the m x k matrix A and the k x n matrix B.
+///
+/// lda, ldb and ldc are the distances between the rows of the matrices. The matrices are split into cache-sized
+/// blocks which are packed into contiguous panels, the panels are multiplied by a register-blocked micro-kernel of
+/// 4 rows and 2 * simd<T, Abi>::size() columns. Blocks at the right and bottom edges are computed into a buffer and
+/// copied.
+///
+/// @pre lda >= k, ldb >= n and ldc >= n, C does not overlap A or B.
+template <typename T, typename Abi = simd_abi::compatible<T>>
+void simd_gemm(const std::size_t m, const std::size_t n, const std::size_t k, const T *const a, const std::size_t lda,
+               const T *const b, const std::size_t ldb, T *const c, const std::size_t ldc) {
+  using V = simd<T, Abi>;
+  constexpr std::size_t mr{detail::gemm_mr};
+  constexpr std::size_t nr{detail::gemm_nr<V>};
+  constexpr std::size_t nc{detail::gemm_nc / nr * nr};
+  constexpr std::size_t kc{detail::gemm_kc};
+  constexpr std::size_t mc{detail::gemm_mc / mr * mr};
+
+  if (k == 0U) {
+    for (std::size_t i{}; i < m; ++i) {
+      std::fill(c + i * ldc, c + i * ldc + n, T{});
+    }
+    return;
+  }
+
+  std::vector<T> packed_a(mc * kc);
+  std::vector<T> packed_b(kc * ((std::min(n, nc) + nr - 1U) / nr * nr));
+  T edge[mr * nr];
+
+  for (std::size_t jc{}; jc < n; jc += nc) {
+    const std::size_t nb{std::min(nc, n - jc)};
+    for (std::size_t pc{}; pc < k; pc += kc) {
+      const std::size_t kb{std::min(kc, k - pc)};
+      detail::pack_b<nr>(kb, nb, b + pc * ldb + jc, ldb, packed_b.data());
+      for (std::size_t ic{}; ic < m; ic += mc) {
+        const std::size_t mb{std::min(mc, m - ic)};
+        detail::pack_a(mb, kb, a + ic * lda + pc, lda, packed_a.data());
+        for (std::size_t jr{}; jr < nb; jr += nr) {
+          for (std::size_t ir{}; ir < mb; ir += mr) {
+            const T *const pa{packed_a.data() + ir * kb};
+            const T *const pb{packed_b.data() + jr * kb};
+            T *const out{c + (ic + ir) * ldc + jc + jr};
+            const std::size_t rows{std::min(mr, mb - ir)};
+            const std::size_t columns{std::min(nr, nb - jr)};
+            if ((rows == mr) && (columns == nr)) {
+              detail::gemm_kernel<T, Abi>(kb, pa, pb, out, ldc, pc != 0U);
+              continue;
+            }
+            detail::gemm_kernel<T, Abi>(kb, pa, pb, edge, nr, false);
+            for (std::size_t i{}; i < rows; ++i) {
+              for (std::size_t j{}; j < columns; ++j) {
+                out[i * ldc + j] = (pc != 0U) ? out[i * ldc + j] + edge[i * nr + j] : edge[i * nr + j];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_MATRIX_H
@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_PARSE_H
+#define SIMD_PARSE_H
+
+#include "simd.h"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// the number of digits which are classified and converted at once
+constexpr std::size_t parse_digits{16U};
+
+// The first 16 bytes of [first, last), the bytes past last are zero, i.e., no digits. The copy of a fixed size is a
+// single unaligned load.
+inline std::array<std::uint32_t, 4U> load_digits(const char *const first, const char *const last) noexcept {
+  std::array<std::uint32_t, 4U> bytes{};
+  if (last - first >= static_cast<std::ptrdiff_t>(parse_digits)) {
+    std::memcpy(bytes.data(), first, parse_digits);
+  } else if (first != last) {
+    std::memcpy(bytes.data(), first, static_cast<std::size_t>(last - first));
+  }
+  return bytes;
+}
+
+// The number of leading decimal digits of the 16 bytes, classified chunk by chunk by the range "09", i.e., by a single
+// PCMPESTRM with SSE4.2.
+template <typename V> std::size_t count_digits(const std::array<std::uint32_t, 4U> &bytes) noexcept {
+  static_assert(parse_digits % V::size() == 0U, "chunks of the digits");
+  const V range{insert<1U>(V{'0'}, '9')};
+  for (std::size_t i{}; i < parse_digits; i += V::size()) {
+    V v;
+    v.copy_from(reinterpret_cast<const char *>(bytes.data()) + i, element_aligned);
+    const typename V::mask_type m{!is_in_ranges(v, range, 2U)};
+    if (any_of(m)) {
+      return i + static_cast<std::size_t>(find_first_set(m));
+    }
+  }
+  return parse_digits;
+}
+
+// byte i of align[n] selects byte n - 16 + i, i.e., moves the first n bytes to the end, or zero if negative
+struct parse_table {
+  constexpr parse_table() : align{} {
+    for (std::size_t n{}; n <= parse_digits; ++n) {
+      for (std::size_t i{}; i < parse_digits; ++i) {
+        const std::uint32_t index{(i + n >= parse_digits) ? static_cast<std::uint32_t>(i + n - parse_digits) : 0x80U};
+        align[n][i / 4U] |= index << (8U * (i % 4U));
+      }
+    }
+  }
+
+  std::array<std::array<std::uint32_t, 4U>, parse_digits + 1U> align;
+};
+
+inline constexpr parse_table parse_tables{};
+
+// The value of the n <= 16 leading digits. The digits are right-aligned behind leading zeros and then combined by
+// multiply-adds: pairs of digits into 2-digit halves, pairs of halves into 4-digit elements and pairs of elements into
+// 8-digit elements.
+template <typename V>
+std::uint64_t convert_digits(const std::array<std::uint32_t, 4U> &bytes, const std::size_t n) noexcept {
+  static_assert(V::size() == 4U, "16 digits");
+  V v;
+  V align;
+  v.copy_from(bytes.data(), element_aligned);
+  align.copy_from(parse_tables.align[n].data(), element_aligned);
+  V x{permute_bytes(v ^ V{0x30303030U}, align)};
+  x = madd_bytes(x, V{0x010A010AU});
+  x = madd_halves(x, V{0x00010064U});
+  x = madd_halves(permute_bytes(x, V{0x05040100U, 0x0D0C0908U, ~0U, ~0U}), V{0x00012710U});
+  return std::uint64_t{extract<0U>(x)} * 100000000U + extract<1U>(x);
+}
+
+// the digits at [first, last) if there are at most 16 of them
+struct parse_digits_result {
+  std::uint64_t value;
+  std::size_t count;
+  bool converted;
+};
+
+template <typename Abi>
+parse_digits_result parse_unsigned(const char *const first, const char *const last) noexcept {
+  const std::array<std::uint32_t, 4U> bytes{load_digits(first, last)};
+  const std::size_t n{count_digits<simd<char, simd_abi::compatible<char>>>(bytes)};
+  if ((n == parse_digits) && (last - first > static_cast<std::ptrdiff_t>(n)) && (first[n] >= '0') &&
+      (first[n] <= '9')) {
+    return {0U, n, false};
+  }
+  return {(n == 0U) ? 0U : convert_digits<simd<std::uint32_t, Abi>>(bytes, n), n, true};
+}
+
+// the exact powers of ten of float, 5^10 < 2^24
+constexpr float parse_powers_of_ten[]{1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+
+} // namespace detail
+
+/// @brief Parses an optional minus sign followed by decimal digits at the beginning of [first, last) like
+/// std::from_chars, i.e., returns the end of the digits and stores the integer in value, or returns the error and
+/// leaves value unchanged.
+///
+/// Up to 16 digits are classified by is_in_ranges and converted by multiply-adds of simd<std::uint32_t, Abi>, i.e., by
+/// PCMPESTRM, PSHUFB, PMADDUBSW and PMADDWD with SSE4.2. More digits are parsed by std::from_chars.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+std::from_chars_result simd_from_chars(const char *const first, const char *const last, std::int32_t &value) noexcept {
+  const bool negative{(first != last) && (*first == '-')};
+  const char *const digits{first + (negative ? 1 : 0)};
+  const detail::parse_digits_result r{detail::parse_unsigned<Abi>(digits, last)};
+  if (!r.converted) {
+    return std::from_chars(first, last, value);
+  }
+  if (r.count == 0U) {
+    return {first, std::errc::invalid_argument};
+  }
+  const char *const end{digits + r.count};
+  const std::uint64_t limit{std::uint64_t{std::numeric_limits<std::int32_t>::max()} + (negative ? 1U : 0U)};
+  if (r.value > limit) {
+    return {end, std::errc::result_out_of_range};
+  }
+  value = static_cast<std::int32_t>(negative ? 0U - r.value : r.value);
+  return {end, std::errc{}};
+}
+
+/// @brief Parses a float at the beginning of [first, last) like std::from_chars in std::chars_format::general, i.e.,
+/// an optional minus sign, decimal digits with an optional fraction and an optional exponent.
+///
+/// The integer and the fraction digits are converted as by the integer overload. If the significand is at most 2^24
+/// and the decimal exponent at most 10 in magnitude, the significand and the power of ten are exact floats and a single
+/// multiplication or division rounds correctly. Everything else, e.g., long significands, large exponents, infinity or
+/// NaN, is parsed by std::from_chars.
+template <typename Abi = simd_abi::compatible<std::uint32_t>>
+std::from_chars_result simd_from_chars(const char *const first, const char *const last, float &value) noexcept {
+  const bool negative{(first != last) && (*first == '-')};
+  const char *p{first + (negative ? 1 : 0)};
+  const detail::parse_digits_result integer{detail::parse_unsigned<Abi>(p, last)};
+  p += integer.count;
+  detail::parse_digits_result fraction{0U, 0U, true};
+  if ((p != last) && (*p == '.')) {
+    fraction = detail::parse_unsigned<Abi>(p + 1, last);
+    p += 1U + fraction.count;
+  }
+  if (!integer.converted || !fraction.converted || (integer.count + fraction.count == 0U) ||
+      (integer.count + fraction.count > 19U)) {
+    return std::from_chars(first, last, value);
+  }
+
+  // the exponent is only part of the number if it has digits
+  int exponent{};
+  if ((p != last) && ((*p == 'e') || (*p == 'E'))) {
+    const char *e{p + 1};
+    const bool negative_exponent{(e != last) && (*e == '-')};
+    e += ((e != last) && ((*e == '-') || (*e == '+'))) ? 1 : 0;
+    const char *const exponent_digits{e};
+    for (; (e != last) && (*e >= '0') && (*e <= '9') && (e - exponent_digits < 4); ++e) {
+      exponent = exponent * 10 + (*e - '0');
+    }
+    if ((e != last) && (*e >= '0') && (*e <= '9')) {
+      return std::from_chars(first, last, value);
+    }
+    if (e != exponent_digits) {
+      exponent = negative_exponent ? -exponent : exponent;
+      p = e;
+    }
+  }
+
+  std::uint64_t significand{integer.value};
+  for (std::size_t i{}; i < fraction.count; ++i) {
+    significand *= 10U;
+  }
+  significand += fraction.value;
+  exponent -= static_cast<int>(fraction.count);
+  if ((significand > (std::uint64_t{1U} << 24U)) || (exponent < -10) || (exponent > 10)) {
+    return std::from_chars(first, last, value);
+  }
+  const float w{static_cast<float>(significand)};
+  const float x{(exponent < 0) ? w / detail::parse_powers_of_ten[-exponent]
+                                : w * detail::parse_powers_of_ten[exponent]};
+  value = negative ? -x : x;
+  return {p, std::errc{}};
+}
+
+/// @brief Parses simd<T, Abi>::size() numbers by simd_from_chars into v. Every number is followed by the separator,
+/// which is skipped, or by last.
+///
+/// Returns the end of the last separator, or last, on success. Otherwise returns the error of the first number which
+/// does not parse or is not followed by the separator, and leaves v unchanged. If the range ends before size()
+/// numbers, returns last and std::errc::invalid_argument, i.e., the remaining numbers have to be parsed one by one.
+template <typename T, typename Abi>
+std::from_chars_result simd_from_chars(const char *first, const char *const last, simd<T, Abi> &v,
+                                       const char separator) noexcept {
+  static_assert(std::is_same<T, std::int32_t>::value || std::is_same<T, float>::value, "int32_t or float");
+  alignas(simd<T, Abi>) T values[simd<T, Abi>::size()];
+  for (T &x : values) {
+    if (first == last) {
+      return {last, std::errc::invalid_argument};
+    }
+    const std::from_chars_result r{simd_from_chars(first, last, x)};
+    if (r.ec != std::errc{}) {
+      return r;
+    }
+    if ((r.ptr != last) && (*r.ptr != separator)) {
+      return {r.ptr, std::errc::invalid_argument};
+    }
+    first = (r.ptr == last) ? last : r.ptr + 1;
+  }
+  v.copy_from(values, vector_aligned);
+  return {first, std::errc{}};
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_PARSE_H
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_POLYNOMIAL_H
+#define SIMD_POLYNOMIAL_H
+
+#include "simd.h"
+#include <array>
+#include <cstddef>
+
+namespace parallelism_v2 {
+
+/// @brief Returns c0 + c1 x + c2 x^2 + ... for the elements of x by Horner's scheme.
+///
+/// The coefficients are template arguments, e.g., horner<1.0F, 0.5F, 0.25F>(x). These are one FMA per coefficient,
+/// each depending on the previous one, i.e., the fewest operations but a latency of the degree times the latency of an
+/// FMA.
+template <auto... C, typename T, typename Abi> constexpr simd<T, Abi> horner(const simd<T, Abi> &x) noexcept {
+  static_assert(sizeof...(C) > 0U, "no coefficients");
+  using V = simd<T, Abi>;
+  constexpr std::array<T, sizeof...(C)> c{static_cast<T>(C)...};
+
+  V r{c.back()};
+  for (std::size_t i{c.size() - 1U}; i > 0U; --i) {
+    r = fma(r, x, V{c[i - 1U]});
+  }
+  return r;
+}
+
+/// @brief Returns c0 + c1 x + c2 x^2 + ... for the elements of x by Estrin's scheme.
+///
+/// The coefficients are combined pairwise to c0 + c1 x, c2 + c3 x, ..., these pairwise by x^2, then by x^4 and so on.
+/// The FMAs of a level are independent, i.e., the latency is about log2 of the degree times the latency of an FMA and
+/// a multiplication for the powers of x at the cost of these multiplications.
+template <auto... C, typename T, typename Abi> constexpr simd<T, Abi> estrin(const simd<T, Abi> &x) noexcept {
+  static_assert(sizeof...(C) > 0U, "no coefficients");
+  using V = simd<T, Abi>;
+
+  std::array<V, sizeof...(C)> p{V{static_cast<T>(C)}...};
+  V power{x};
+  for (std::size_t n{p.size()}; n > 1U; n = (n + 1U) / 2U) {
+    for (std::size_t i{}; i < n / 2U; ++i) {
+      p[i] = fma(p[2U * i + 1U], power, p[2U * i]);
+    }
+    if (n % 2U != 0U) {
+      p[n / 2U] = p[n - 1U];
+    }
+    power *= power;
+  }
+  return p[0];
+}
+
+/// @brief The coefficients c0, c1, ... of the polynomial c0 + c1 x + c2 x^2 + ... as template arguments.
+template <auto... C> struct polynomial {};
+
+namespace detail {
+
+template <typename T, typename Abi, auto... C>
+constexpr simd<T, Abi> evaluate(const simd<T, Abi> &x, polynomial<C...>) noexcept {
+  return estrin<C...>(x);
+}
+
+} // namespace detail
+
+/// @brief Returns p(x) / q(x) for the elements of x, e.g., rational<polynomial<1.0F, 1.0F>, polynomial<1.0F,
+/// -1.0F>>(x) for (1 + x) / (1 - x).
+///
+/// The polynomials are independent and evaluated by Estrin's scheme, followed by a single division.
+template <typename P, typename Q, typename T, typename Abi>
+constexpr simd<T, Abi> rational(const simd<T, Abi> &x) noexcept {
+  return detail::evaluate(x, P{}) / detail::evaluate(x, Q{});
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_POLYNOMIAL_H
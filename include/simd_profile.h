@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_PROFILE_H
+#define SIMD_PROFILE_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace parallelism_v2 {
+
+/// @brief The hardware events counted by kernel_profile.
+enum class hardware_event : std::size_t {
+  cycles,
+  instructions,
+  l1d_misses,    ///< L1 data cache read misses
+  llc_misses,    ///< last level cache misses
+  branch_misses, ///< mispredicted branches
+  count
+};
+
+/// @brief The number of occurrences of each hardware event.
+///
+/// The events are counted as a group, which the kernel schedules on the core as a whole, e.g., if other groups
+/// compete for the counters. The time the group was enabled and the time it ran tell whether and how long the events
+/// were counted.
+class hardware_counts {
+public:
+  /// @brief The number of occurrences of e.
+  constexpr std::uint64_t operator[](const hardware_event e) const noexcept {
+    return counts_[static_cast<std::size_t>(e)];
+  }
+
+  /// @brief The number of occurrences of e.
+  constexpr std::uint64_t &operator[](const hardware_event e) noexcept { return counts_[static_cast<std::size_t>(e)]; }
+
+  /// @brief The nanoseconds the group of counters was enabled.
+  constexpr std::uint64_t time_enabled() const noexcept { return time_enabled_; }
+
+  /// @brief The nanoseconds the group of counters was enabled.
+  constexpr std::uint64_t &time_enabled() noexcept { return time_enabled_; }
+
+  /// @brief The nanoseconds the group of counters was scheduled on the core, i.e., counted the events.
+  ///
+  /// Zero if the group never ran, e.g., because other groups occupied the counters, then the counts are unknown.
+  constexpr std::uint64_t time_running() const noexcept { return time_running_; }
+
+  /// @brief The nanoseconds the group of counters was scheduled on the core, i.e., counted the events.
+  constexpr std::uint64_t &time_running() noexcept { return time_running_; }
+
+  /// @brief The occurrences since the earlier counts b.
+  friend constexpr hardware_counts operator-(const hardware_counts &a, const hardware_counts &b) noexcept {
+    hardware_counts r;
+    for (std::size_t i{}; i < r.counts_.size(); ++i) {
+      r.counts_[i] = a.counts_[i] - b.counts_[i];
+    }
+    r.time_enabled_ = a.time_enabled_ - b.time_enabled_;
+    r.time_running_ = a.time_running_ - b.time_running_;
+    return r;
+  }
+
+  /// @brief Adds the occurrences of b.
+  constexpr hardware_counts &operator+=(const hardware_counts &b) noexcept {
+    for (std::size_t i{}; i < counts_.size(); ++i) {
+      counts_[i] += b.counts_[i];
+    }
+    time_enabled_ += b.time_enabled_;
+    time_running_ += b.time_running_;
+    return *this;
+  }
+
+private:
+  std::array<std::uint64_t, static_cast<std::size_t>(hardware_event::count)> counts_{};
+  std::uint64_t time_enabled_{};
+  std::uint64_t time_running_{};
+};
+
+namespace detail {
+
+// A group of hardware counters of the calling thread, which count from the creation of the group on and are read by a
+// single system call. Events which cannot be opened, e.g., because perf_event_open is not permitted inside a container
+// or the event is not supported by a virtual machine, are not available and read as zero.
+class perf_event_group {
+public:
+  perf_event_group() noexcept {
+#if defined(__linux__)
+    constexpr std::uint64_t l1d_read_miss{PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U) |
+                                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U)};
+    constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, events> config{{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, l1d_read_miss},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+    for (std::size_t i{}; i < events; ++i) {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.type = config[i].first;
+      attr.config = config[i].second;
+      attr.exclude_kernel = 1U;
+      attr.exclude_hv = 1U;
+      attr.read_format =
+          PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const long fd{syscall(SYS_perf_event_open, &attr, 0, -1, leader_, PERF_FLAG_FD_CLOEXEC)};
+      if (fd < 0) {
+        continue;
+      }
+      fd_[i] = static_cast<int>(fd);
+      if (ioctl(fd_[i], PERF_EVENT_IOC_ID, &id_[i]) != 0) {
+        close(fd_[i]);
+        fd_[i] = -1;
+        continue;
+      }
+      if (leader_ < 0) {
+        leader_ = fd_[i];
+      }
+    }
+#endif
+  }
+
+  perf_event_group(const perf_event_group &) = delete;
+  perf_event_group &operator=(const perf_event_group &) = delete;
+
+  ~perf_event_group() noexcept {
+#if defined(__linux__)
+    for (const int fd : fd_) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  bool available(const hardware_event e) const noexcept { return fd_[static_cast<std::size_t>(e)] >= 0; }
+
+  hardware_counts read() const noexcept {
+    hardware_counts r;
+#if defined(__linux__)
+    if (leader_ < 0) {
+      return r;
+    }
+    // the number of events, the times enabled and running, followed by a value and an id per event
+    std::array<std::uint64_t, 3U + 2U * events> buffer{};
+    if (::read(leader_, buffer.data(), sizeof(buffer)) <= 0) {
+      return r;
+    }
+    r.time_enabled() = buffer[1];
+    r.time_running() = buffer[2];
+    for (std::size_t j{}; j < buffer[0] && j < events; ++j) {
+      for (std::size_t i{}; i < events; ++i) {
+        if ((fd_[i] >= 0) && (id_[i] == buffer[4U + 2U * j])) {
+          r[static_cast<hardware_event>(i)] = buffer[3U + 2U * j];
+        }
+      }
+    }
+#endif
+    return r;
+  }
+
+private:
+  static constexpr std::size_t events{static_cast<std::size_t>(hardware_event::count)};
+
+  int leader_{-1};
+  std::array<int, events> fd_{-1, -1, -1, -1, -1};
+  std::array<std::uint64_t, events> id_{};
+};
+
+inline const perf_event_group &thread_perf_events() noexcept {
+  thread_local const perf_event_group group{};
+  return group;
+}
+
+} // namespace detail
+
+/// @brief The accumulated measurements of the profiles of a kernel.
+struct kernel_statistics {
+  std::uint64_t calls{};
+  std::uint64_t bytes{};
+  std::chrono::nanoseconds time{};
+  hardware_counts counts{};
+
+  /// @brief Instructions per cycle, zero if the cycles are not counted.
+  double ipc() const noexcept {
+    const std::uint64_t cycles{counts[hardware_event::cycles]};
+    return (cycles == 0U) ? 0.0 : static_cast<double>(counts[hardware_event::instructions]) / cycles;
+  }
+
+  /// @brief Bytes processed per cycle, zero if the cycles are not counted.
+  double bytes_per_cycle() const noexcept {
+    const std::uint64_t cycles{counts[hardware_event::cycles]};
+    return (cycles == 0U) ? 0.0 : static_cast<double>(bytes) / cycles;
+  }
+};
+
+/// @brief The table of the calling thread from kernel names to their accumulated measurements.
+///
+/// Each thread owns its table, i.e., profiling takes no locks and the measurements of other threads are not included.
+inline std::map<std::string, kernel_statistics, std::less<>> &thread_kernel_profile_table() noexcept {
+  thread_local std::map<std::string, kernel_statistics, std::less<>> table;
+  return table;
+}
+
+/// @brief Whether the calling thread counts the hardware event.
+///
+/// False, e.g., inside containers which do not permit perf_event_open, in which case kernel_profile only measures the
+/// time.
+inline bool hardware_event_available(const hardware_event e) noexcept {
+  return detail::thread_perf_events().available(e);
+}
+
+/// @brief Measures the hardware events and the time of the calling thread during its lifetime and adds them to the
+/// entry of the kernel name in the thread_kernel_profile_table().
+///
+/// E.g., `{ kernel_profile profile{"saxpy"}; profile.add_bytes(3 * n * sizeof(float)); saxpy(a, x, y, n); }`.
+class kernel_profile {
+public:
+  /// @brief Starts measuring.
+  explicit kernel_profile(std::string name) noexcept
+      : name_{std::move(name)}, start_time_{std::chrono::steady_clock::now()},
+        start_{detail::thread_perf_events().read()} {}
+
+  kernel_profile(const kernel_profile &) = delete;
+  kernel_profile &operator=(const kernel_profile &) = delete;
+
+  /// @brief Stops measuring and accumulates the measurements.
+  ~kernel_profile() {
+    const hardware_counts c{counts()};
+    const std::chrono::nanoseconds t{std::chrono::steady_clock::now() - start_time_};
+    auto &table{thread_kernel_profile_table()};
+    auto it{table.find(name_)};
+    if (it == table.end()) {
+      it = table.emplace(std::move(name_), kernel_statistics{}).first;
+    }
+    kernel_statistics &s{it->second};
+    ++s.calls;
+    s.bytes += bytes_;
+    s.time += t;
+    s.counts += c;
+  }
+
+  /// @brief Adds n bytes to the bytes processed by the kernel.
+  void add_bytes(const std::uint64_t n) noexcept { bytes_ += n; }
+
+  /// @brief The occurrences of the hardware events since the start.
+  hardware_counts counts() const noexcept { return detail::thread_perf_events().read() - start_; }
+
+private:
+  std::string name_;
+  std::uint64_t bytes_{};
+  std::chrono::steady_clock::time_point start_time_;
+  hardware_counts start_;
+};
+
+/// @brief Writes the thread_kernel_profile_table() of the calling thread, one kernel per line.
+///
+/// Only the kernels profiled by the calling thread are written. The columns of unavailable hardware events and of
+/// kernels during which the counters never ran read "n/a".
+inline void thread_kernel_profile_report(std::ostream &os) {
+  constexpr std::array<std::pair<hardware_event, std::string_view>, 5U> columns{{
+      {hardware_event::cycles, "cycles"},
+      {hardware_event::instructions, "instructions"},
+      {hardware_event::l1d_misses, "L1D misses"},
+      {hardware_event::llc_misses, "LLC misses"},
+      {hardware_event::branch_misses, "branch misses"},
+  }};
+  const bool cycles{hardware_event_available(hardware_event::cycles)};
+  const bool ipc{cycles && hardware_event_available(hardware_event::instructions)};
+
+  os << std::left << std::setw(32) << "kernel" << std::right << std::setw(10) << "calls" << std::setw(14)
+     << "time [ns]";
+  for (const auto &column : columns) {
+    os << std::setw(16) << column.second;
+  }
+  os << std::setw(8) << "IPC" << std::setw(14) << "bytes/cycle" << '\n';
+
+  const auto flags{os.flags()};
+  const auto precision{os.precision()};
+  for (const auto &[name, s] : thread_kernel_profile_table()) {
+    os << std::left << std::setw(32) << name << std::right << std::setw(10) << s.calls << std::setw(14)
+       << s.time.count();
+    const bool counted{s.counts.time_running() != 0U};
+    for (const auto &column : columns) {
+      if (counted && hardware_event_available(column.first)) {
+        os << std::setw(16) << s.counts[column.first];
+      } else {
+        os << std::setw(16) << "n/a";
+      }
+    }
+    os << std::fixed << std::setprecision(2);
+    if (counted && ipc) {
+      os << std::setw(8) << s.ipc();
+    } else {
+      os << std::setw(8) << "n/a";
+    }
+    if (counted && cycles && (s.bytes != 0U)) {
+      os << std::setw(14) << s.bytes_per_cycle();
+    } else {
+      os << std::setw(14) << "n/a";
+    }
+    os.flags(flags);
+    os.precision(precision);
+    os << '\n';
+  }
+}
+
+/// @brief Clears the thread_kernel_profile_table() of the calling thread.
+inline void thread_kernel_profile_reset() noexcept { thread_kernel_profile_table().clear(); }
+
+} // namespace parallelism_v2
+
+#endif // SIMD_PROFILE_H
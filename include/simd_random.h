@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_RANDOM_H
+#define SIMD_RANDOM_H
+
+#include "simd.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace parallelism_v2 {
+namespace detail {
+
+// the bits of the elements of v reinterpreted as float
+template <typename Abi> constexpr simd<float, Abi> as_float(const simd<std::uint32_t, Abi> &v) noexcept {
+  using type = typename simd<float, Abi>::_storage_type;
+  return simd<float, Abi>{bit_cast<type>(static_cast<typename simd<std::uint32_t, Abi>::_storage_type>(v))};
+}
+
+// the bits of the elements of v reinterpreted as std::uint32_t
+template <typename Abi> constexpr simd<std::uint32_t, Abi> as_uint(const simd<float, Abi> &v) noexcept {
+  using type = typename simd<std::uint32_t, Abi>::_storage_type;
+  return simd<std::uint32_t, Abi>{bit_cast<type>(static_cast<typename simd<float, Abi>::_storage_type>(v))};
+}
+
+// the floats in [1, 2) whose mantissas are the upper 23 bits of x
+template <typename Abi> constexpr simd<float, Abi> one_to_two(const simd<std::uint32_t, Abi> &x) noexcept {
+  return as_float((x >> 9) | simd<std::uint32_t, Abi>{0x3F800000U});
+}
+
+// The natural logarithm of positive normal floats as in the Cephes logf: the exponent is split off such that the
+// mantissa m lies in [sqrt(1/2), sqrt(2)) and log(m) is a polynomial in m - 1.
+template <typename Abi> constexpr simd<float, Abi> log(const simd<float, Abi> &x) noexcept {
+  using U = simd<std::uint32_t, Abi>;
+  using V = simd<float, Abi>;
+
+  const U bits{as_uint(x)};
+  U exponent{bits >> 23};
+  V m{as_float((bits & U{0x007FFFFFU}) | U{0x3F800000U})};
+  const simd_mask<float, Abi> large{m > V{1.41421356F}};
+  where(large, m) *= V{0.5F};
+  where(simd_mask<std::uint32_t, Abi>{large}, exponent) += U{1U};
+  // the biased exponent is below 2^23, i.e., the mantissa of 2^23 + exponent
+  const V e{as_float(exponent | U{0x4B000000U}) - V{8388608.0F + 127.0F}};
+
+  const V z{m - V{1.0F}};
+  V p{7.0376836292E-2F};
+  p = fma(p, z, V{-1.1514610310E-1F});
+  p = fma(p, z, V{1.1676998740E-1F});
+  p = fma(p, z, V{-1.2420140846E-1F});
+  p = fma(p, z, V{1.4249322787E-1F});
+  p = fma(p, z, V{-1.6668057665E-1F});
+  p = fma(p, z, V{2.0000714765E-1F});
+  p = fma(p, z, V{-2.4999993993E-1F});
+  p = fma(p, z, V{3.3333331174E-1F});
+  const V z2{z * z};
+  V y{p * z * z2};
+  y = fma(e, V{-2.12194440E-4F}, y);
+  y = fma(z2, V{-0.5F}, y);
+  return fma(e, V{0.693359375F}, z + y);
+}
+
+// The cosine and sine of 2 pi x / 2^32. The upper two bits of x rounded to nearest are the quadrant and the remaining
+// bits the angle in [-pi / 4, pi / 4) within the quadrant, for which the sine and cosine are the polynomials of the
+// Cephes sinf and cosf. The quadrant swaps them and flips their sign bits.
+template <typename Abi>
+constexpr std::pair<simd<float, Abi>, simd<float, Abi>> cos_sin_turn(const simd<std::uint32_t, Abi> &x) noexcept {
+  using U = simd<std::uint32_t, Abi>;
+  using V = simd<float, Abi>;
+
+  const U y{x + U{1U << 29}};
+  const U quadrant{y >> 30};
+  const V a{(one_to_two(y << 2) - V{1.5F}) * V{1.57079632679F}};
+  const V a2{a * a};
+
+  V s{-1.9515295891E-4F};
+  s = fma(s, a2, V{8.3321608736E-3F});
+  s = fma(s, a2, V{-1.6666654611E-1F});
+  s = fma(s * a2, a, a);
+  V c{2.443315711809948E-5F};
+  c = fma(c, a2, V{-1.388731625493765E-3F});
+  c = fma(c, a2, V{4.166664568298827E-2F});
+  c = fma(c * a2, a2, fma(a2, V{-0.5F}, V{1.0F}));
+
+  const simd_mask<float, Abi> odd{(quadrant & U{1U}) != U{0U}};
+  V cos{c};
+  V sin{s};
+  where(odd, cos) = s;
+  where(odd, sin) = c;
+  cos = as_float(as_uint(cos) ^ (((quadrant + U{1U}) & U{2U}) << 30));
+  sin = as_float(as_uint(sin) ^ ((quadrant & U{2U}) << 30));
+  return {cos, sin};
+}
+
+// 0, 1, ..., size() - 1
+template <typename V> constexpr V iota() noexcept {
+  std::array<typename V::value_type, V::size()> v{};
+  for (std::size_t i{}; i < v.size(); ++i) {
+    v[i] = static_cast<typename V::value_type>(i);
+  }
+  V r;
+  r.copy_from(v.data(), element_aligned);
+  return r;
+}
+
+// One step of xoshiro128+ on a state of std::uint32_t or of simd<std::uint32_t>.
+template <typename T> constexpr void xoshiro128_step(std::array<T, 4U> &s) noexcept {
+  const T t{s[1] << 9};
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = (s[3] << 11) | (s[3] >> 21);
+}
+
+// Advances the state by the number of steps encoded in the jump polynomial, i.e., sums the states after the steps
+// selected by its bits. The bits are the same for all elements of a simd state.
+template <typename T>
+constexpr void xoshiro128_jump(std::array<T, 4U> &s, const std::array<std::uint32_t, 4U> &polynomial) noexcept {
+  std::array<T, 4U> j{T{0U}, T{0U}, T{0U}, T{0U}};
+  for (const std::uint32_t word : polynomial) {
+    for (int b{}; b < 32; ++b) {
+      if ((word & (1U << b)) != 0U) {
+        for (std::size_t i{}; i < 4U; ++i) {
+          j[i] ^= s[i];
+        }
+      }
+      xoshiro128_step(s);
+    }
+  }
+  s = j;
+}
+
+// 2^64 and 2^96 steps
+constexpr std::array<std::uint32_t, 4U> xoshiro128_jump_polynomial{0x8764000BU, 0xF542D2D3U, 0x6FA035C3U,
+                                                                   0x77F2DB5BU};
+constexpr std::array<std::uint32_t, 4U> xoshiro128_long_jump_polynomial{0xB523952EU, 0x0B6F099FU, 0xCCF5A0EFU,
+                                                                        0x1C580662U};
+
+constexpr std::uint64_t splitmix64(std::uint64_t &state) noexcept {
+  std::uint64_t z{state += 0x9E3779B97F4A7C15U};
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9U;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBU;
+  return z ^ (z >> 31);
+}
+
+} // namespace detail
+
+/// @brief Counter-based generator of random bits, Philox4x32-10 of Salmon et al. with simd<std::uint32_t>::size()
+/// counters in parallel.
+///
+/// Each block of four results is the Philox bijection of size() consecutive counters, i.e., ten rounds of two
+/// multiplications of which the lower and upper halves are mixed with the key. The 64 bit seed is the key and the
+/// stream the upper half of the 128 bit counter, such that every (seed, stream) is an independent sequence of 2^66
+/// results, e.g., one per thread. Element i of the results in the block k is word k % 4 of the counter
+/// (k / 4) * size() + i, discard() jumps by setting the counter.
+template <typename Abi = simd_abi::compatible<std::uint32_t>> class philox4x32 {
+public:
+  using result_type = simd<std::uint32_t, Abi>;
+
+  /// @brief Initializes the sequence of stream for the key seed.
+  constexpr explicit philox4x32(const std::uint64_t seed, const std::uint64_t stream = 0U) noexcept
+      : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}, stream_{stream} {}
+
+  /// @brief Returns the next size() random values.
+  constexpr result_type operator()() noexcept {
+    if (index_ == 8U) {
+      generate();
+    }
+    return buffer_[index_++];
+  }
+
+  /// @brief Advances the state as if operator() were called n times.
+  constexpr void discard(const std::uint64_t n) noexcept {
+    const std::uint64_t position{4U * counter_ + index_ - 8U + n};
+    counter_ = position / 8U * 2U;
+    index_ = 8U;
+    if (position % 8U != 0U) {
+      generate();
+      index_ = position % 8U;
+    }
+  }
+
+private:
+  // Two blocks at once, since the rounds of a block are a chain of dependent multiplications and the rounds of the
+  // other block are independent of it.
+  constexpr void generate() noexcept {
+    using V = result_type;
+    // the lower halves of the counters do not overflow, since the first is a multiple of the power of two size()
+    const std::uint64_t first{counter_ * V::size()};
+    const std::uint64_t second{first + V::size()};
+    std::array<V, 4U> a{V{static_cast<std::uint32_t>(first)} + detail::iota<V>(),
+                        V{static_cast<std::uint32_t>(first >> 32)}, V{static_cast<std::uint32_t>(stream_)},
+                        V{static_cast<std::uint32_t>(stream_ >> 32)}};
+    std::array<V, 4U> b{V{static_cast<std::uint32_t>(second)} + detail::iota<V>(),
+                        V{static_cast<std::uint32_t>(second >> 32)}, a[2], a[3]};
+    std::uint32_t k0{key_[0]};
+    std::uint32_t k1{key_[1]};
+    for (int round{}; round < 10; ++round, k0 += 0x9E3779B9U, k1 += 0xBB67AE85U) {
+      a = philox_round(a, V{k0}, V{k1});
+      b = philox_round(b, V{k0}, V{k1});
+    }
+    buffer_ = {a[0], a[1], a[2], a[3], b[0], b[1], b[2], b[3]};
+    index_ = 0U;
+    counter_ += 2U;
+  }
+
+  static constexpr std::array<result_type, 4U> philox_round(const std::array<result_type, 4U> &c,
+                                                            const result_type &k0, const result_type &k1) noexcept {
+    const result_type m0{0xD2511F53U};
+    const result_type m1{0xCD9E8D57U};
+    return {mulhi(m1, c[2]) ^ c[1] ^ k0, m1 * c[2], mulhi(m0, c[0]) ^ c[3] ^ k1, m0 * c[0]};
+  }
+
+  std::uint32_t key_[2];
+  std::uint64_t stream_;
+  std::uint64_t counter_{};
+  std::array<result_type, 8U> buffer_{};
+  std::size_t index_{8U};
+};
+
+/// @brief Generator of random bits, xoshiro128+ of Blackman and Vigna with simd<std::uint32_t>::size() independent
+/// lanes.
+///
+/// Each lane is a xoshiro128+ state, a step is a few shifts, xors and an addition on all lanes at once. Lane 0 is
+/// seeded by splitmix64 and lane i is lane 0 advanced by i jumps of 2^64 steps, i.e., the lanes never overlap.
+/// long_jump() advances all lanes by 2^96 steps to start further non-overlapping sequences, e.g., one per thread.
+/// The lowest bits are of lower quality, prefer the upper bits, e.g., by uniform_float().
+template <typename Abi = simd_abi::compatible<std::uint32_t>> class xoshiro128plus {
+public:
+  using result_type = simd<std::uint32_t, Abi>;
+
+  /// @brief Initializes the lanes from seed.
+  constexpr explicit xoshiro128plus(std::uint64_t seed) noexcept {
+    constexpr std::size_t size{result_type::size()};
+    const std::uint64_t a{detail::splitmix64(seed)};
+    const std::uint64_t b{detail::splitmix64(seed)};
+    std::array<std::uint32_t, 4U> lane{static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(a >> 32),
+                                       static_cast<std::uint32_t>(b), static_cast<std::uint32_t>(b >> 32)};
+    std::array<std::array<std::uint32_t, size>, 4U> state{};
+    for (std::size_t i{}; i < size; ++i) {
+      for (std::size_t j{}; j < 4U; ++j) {
+        state[j][i] = lane[j];
+      }
+      detail::xoshiro128_jump(lane, detail::xoshiro128_jump_polynomial);
+    }
+    for (std::size_t j{}; j < 4U; ++j) {
+      s_[j].copy_from(state[j].data(), element_aligned);
+    }
+  }
+
+  /// @brief Returns the next size() random values.
+  constexpr result_type operator()() noexcept {
+    const result_type r{s_[0] + s_[3]};
+    detail::xoshiro128_step(s_);
+    return r;
+  }
+
+  /// @brief Advances all lanes by 2^96 steps.
+  constexpr void long_jump() noexcept { detail::xoshiro128_jump(s_, detail::xoshiro128_long_jump_polynomial); }
+
+private:
+  std::array<result_type, 4U> s_;
+};
+
+/// @brief Returns the floats in [0, 1) given by the upper 23 bits of the elements of x.
+///
+/// The bits are the mantissa of a float in [1, 2) from which 1 is subtracted, i.e., a shift, an or and a subtraction
+/// instead of an integer conversion and a division. The values are the multiples of 2^-23.
+template <typename Abi> constexpr simd<float, Abi> uniform_float(const simd<std::uint32_t, Abi> &x) noexcept {
+  return detail::one_to_two(x) - simd<float, Abi>{1.0F};
+}
+
+/// @brief Returns two vectors of independent standard normal floats computed from two vectors of random bits by the
+/// Box-Muller transform.
+///
+/// The radius sqrt(-2 log(u)) is computed from u in (0, 1] given by the upper 23 bits of a, i.e., the values are
+/// bounded by 5.64 in magnitude. The angle is given by all bits of b. The logarithm, sine and cosine are polynomial
+/// approximations with a relative error of a few ulp.
+template <typename Abi>
+std::pair<simd<float, Abi>, simd<float, Abi>> box_muller(const simd<std::uint32_t, Abi> &a,
+                                                          const simd<std::uint32_t, Abi> &b) noexcept {
+  using V = simd<float, Abi>;
+  const V radius{sqrt(V{-2.0F} * detail::log(V{2.0F} - detail::one_to_two(a)))};
+  const std::pair<V, V> cos_sin{detail::cos_sin_turn(b)};
+  return {radius * cos_sin.first, radius * cos_sin.second};
+}
+
+/// @brief Fills [first, last) with floats uniformly distributed in [0, 1) from the random bits of g.
+///
+/// G is philox4x32, xoshiro128plus or any generator returning simd<std::uint32_t>.
+template <typename G> void simd_generate_uniform(G &g, float *first, float *const last) {
+  using V = simd<float, typename G::result_type::abi_type>;
+  constexpr std::size_t size{V::size()};
+
+  for (; static_cast<std::size_t>(last - first) >= size; first += size) {
+    uniform_float(g()).copy_to(first, element_aligned);
+  }
+  if (first != last) {
+    const V v{uniform_float(g())};
+    for (std::size_t i{}; first != last; ++first, ++i) {
+      *first = v[i];
+    }
+  }
+}
+
+/// @brief Fills [first, last) with standard normal floats by box_muller() from the random bits of g.
+///
+/// G is philox4x32, xoshiro128plus or any generator returning simd<std::uint32_t>.
+template <typename G> void simd_generate_normal(G &g, float *first, float *const last) {
+  using V = simd<float, typename G::result_type::abi_type>;
+  constexpr std::size_t size{V::size()};
+
+  for (; static_cast<std::size_t>(last - first) >= 2U * size; first += 2U * size) {
+    const typename G::result_type a{g()};
+    const std::pair<V, V> z{box_muller(a, g())};
+    z.first.copy_to(first, element_aligned);
+    z.second.copy_to(first + size, element_aligned);
+  }
+  if (first != last) {
+    const typename G::result_type a{g()};
+    const std::pair<V, V> z{box_muller(a, g())};
+    for (std::size_t i{}; first != last; ++first, ++i) {
+      *first = (i < size) ? z.first[i] : z.second[i - size];
+    }
+  }
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_RANDOM_H
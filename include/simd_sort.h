@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_SORT_H
+#define SIMD_SORT_H
+
+#include "simd.h"
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace detail {
+
+template <typename T, typename Abi> constexpr simd<T, Abi> reverse(const simd<T, Abi> &v) noexcept {
+  return shuffle<3U, 2U, 1U, 0U>(v, v);
+}
+
+// sorts a bitonic sequence of four elements by compare-exchanging at distance 2 and then at distance 1
+template <typename T, typename Abi> constexpr simd<T, Abi> bitonic_merge(simd<T, Abi> v) noexcept {
+  simd<T, Abi> p{shuffle<2U, 3U, 0U, 1U>(v, v)};
+  v = shuffle<0U, 1U, 6U, 7U>(::parallelism_v2::min(v, p), ::parallelism_v2::max(v, p));
+  p = shuffle<1U, 0U, 3U, 2U>(v, v);
+  return shuffle<0U, 5U, 2U, 7U>(::parallelism_v2::min(v, p), ::parallelism_v2::max(v, p));
+}
+
+} // namespace detail
+
+/// @brief Sorts the four elements of a in ascending order.
+///
+/// The elements are ordered pairwise into a bitonic sequence which is then sorted by a bitonic merge. Each of the three
+/// stages is a compare-exchange of a with a permutation of itself, i.e., a shuffle, min, max and a blending shuffle.
+template <typename T, typename Abi> constexpr void sorting_network(simd<T, Abi> &a) noexcept {
+  static_assert(simd_size_v<T, Abi> == 4U, "network written for four elements");
+  const simd<T, Abi> p{shuffle<1U, 0U, 3U, 2U>(a, a)};
+  a = detail::bitonic_merge(shuffle<0U, 5U, 6U, 3U>(::parallelism_v2::min(a, p), ::parallelism_v2::max(a, p)));
+}
+
+/// @brief Merges the sorted elements of a and b such that a holds the four smallest and b the four largest elements,
+/// both in ascending order.
+template <typename T, typename Abi> constexpr void bitonic_merge(simd<T, Abi> &a, simd<T, Abi> &b) noexcept {
+  static_assert(simd_size_v<T, Abi> == 4U, "network written for four elements");
+  const simd<T, Abi> r{detail::reverse(b)};
+  b = detail::bitonic_merge(::parallelism_v2::max(a, r));
+  a = detail::bitonic_merge(::parallelism_v2::min(a, r));
+}
+
+/// @brief Sorts the eight elements of a and b in ascending order, a holds the four smallest elements.
+template <typename T, typename Abi> constexpr void sorting_network(simd<T, Abi> &a, simd<T, Abi> &b) noexcept {
+  sorting_network(a);
+  sorting_network(b);
+  bitonic_merge(a, b);
+}
+
+/// @brief Sorts the sixteen elements of a, b, c and d in ascending order, a holds the four smallest elements.
+template <typename T, typename Abi>
+constexpr void sorting_network(simd<T, Abi> &a, simd<T, Abi> &b, simd<T, Abi> &c, simd<T, Abi> &d) noexcept {
+  sorting_network(a, b);
+  sorting_network(c, d);
+
+  // compare the first run with the reversed second run, which leaves two bitonic sequences of eight elements
+  const simd<T, Abi> rc{detail::reverse(c)};
+  const simd<T, Abi> rd{detail::reverse(d)};
+  const simd<T, Abi> l1{::parallelism_v2::min(a, rd)};
+  const simd<T, Abi> l2{::parallelism_v2::min(b, rc)};
+  const simd<T, Abi> h1{::parallelism_v2::max(a, rd)};
+  const simd<T, Abi> h2{::parallelism_v2::max(b, rc)};
+
+  a = detail::bitonic_merge(::parallelism_v2::min(l1, l2));
+  b = detail::bitonic_merge(::parallelism_v2::max(l1, l2));
+  c = detail::bitonic_merge(::parallelism_v2::min(h1, h2));
+  d = detail::bitonic_merge(::parallelism_v2::max(h1, h2));
+}
+
+namespace detail {
+
+// Merges the sorted runs [a, a_last) and [b, b_last), whose lengths are multiples of simd<T, Abi>::size(), into out.
+// Keeps the four largest elements seen so far in a register. Each step loads the next four elements from the run
+// whose next element is smaller, merges them with the register and writes out the four smallest.
+template <typename T, typename Abi>
+void merge(const T *a, const T *const a_last, const T *b, const T *const b_last, T *out) noexcept {
+  using V = simd<T, Abi>;
+  constexpr std::size_t size{V::size()};
+
+  V x;
+  V y;
+  x.copy_from(a, element_aligned);
+  y.copy_from(b, element_aligned);
+  a += size;
+  b += size;
+  ::parallelism_v2::bitonic_merge(x, y);
+  x.copy_to(out, element_aligned);
+  out += size;
+
+  while ((a != a_last) && (b != b_last)) {
+    const bool from_a{*a < *b};
+    x.copy_from(from_a ? a : b, element_aligned);
+    a += from_a ? size : 0U;
+    b += from_a ? 0U : size;
+    ::parallelism_v2::bitonic_merge(x, y);
+    x.copy_to(out, element_aligned);
+    out += size;
+  }
+  for (; a != a_last; a += size, out += size) {
+    x.copy_from(a, element_aligned);
+    ::parallelism_v2::bitonic_merge(x, y);
+    x.copy_to(out, element_aligned);
+  }
+  for (; b != b_last; b += size, out += size) {
+    x.copy_from(b, element_aligned);
+    ::parallelism_v2::bitonic_merge(x, y);
+    x.copy_to(out, element_aligned);
+  }
+  y.copy_to(out, element_aligned);
+}
+
+} // namespace detail
+
+/// @brief Sorts [first, last) in ascending order.
+///
+/// Blocks of sixteen elements are sorted with sorting_network and then merged bottom-up with the bitonic_merge kernel,
+/// alternating between two temporary buffers. The buffers are padded to a multiple of sixteen elements with the
+/// greatest value of T. The sort is not stable.
+///
+/// @pre [first, last) does not contain NaN.
+template <typename T, typename Abi = simd_abi::fixed_size<4>> void simd_sort(T *const first, T *const last) {
+  using V = simd<T, Abi>;
+  constexpr std::size_t size{V::size()};
+  constexpr std::size_t block{4U * size};
+  constexpr T padding{std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                          : std::numeric_limits<T>::max()};
+
+  const std::ptrdiff_t n{last - first};
+  if (n < 2) {
+    return;
+  }
+  const std::size_t m{(static_cast<std::size_t>(n) + block - 1U) / block * block};
+  std::vector<T> buffer(2U * m, padding);
+  T *from{buffer.data()};
+  T *to{buffer.data() + m};
+  std::copy(first, last, from);
+
+  for (std::size_t i{}; i < m; i += block) {
+    V a;
+    V b;
+    V c;
+    V d;
+    a.copy_from(from + i, element_aligned);
+    b.copy_from(from + i + size, element_aligned);
+    c.copy_from(from + i + 2U * size, element_aligned);
+    d.copy_from(from + i + 3U * size, element_aligned);
+    sorting_network(a, b, c, d);
+    a.copy_to(from + i, element_aligned);
+    b.copy_to(from + i + size, element_aligned);
+    c.copy_to(from + i + 2U * size, element_aligned);
+    d.copy_to(from + i + 3U * size, element_aligned);
+  }
+
+  for (std::size_t width{block}; width < m; width *= 2U) {
+    for (std::size_t i{}; i < m; i += 2U * width) {
+      const std::size_t middle{std::min(i + width, m)};
+      const std::size_t end{std::min(i + 2U * width, m)};
+      if (middle == end) {
+        std::copy(from + i, from + end, to + i);
+      } else {
+        detail::merge<T, Abi>(from + i, from + middle, from + middle, from + end, to + i);
+      }
+    }
+    std::swap(from, to);
+  }
+
+  std::copy(from, from + n, first);
+}
+
+} // namespace parallelism_v2
+
+#endif // SIMD_SORT_H
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef SIMD_STRING_H
+#define SIMD_STRING_H
+
+#include "simd_algorithm.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SANITIZE_ADDRESS__)
+#define SIMD_ADDRESS_SANITIZER
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SIMD_ADDRESS_SANITIZER
+#endif
+#endif
+
+namespace parallelism_v2 {
+namespace detail {
+
+// Memory is mapped in pages, reading any byte of a page which contains a readable byte cannot fault. The address
+// sanitizer reports such reads outside of an object nevertheless, hence they are avoided in sanitized builds.
+constexpr std::uintptr_t page_size{4096U};
+#if defined(SIMD_ADDRESS_SANITIZER)
+constexpr bool read_within_page{false};
+#else
+constexpr bool read_within_page{true};
+#endif
+
+// Loads the n < size() remaining bytes of a range. The register is loaded directly if it does not cross a page
+// boundary, in which case the elements past the end are unspecified and have to be masked by the caller. Otherwise
+// the bytes are copied to a buffer first.
+template <typename V> V load_tail(const char *const first, const std::size_t n) noexcept {
+  static_assert(page_size % V::size() == 0U, "register crosses pages");
+  V v;
+  if (read_within_page && (bit_cast<std::uintptr_t>(first) % page_size <= page_size - V::size())) {
+    v.copy_from(first, element_aligned);
+  } else {
+    char buffer[V::size()]{};
+    std::memcpy(buffer, first, n);
+    v.copy_from(buffer, element_aligned);
+  }
+  return v;
+}
+
+// the characters of set in the first elements, the other elements are zero
+template <typename V> V load_set(const std::string_view set) {
+  ENSURES(set.size() <= V::size());
+  char buffer[V::size()]{};
+  std::memcpy(buffer, set.data(), set.size());
+  V v;
+  v.copy_from(buffer, element_aligned);
+  return v;
+}
+
+// simd_find_if on the chunks of [first, last), the remaining bytes at the end are loaded by load_tail
+template <typename Abi, typename Predicate>
+const char *find_if_page_safe(const char *const first, const char *const last, Predicate pred) {
+  using V = simd<char, Abi>;
+  const std::size_t n{static_cast<std::size_t>(last - first)};
+  const std::size_t tail{n % V::size()};
+  const char *const body_last{last - tail};
+
+  const char *const r{simd_find_if<char, Abi>(first, body_last, pred)};
+  if ((r != body_last) || (tail == 0U)) {
+    return r;
+  }
+  const typename V::mask_type m{pred(load_tail<V>(body_last, tail)) && first_n<char, Abi>(tail)};
+  return any_of(m) ? body_last + find_first_set(m) : last;
+}
+
+} // namespace detail
+
+/// @brief Returns the first occurrence of c in [first, last), or last if there is none.
+///
+/// No page past the end of the range is touched.
+template <typename Abi = simd_abi::compatible<char>>
+const char *simd_memchr(const char *const first, const char *const last, const char c) {
+  using V = simd<char, Abi>;
+  return detail::find_if_page_safe<Abi>(first, last, [c](const V &v) { return v == V{c}; });
+}
+
+/// @brief Returns the first occurrence of c in the null-terminated string s, or nullptr if there is none.
+///
+/// As for std::strchr, the terminating null character is part of the string. The loads are aligned to the register
+/// size such that they never cross a page boundary, the bytes before s are masked.
+template <typename Abi = simd_abi::compatible<char>> const char *simd_strchr(const char *const s, const char c) {
+  using V = simd<char, Abi>;
+  using M = typename V::mask_type;
+  constexpr std::size_t size{V::size()};
+
+  if constexpr (!detail::read_within_page) {
+    const char *const last{s + std::strlen(s) + 1U};
+    const char *const r{simd_memchr<Abi>(s, last, c)};
+    return (r != last) ? r : nullptr;
+  }
+
+  const std::size_t offset{detail::bit_cast<std::uintptr_t>(s) % size};
+  const char *p{s - offset};
+  V v;
+  v.copy_from(p, element_aligned);
+  M m{((v == V{c}) || (v == V{'\0'})) && !detail::first_n<char, Abi>(offset)};
+  while (none_of(m)) {
+    p += size;
+    v.copy_from(p, element_aligned);
+    m = (v == V{c}) || (v == V{'\0'});
+  }
+  const char *const r{p + find_first_set(m)};
+  return (*r == c) ? r : nullptr;
+}
+
+/// @brief Returns the first character in [first, last) which is equal to any of the characters in set, or last if
+/// there is none.
+///
+/// Each chunk is compared to the whole set at once by is_any_of, i.e., by PCMPESTRM with SSE4.2. No page past the end
+/// of the range is touched.
+///
+/// @pre set.size() <= simd<char, Abi>::size()
+template <typename Abi = simd_abi::compatible<char>>
+const char *simd_find_first_of(const char *const first, const char *const last, const std::string_view set) {
+  using V = simd<char, Abi>;
+  const V s{detail::load_set<V>(set)};
+  const std::size_t n{set.size()};
+  return detail::find_if_page_safe<Abi>(first, last, [&s, n](const V &v) { return is_any_of(v, s, n); });
+}
+
+/// @brief Splits [first, last) into the tokens between any of the delimiter characters.
+///
+/// N delimiters in the range separate N + 1 tokens, which may be empty. The tokens refer to the range.
+///
+/// Usage: `for (std::string_view token; tokenizer.next(token);) { ... }`.
+template <typename Abi = simd_abi::compatible<char>> class simd_tokenizer {
+  using V = simd<char, Abi>;
+
+public:
+  /// @brief Tokenize [first, last) at the characters in delimiters.
+  ///
+  /// @pre delimiters.size() <= simd<char, Abi>::size()
+  simd_tokenizer(const char *const first, const char *const last, const std::string_view delimiters)
+      : position_{first}, last_{last}, delimiters_{detail::load_set<V>(delimiters)}, count_{delimiters.size()} {}
+
+  /// @brief Stores the next token in token and returns true, returns false if there is no token left.
+  bool next(std::string_view &token) {
+    if (done_) {
+      return false;
+    }
+    const V &delimiters{delimiters_};
+    const std::size_t count{count_};
+    const char *const end{detail::find_if_page_safe<Abi>(
+        position_, last_, [&delimiters, count](const V &v) { return is_any_of(v, delimiters, count); })};
+    token = std::string_view{position_, static_cast<std::size_t>(end - position_)};
+    done_ = (end == last_);
+    position_ = done_ ? last_ : end + 1;
+    return true;
+  }
+
+private:
+  const char *position_;
+  const char *const last_;
+  const V delimiters_;
+  const std::size_t count_;
+  bool done_{false};
+};
+
+} // namespace parallelism_v2
+
+#endif // SIMD_STRING_H
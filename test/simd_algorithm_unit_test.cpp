@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_algorithm.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+TEST(simd_algorithm, InclusiveScan) {
+  const fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{1.0F, 3.0F, 6.0F, 10.0F} == inclusive_scan(a)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{-1.0F, -3.0F, -6.0F, -10.0F} == inclusive_scan(-a)));
+
+  constexpr fixed_size_simd<float, 4> b{inclusive_scan(fixed_size_simd<float, 4>{1.0F, 1.0F, 1.0F, 1.0F})};
+  static_assert(4.0F == extract<3U>(b), "not constant evaluated");
+}
+
+TEST(simd_algorithm, ExclusiveScan) {
+  const fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{0.0F, 1.0F, 3.0F, 6.0F} == exclusive_scan(a)));
+
+  constexpr fixed_size_simd<float, 4> b{exclusive_scan(fixed_size_simd<float, 4>{1.0F, 1.0F, 1.0F, 1.0F})};
+  static_assert(0.0F == extract<0U>(b), "not constant evaluated");
+  static_assert(3.0F == extract<3U>(b), "not constant evaluated");
+}
+
+TEST(simd_algorithm, RangeInclusiveScan) {
+  for (std::size_t n{}; n < 42U; ++n) {
+    std::vector<float> input(n);
+    for (std::size_t i{}; i < n; ++i) {
+      input[i] = static_cast<float>(i % 5U) - 2.0F;
+    }
+    std::vector<float> expected(n);
+    std::inclusive_scan(input.begin(), input.end(), expected.begin());
+
+    std::vector<float> output(n);
+    EXPECT_EQ(output.data() + n, simd_inclusive_scan(input.data(), input.data() + n, output.data()));
+    EXPECT_EQ(expected, output);
+
+    simd_inclusive_scan(input.data(), input.data() + n, input.data());
+    EXPECT_EQ(expected, input);
+  }
+}
+
+TEST(simd_algorithm, FindIf) {
+  const auto negative = [](const simd<float> &v) { return v < simd<float>{0.0F}; };
+  for (std::size_t n{}; n < 20U; ++n) {
+    for (std::size_t position{}; position <= n; ++position) {
+      std::vector<float> input(n, 1.0F);
+      if (position < n) {
+        input[position] = -1.0F;
+      }
+      EXPECT_EQ(input.data() + position, simd_find_if(input.data(), input.data() + n, negative));
+    }
+  }
+
+  const std::vector<float> input{1.0F, 2.0F, -3.0F, 4.0F, -5.0F, 6.0F};
+  EXPECT_EQ(input.data() + 2U, simd_find_if(input.data(), input.data() + input.size(), negative));
+  EXPECT_EQ(input.data() + 4U, simd_find_if(input.data() + 3U, input.data() + input.size(), negative));
+}
+
+TEST(simd_algorithm, CountIf) {
+  for (std::size_t n{}; n < 42U; ++n) {
+    std::vector<std::int32_t> input(n);
+    std::iota(input.begin(), input.end(), -10);
+    const std::ptrdiff_t expected{std::count_if(input.begin(), input.end(), [](const auto x) { return x > 3; })};
+    EXPECT_EQ(expected, simd_count_if(input.data(), input.data() + n,
+                                      [](const simd<std::int32_t> &v) { return v > simd<std::int32_t>{3}; }));
+  }
+}
+
+TEST(simd_algorithm, MinMaxElement) {
+  for (std::size_t n{}; n < 42U; ++n) {
+    std::vector<float> input(n);
+    for (std::size_t i{}; i < n; ++i) {
+      input[i] = static_cast<float>((i * 7U) % 11U);
+    }
+    const float *const first{input.data()};
+    const float *const last{input.data() + n};
+
+    EXPECT_EQ(std::min_element(first, last), simd_min_element(first, last));
+    EXPECT_EQ(std::max_element(first, last), simd_max_element(first, last));
+  }
+}
+
+TEST(simd_algorithm, MinMaxElement_WhenNan_ThenIgnored) {
+  const float nan{std::numeric_limits<float>::quiet_NaN()};
+  const std::vector<float> input{3.0F, nan, 1.0F, nan, 5.0F, 1.0F, nan, 2.0F, 0.5F};
+  const float *const first{input.data()};
+  const float *const last{input.data() + input.size()};
+
+  EXPECT_EQ(first + 8U, simd_min_element(first, last));
+  EXPECT_EQ(first + 4U, simd_max_element(first, last));
+  EXPECT_EQ(first + 1U, simd_min_element(first + 1U, last));
+}
+
+TEST(simd_algorithm, Argmin) {
+  const auto distance = [](const simd<float> &v) {
+    const simd<float> d{v - simd<float>{2.4F}};
+    return d * d;
+  };
+  const std::vector<float> input{9.0F, -1.0F, 2.0F, 7.0F, 3.0F, 2.5F, 2.5F, 0.0F, 4.0F};
+
+  EXPECT_EQ(5, simd_argmin(input.data(), input.data() + input.size(), distance));
+  EXPECT_EQ(2, simd_argmin(input.data(), input.data() + 5U, distance));
+  EXPECT_EQ(0, simd_argmin(input.data(), input.data(), distance));
+}
+
+} // namespace
+} // namespace parallelism_v2
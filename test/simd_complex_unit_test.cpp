@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_complex.h"
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+namespace parallelism_v2 {
+namespace {
+
+using C = complex_simd<float>;
+using V = simd<float>;
+
+C Iota(const float offset) {
+  std::array<std::complex<float>, C::size()> v;
+  for (std::size_t i{}; i < C::size(); ++i) {
+    v[i] = std::complex<float>{offset + static_cast<float>(i), 2.0F - static_cast<float>(i)};
+  }
+  C r;
+  r.copy_from(v.data(), element_aligned);
+  return r;
+}
+
+TEST(complex_simd, Interleaved) {
+  std::array<std::complex<float>, C::size()> v;
+  for (std::size_t i{}; i < C::size(); ++i) {
+    v[i] = std::complex<float>{static_cast<float>(i), -static_cast<float>(i) - 0.5F};
+  }
+  C c;
+  c.copy_from(v.data(), element_aligned);
+  for (std::size_t i{}; i < C::size(); ++i) {
+    EXPECT_EQ(v[i], c[i]);
+    EXPECT_EQ(v[i].real(), c.real()[i]);
+    EXPECT_EQ(v[i].imag(), c.imag()[i]);
+  }
+
+  std::array<std::complex<float>, C::size()> w;
+  c.copy_to(w.data(), element_aligned);
+  EXPECT_EQ(v, w);
+}
+
+TEST(complex_simd, Split) {
+  std::array<float, C::size()> re;
+  std::array<float, C::size()> im;
+  for (std::size_t i{}; i < C::size(); ++i) {
+    re[i] = static_cast<float>(i);
+    im[i] = 10.0F + static_cast<float>(i);
+  }
+  C c;
+  c.copy_from(re.data(), im.data(), element_aligned);
+  for (std::size_t i{}; i < C::size(); ++i) {
+    EXPECT_EQ((std::complex<float>{re[i], im[i]}), c[i]);
+  }
+
+  std::array<float, C::size()> re2;
+  std::array<float, C::size()> im2;
+  c.copy_to(re2.data(), im2.data(), element_aligned);
+  EXPECT_EQ(re, re2);
+  EXPECT_EQ(im, im2);
+}
+
+TEST(complex_simd, Arithmetic) {
+  const C a{Iota(1.0F)};
+  const C b{Iota(-3.0F)};
+
+  for (std::size_t i{}; i < C::size(); ++i) {
+    EXPECT_EQ(a[i] + b[i], (a + b)[i]);
+    EXPECT_EQ(a[i] - b[i], (a - b)[i]);
+    EXPECT_EQ(-a[i], (-a)[i]);
+    EXPECT_NEAR(0.0F, std::abs(a[i] * b[i] - (a * b)[i]), 1e-5F) << i;
+    EXPECT_NEAR(0.0F, std::abs(a[i] / b[i] - (a / b)[i]), 1e-5F) << i;
+    EXPECT_EQ(std::conj(a[i]), conj(a)[i]);
+    EXPECT_EQ(std::norm(a[i]), norm(a)[i]);
+    EXPECT_FLOAT_EQ(std::abs(a[i]), abs(a)[i]);
+  }
+
+  const C i{std::complex<float>{0.0F, 1.0F}};
+  EXPECT_TRUE(all_of(V{-1.0F} == (i * i).real()));
+  EXPECT_TRUE(all_of(V{0.0F} == (i * i).imag()));
+}
+
+TEST(complex_simd, MultiplyInterleaved) {
+  using F = fixed_size_simd<float, 4>;
+  const std::complex<float> x{1.0F, 2.0F};
+  const std::complex<float> y{-3.0F, 0.5F};
+  const std::complex<float> u{2.0F, -1.0F};
+  const std::complex<float> v{4.0F, 3.0F};
+
+  const F r{multiply_interleaved(F{x.real(), x.imag(), y.real(), y.imag()}, F{u.real(), u.imag(), v.real(), v.imag()})};
+
+  EXPECT_EQ(x * u, (std::complex<float>{extract<0U>(r), extract<1U>(r)}));
+  EXPECT_EQ(y * v, (std::complex<float>{extract<2U>(r), extract<3U>(r)}));
+}
+
+TEST(complex_simd, ConstantEvaluated) {
+  constexpr C a{V{1.0F}, V{2.0F}};
+  constexpr C b{conj(a) * a};
+  static_assert(5.0F == extract<0U>(b.real()), "not constant evaluated");
+  static_assert(0.0F == extract<0U>(b.imag()), "not constant evaluated");
+  static_assert(5.0F == extract<0U>(norm(a)), "not constant evaluated");
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(complex_simd, Subscript_WhenOutOfRange_ThenPreconditionViolated) {
+  const C a{V{1.0F}, V{2.0F}};
+
+  EXPECT_THROW(a[C::size()], parallelism_v2::detail::condition_violated);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_compression.h"
+#include "simd_algorithm.h"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+// the bit widths are distributed uniformly such that every byte length of Stream VByte occurs
+std::vector<std::uint32_t> Random(const std::size_t n, const unsigned bits, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::vector<std::uint32_t> v(n);
+  for (std::uint32_t &x : v) {
+    const unsigned width{(bits == 0U) ? 0U : static_cast<unsigned>(engine() % bits) + 1U};
+    x = (width == 0U) ? 0U : static_cast<std::uint32_t>(engine()) >> (32U - width);
+  }
+  return v;
+}
+
+TEST(simd_compression, BitpackBits) {
+  const std::vector<std::uint32_t> v{1U, 2U, 4U, 8U, 0U, 0U, 0U};
+  EXPECT_EQ(4U, bitpack_bits(v.data(), v.data() + v.size()));
+  EXPECT_EQ(1U, bitpack_bits(v.data(), v.data() + 1U));
+  EXPECT_EQ(0U, bitpack_bits(v.data() + 4U, v.data() + v.size()));
+  const std::uint32_t max{0xFFFFFFFFU};
+  EXPECT_EQ(32U, bitpack_bits(&max, &max + 1U));
+}
+
+TEST(simd_compression, Bitpack) {
+  for (unsigned bits{}; bits <= 32U; ++bits) {
+    for (const std::size_t n : {std::size_t{0U}, std::size_t{1U}, bitpack_block_size<> - 1U, bitpack_block_size<>,
+                                3U * bitpack_block_size<> + 7U}) {
+      const std::vector<std::uint32_t> input{Random(n, bits, bits)};
+      ASSERT_LE(bitpack_bits(input.data(), input.data() + n), bits);
+      std::vector<std::uint32_t> packed(bitpack_words(n, bits) + 1U, 0xDEADBEEFU);
+      EXPECT_EQ(packed.data() + bitpack_words(n, bits), bitpack(input.data(), input.data() + n, bits, packed.data()));
+      EXPECT_EQ(0xDEADBEEFU, packed.back());
+
+      std::vector<std::uint32_t> output(n + 1U, 0xDEADBEEFU);
+      EXPECT_EQ(packed.data() + bitpack_words(n, bits), bitunpack(packed.data(), n, bits, output.data()));
+      EXPECT_EQ(0xDEADBEEFU, output.back());
+      output.pop_back();
+      EXPECT_EQ(input, output) << bits << " bits, " << n << " integers";
+    }
+  }
+}
+
+TEST(simd_compression, Bitpack_WhenLayout_ThenLanesVertical) {
+  // a single block of 2 bits, integer i has the value i % 4
+  std::vector<std::uint32_t> input(bitpack_block_size<>);
+  for (std::size_t i{}; i < input.size(); ++i) {
+    input[i] = static_cast<std::uint32_t>(i % 4U);
+  }
+  std::vector<std::uint32_t> packed(bitpack_words(input.size(), 2U));
+  bitpack(input.data(), input.data() + input.size(), 2U, packed.data());
+  // lane j holds the integers j, j + size, j + 2 * size, ... from the least significant bit
+  const std::size_t size{simd<std::uint32_t>::size()};
+  for (std::size_t j{}; j < size; ++j) {
+    std::uint32_t expected{};
+    for (std::size_t r{}; r < 16U; ++r) {
+      expected |= static_cast<std::uint32_t>((r * size + j) % 4U) << (2U * r);
+    }
+    EXPECT_EQ(expected, packed[j]);
+  }
+}
+
+TEST(simd_compression, BitunpackDelta) {
+  std::vector<std::uint32_t> sorted(1000U);
+  std::mt19937 engine{42U};
+  std::uint32_t x{};
+  for (std::uint32_t &v : sorted) {
+    x += engine() % 100U;
+    v = x;
+  }
+  std::vector<std::uint32_t> deltas(sorted.size());
+  EXPECT_EQ(deltas.data() + deltas.size(), delta_encode(sorted.data(), sorted.data() + sorted.size(), deltas.data()));
+  const unsigned bits{bitpack_bits(deltas.data(), deltas.data() + deltas.size())};
+  EXPECT_EQ(7U, bits);
+
+  std::vector<std::uint32_t> packed(bitpack_words(deltas.size(), bits));
+  bitpack(deltas.data(), deltas.data() + deltas.size(), bits, packed.data());
+  std::vector<std::uint32_t> output(sorted.size());
+  bitunpack_delta(packed.data(), output.size(), bits, output.data());
+  EXPECT_EQ(sorted, output);
+}
+
+TEST(simd_compression, DeltaEncode) {
+  for (std::size_t n{}; n < 19U; ++n) {
+    std::vector<std::uint32_t> input(n);
+    for (std::size_t i{}; i < n; ++i) {
+      input[i] = static_cast<std::uint32_t>(i * i);
+    }
+    input.push_back(0U); // wraps around
+    std::vector<std::uint32_t> output(input.size());
+    delta_encode(input.data(), input.data() + input.size(), output.data());
+    for (std::size_t i{}; i < input.size(); ++i) {
+      EXPECT_EQ(input[i] - ((i == 0U) ? 0U : input[i - 1U]), output[i]);
+    }
+
+    // in place and restored by the inclusive scan
+    delta_encode(input.data(), input.data() + input.size(), input.data());
+    EXPECT_EQ(output, input);
+    simd_inclusive_scan(input.data(), input.data() + input.size(), input.data());
+    for (std::size_t i{}; i < n; ++i) {
+      EXPECT_EQ(i * i, input[i]);
+    }
+  }
+}
+
+TEST(simd_compression, StreamVByte) {
+  for (const std::size_t n : {0U, 1U, 3U, 4U, 5U, 63U, 64U, 1001U}) {
+    const std::vector<std::uint32_t> input{Random(n, 32U, static_cast<unsigned>(n))};
+    // exactly sized, i.e., the loads at the end must not read past it
+    std::vector<std::uint8_t> buffer(stream_vbyte_max_bytes(n));
+    const std::uint8_t *const end{stream_vbyte_encode(input.data(), input.data() + n, buffer.data())};
+    const std::vector<std::uint8_t> encoded(buffer.cbegin(), buffer.cbegin() + (end - buffer.data()));
+
+    std::vector<std::uint32_t> output(n + 1U, 0xDEADBEEFU);
+    EXPECT_EQ(encoded.data() + encoded.size(),
+              stream_vbyte_decode(encoded.data(), encoded.data() + encoded.size(), n, output.data()));
+    EXPECT_EQ(0xDEADBEEFU, output.back());
+    output.pop_back();
+    EXPECT_EQ(input, output) << n << " integers";
+  }
+}
+
+TEST(simd_compression, StreamVByte_WhenEncoded_ThenFormat) {
+  const std::vector<std::uint32_t> input{0x01U, 0x0302U, 0x060504U, 0x0A090807U, 0x0BU};
+  std::vector<std::uint8_t> encoded(stream_vbyte_max_bytes(input.size()));
+  const std::uint8_t *const end{stream_vbyte_encode(input.data(), input.data() + input.size(), encoded.data())};
+  encoded.resize(static_cast<std::size_t>(end - encoded.data()));
+  EXPECT_EQ((std::vector<std::uint8_t>{0xE4U, 0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U,
+                                       0x0AU, 0x0BU}),
+            encoded);
+}
+
+TEST(simd_compression, StreamVByteDelta) {
+  const std::vector<std::uint32_t> sorted{3U, 7U, 7U, 300U, 70000U, 70001U, 20000000U, 4000000000U, 4000000001U};
+  std::vector<std::uint32_t> deltas(sorted.size());
+  delta_encode(sorted.data(), sorted.data() + sorted.size(), deltas.data());
+  std::vector<std::uint8_t> encoded(stream_vbyte_max_bytes(deltas.size()));
+  const std::uint8_t *const end{stream_vbyte_encode(deltas.data(), deltas.data() + deltas.size(), encoded.data())};
+
+  std::vector<std::uint32_t> output(sorted.size());
+  EXPECT_EQ(end, stream_vbyte_decode_delta(encoded.data(), end, output.size(), output.data()));
+  EXPECT_EQ(sorted, output);
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_compression, WhenInvalidArguments_ThenPreconditionViolated) {
+  std::uint32_t x{};
+  const std::uint8_t control{};
+  EXPECT_THROW(bitpack(&x, &x + 1U, 33U, &x), detail::condition_violated);
+  EXPECT_THROW(bitunpack(&x, 1U, 33U, &x), detail::condition_violated);
+  EXPECT_THROW(stream_vbyte_decode(&control, &control, 1U, &x), detail::condition_violated);
+}
+
+TEST(simd_compression, StreamVByte_WhenControlBytesPastEnd_ThenPreconditionViolated) {
+  // the control bytes of 8 integers of 4 bytes each, followed by the data of a single integer
+  const std::uint8_t encoded[]{0xFFU, 0xFFU, 1U, 0U, 0U, 0U};
+  std::uint32_t out[9U]{};
+  EXPECT_THROW(stream_vbyte_decode(encoded, encoded + sizeof(encoded), 8U, out), detail::condition_violated);
+  EXPECT_THROW(stream_vbyte_decode(encoded, encoded + sizeof(encoded), 5U, out), detail::condition_violated);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
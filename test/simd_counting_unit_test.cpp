@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_counting.h"
+#include "simd_lut.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <thread>
+
+namespace parallelism_v2 {
+namespace {
+
+using Abi = simd_abi::counting<simd_abi::compatible<float>>;
+using V = simd<float, Abi>;
+using I = simd<std::int32_t, Abi>;
+using M = simd_mask<float, Abi>;
+
+TEST(simd_counting, WhenOperations_ThenCounted) {
+  std::array<float, 4U> memory{1.0F, 2.0F, 3.0F, 4.0F};
+  const simd_operation_counts start{simd_operation_counters()};
+
+  V a;
+  a.copy_from(memory.data(), element_aligned);
+  const V b{2.0F};
+  V c{fma(a, b, a) + b};
+  where(c > V{5.0F}, c) = V{0.0F};
+  EXPECT_FLOAT_EQ(0.0F, c[3]);
+  c.copy_to(memory.data(), element_aligned);
+
+  const simd_operation_counts counts{simd_operation_counters() - start};
+  EXPECT_EQ(1U, counts[simd_operation::load]);
+  EXPECT_EQ(3U, counts[simd_operation::broadcast]);
+  EXPECT_EQ(1U, counts[simd_operation::fma]);
+  EXPECT_EQ(1U, counts[simd_operation::add]);
+  EXPECT_EQ(1U, counts[simd_operation::greater_than]);
+  EXPECT_EQ(1U, counts[simd_operation::blend]);
+  EXPECT_EQ(1U, counts[simd_operation::extract]);
+  EXPECT_EQ(1U, counts[simd_operation::store]);
+  EXPECT_EQ(10U, counts.total());
+  EXPECT_EQ((std::array<float, 4U>{5.0F, 0.0F, 0.0F, 0.0F}), memory);
+}
+
+TEST(simd_counting, WhenMaskOperations_ThenCounted) {
+  const simd_operation_counts start{simd_operation_counters()};
+
+  const M m{V{1.0F, 2.0F, 3.0F, 4.0F} < V{3.0F}};
+  EXPECT_TRUE(any_of(m && !m) || all_of(m || M{true}));
+  EXPECT_EQ(2, popcount(m));
+
+  const simd_operation_counts counts{simd_operation_counters() - start};
+  EXPECT_EQ(1U, counts[simd_operation::less_than]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_logical_not]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_logical_and]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_logical_or]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_broadcast]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_any_of]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_all_of]);
+  EXPECT_EQ(1U, counts[simd_operation::mask_popcount]);
+
+  // counted on its own, its precondition calls any_of depending on the contract level
+  const simd_operation_counts before_find{simd_operation_counters()};
+  EXPECT_EQ(0, find_first_set(m));
+  EXPECT_EQ(1U, (simd_operation_counters() - before_find)[simd_operation::mask_find_first_set]);
+}
+
+TEST(simd_counting, WhenTemplateOperations_ThenCounted) {
+  const simd_operation_counts start{simd_operation_counters()};
+
+  const V a{1.0F, 2.0F, 3.0F, 4.0F};
+  EXPECT_EQ(4.0F, extract<0U>(shuffle<3U, 2U, 1U, 0U>(a, a)));
+  EXPECT_EQ(9.0F, extract<1U>(insert<1U>(a, 9.0F)));
+  EXPECT_EQ(3, extract<2U>(static_simd_cast<std::int32_t>(a)));
+
+  const simd_operation_counts counts{simd_operation_counters() - start};
+  EXPECT_EQ(1U, counts[simd_operation::shuffle]);
+  EXPECT_EQ(1U, counts[simd_operation::insert]);
+  EXPECT_EQ(1U, counts[simd_operation::convert_to_int32]);
+  EXPECT_EQ(3U, counts[simd_operation::extract]);
+}
+
+TEST(simd_counting, WhenExistingCode_ThenSameResultsAndCounted) {
+  constexpr std::array<float, 9U> y{0.0F, 1.0F, 4.0F, 9.0F, 16.0F, 25.0F, 36.0F, 49.0F, 64.0F};
+  const simd_lut<9U> lut{y, 0.0F, 8.0F};
+  const simd_lut<9U, Abi> counting_lut{y, 0.0F, 8.0F};
+  const simd_operation_counts start{simd_operation_counters()};
+
+  const V r{counting_lut.linear(V{0.5F, 2.25F, 7.0F, -1.0F})};
+
+  const simd<float> expected{lut.linear(simd<float>{0.5F, 2.25F, 7.0F, -1.0F})};
+  for (std::size_t i{}; i < V::size(); ++i) {
+    EXPECT_EQ(expected[i], r[i]);
+  }
+  const simd_operation_counts counts{simd_operation_counters() - start};
+  EXPECT_EQ(4U, counts[simd_operation::permute]); // 2 registers of segments for 2 coefficients
+  EXPECT_EQ(2U, counts[simd_operation::blend]);
+  EXPECT_EQ(0U, counts[simd_operation::gather]);
+}
+
+TEST(simd_counting, WhenScope_ThenWritesCounts) {
+  std::ostringstream os;
+  {
+    counting_scope outer{"outer", os};
+    const V a{1.0F};
+    {
+      counting_scope inner{"inner", os};
+      EXPECT_EQ(8.0F, reduce(a + a));
+      EXPECT_EQ(2U, inner.counts().total());
+    }
+    EXPECT_EQ(3U, outer.counts().total());
+  }
+  EXPECT_EQ("inner: add=1 reduce=1\nouter: broadcast=1 add=1 reduce=1\n", os.str());
+}
+
+TEST(simd_counting, WhenOtherThread_ThenNotCounted) {
+  const simd_operation_counts start{simd_operation_counters()};
+  std::thread t{[] {
+    const V a{1.0F};
+    EXPECT_EQ(4.0F, reduce(a));
+    EXPECT_EQ(2U, simd_operation_counters().total());
+  }};
+  t.join();
+  EXPECT_EQ(0U, (simd_operation_counters() - start).total());
+}
+
+TEST(simd_counting, WhenConstantEvaluated_ThenSame) {
+  constexpr V a{fma(V{2.0F}, V{3.0F}, V{1.0F})};
+  static_assert(7.0F == extract<0U>(a), "not constant evaluated");
+  EXPECT_EQ("add", to_string(simd_operation::add));
+  EXPECT_EQ("mask_all_of", to_string(simd_operation::mask_all_of));
+  EXPECT_EQ("shuffle", to_string(simd_operation::shuffle));
+}
+
+} // namespace
+} // namespace parallelism_v2
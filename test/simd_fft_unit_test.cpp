@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_fft.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<std::complex<float>> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<std::complex<float>> v(n);
+  for (std::complex<float> &x : v) {
+    x = {distribution(engine), distribution(engine)};
+  }
+  return v;
+}
+
+// the textbook DFT in double precision, sign is -1 for the forward and 1 for the inverse transform
+std::vector<std::complex<float>> Dft(const std::vector<std::complex<float>> &x, const double sign) {
+  const std::size_t n{x.size()};
+  std::vector<std::complex<float>> y(n);
+  for (std::size_t k{}; k < n; ++k) {
+    std::complex<double> sum{};
+    for (std::size_t j{}; j < n; ++j) {
+      const double angle{sign * 2.0 * 3.14159265358979323846 * static_cast<double>((j * k) % n) /
+                         static_cast<double>(n)};
+      sum += std::complex<double>{x[j]} * std::complex<double>{std::cos(angle), std::sin(angle)};
+    }
+    y[k] = std::complex<float>{sum};
+  }
+  return y;
+}
+
+// the error of the FFT in float grows with log(n), the magnitudes of the bins with sqrt(n)
+void ExpectNear(const std::vector<std::complex<float>> &expected, const std::complex<float> *const actual) {
+  const float tolerance{1e-5F * std::sqrt(static_cast<float>(expected.size())) *
+                        std::log2(static_cast<float>(expected.size()) + 1.0F)};
+  for (std::size_t i{}; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i].real(), actual[i].real(), tolerance) << i;
+    ASSERT_NEAR(expected[i].imag(), actual[i].imag(), tolerance) << i;
+  }
+}
+
+// powers of four and of two, smaller than a vectorized pass and with the passes of every stride
+constexpr std::size_t sizes[]{1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 256U, 512U, 1024U, 2048U, 4096U};
+
+TEST(simd_fft, Forward) {
+  for (const std::size_t n : sizes) {
+    const std::vector<std::complex<float>> x{Random(n, 1U)};
+    std::vector<std::complex<float>> y(n);
+    simd_fft<> fft{n};
+    EXPECT_EQ(n, fft.size());
+    fft.forward(x.data(), y.data());
+    ExpectNear(Dft(x, -1.0), y.data());
+  }
+}
+
+TEST(simd_fft, Inverse) {
+  for (const std::size_t n : sizes) {
+    const std::vector<std::complex<float>> x{Random(n, 2U)};
+    std::vector<std::complex<float>> y(n);
+    simd_fft<> fft{n};
+    fft.inverse(x.data(), y.data());
+    ExpectNear(Dft(x, 1.0), y.data());
+  }
+}
+
+TEST(simd_fft, WhenInPlace_ThenRoundTrip) {
+  for (const std::size_t n : sizes) {
+    const std::vector<std::complex<float>> x{Random(n, 3U)};
+    std::vector<std::complex<float>> y{x};
+    simd_fft<> fft{n};
+    fft.forward(y.data(), y.data());
+    fft.inverse(y.data(), y.data());
+    for (std::complex<float> &v : y) {
+      v /= static_cast<float>(n);
+    }
+    ExpectNear(x, y.data());
+  }
+}
+
+TEST(simd_fft, Batch) {
+  // a partial group of transforms and more than one group, of the small sizes the batches are meant for
+  for (const std::size_t n : sizes) {
+    if (n > 256U) {
+      continue;
+    }
+    for (const std::size_t count : {1U, 3U, 9U}) {
+      const std::vector<std::complex<float>> x{Random(n * count, 4U)};
+      std::vector<std::complex<float>> y(n * count);
+      simd_fft<> fft{n};
+      fft.forward(x.data(), y.data(), count);
+      for (std::size_t t{}; t < count; ++t) {
+        ExpectNear(Dft({&x[t * n], &x[(t + 1U) * n]}, -1.0), &y[t * n]);
+      }
+      fft.inverse(x.data(), y.data(), count);
+      for (std::size_t t{}; t < count; ++t) {
+        ExpectNear(Dft({&x[t * n], &x[(t + 1U) * n]}, 1.0), &y[t * n]);
+      }
+    }
+  }
+}
+
+TEST(simd_fft, RealForward) {
+  for (const std::size_t n : sizes) {
+    if (n < 2U) {
+      continue;
+    }
+    const std::vector<std::complex<float>> random{Random(n, 5U)};
+    std::vector<float> x(n);
+    std::vector<std::complex<float>> complex(n);
+    for (std::size_t i{}; i < n; ++i) {
+      x[i] = random[i].real();
+      complex[i] = x[i];
+    }
+    std::vector<std::complex<float>> y(n / 2U + 1U);
+    simd_real_fft<> fft{n};
+    EXPECT_EQ(n, fft.size());
+    fft.forward(x.data(), y.data());
+    std::vector<std::complex<float>> expected{Dft(complex, -1.0)};
+    expected.resize(n / 2U + 1U);
+    ExpectNear(expected, y.data());
+  }
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_fft, WhenNotPowerOfTwo_ThenPreconditionViolated) {
+  EXPECT_THROW(simd_fft<>{0U}, detail::condition_violated);
+  EXPECT_THROW(simd_fft<>{12U}, detail::condition_violated);
+  EXPECT_THROW(simd_real_fft<>{1U}, detail::condition_violated);
+  EXPECT_THROW(simd_real_fft<>{6U}, detail::condition_violated);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_filter.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<float> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> distribution{0.0F, 1.0F};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+std::size_t Clamp(const std::ptrdiff_t i, const std::size_t n) {
+  return static_cast<std::size_t>(std::min(std::max(i, std::ptrdiff_t{0}), static_cast<std::ptrdiff_t>(n) - 1));
+}
+
+// the textbook 2D convolution with repeated borders, kernel[i][j] weights in[y + i - M / 2][x + j - N / 2]
+std::vector<float> Convolve2D(const std::vector<float> &kernel, const std::size_t m, const std::size_t n,
+                              const std::vector<float> &in, const std::size_t width, const std::size_t height) {
+  std::vector<float> out(width * height);
+  for (std::size_t y{}; y < height; ++y) {
+    for (std::size_t x{}; x < width; ++x) {
+      double sum{};
+      for (std::size_t i{}; i < m; ++i) {
+        for (std::size_t j{}; j < n; ++j) {
+          const std::size_t yy{Clamp(static_cast<std::ptrdiff_t>(y + i) - static_cast<std::ptrdiff_t>(m / 2U), height)};
+          const std::size_t xx{Clamp(static_cast<std::ptrdiff_t>(x + j) - static_cast<std::ptrdiff_t>(n / 2U), width)};
+          sum += double{kernel[i * n + j]} * in[yy * width + xx];
+        }
+      }
+      out[y * width + x] = static_cast<float>(sum);
+    }
+  }
+  return out;
+}
+
+template <std::size_t N, std::size_t M>
+std::vector<float> Outer(const std::array<float, N> &row, const std::array<float, M> &column) {
+  std::vector<float> k(M * N);
+  for (std::size_t i{}; i < M; ++i) {
+    for (std::size_t j{}; j < N; ++j) {
+      k[i * N + j] = column[i] * row[j];
+    }
+  }
+  return k;
+}
+
+void ExpectNear(const std::vector<float> &expected, const std::vector<float> &actual, const float tolerance) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t i{}; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i], actual[i], tolerance) << i;
+  }
+}
+
+// narrow, wide and wider than a strip, also narrower than the kernels
+constexpr std::array<std::size_t, 6U> widths{1U, 2U, 5U, 37U, 512U, 1100U};
+constexpr std::array<std::size_t, 4U> heights{1U, 2U, 9U, 31U};
+
+constexpr std::array<float, 5U> gaussian{0.0625F, 0.25F, 0.375F, 0.25F, 0.0625F};
+constexpr std::array<float, 3U> derivative{-1.0F, 0.0F, 1.0F};
+constexpr std::array<float, 3U> smooth{1.0F, 2.0F, 1.0F};
+
+TEST(simd_filter, ConvolveRows) {
+  for (const std::size_t width : widths) {
+    for (const std::size_t height : heights) {
+      const std::vector<float> in{Random(width * height, 1U)};
+      std::vector<float> out(width * height);
+      simd_convolve_rows(gaussian, width, height, in.data(), width, out.data(), width);
+      ExpectNear(Convolve2D({gaussian.begin(), gaussian.end()}, 1U, 5U, in, width, height), out, 1e-5F);
+    }
+  }
+}
+
+TEST(simd_filter, ConvolveColumns) {
+  for (const std::size_t width : widths) {
+    for (const std::size_t height : heights) {
+      const std::vector<float> in{Random(width * height, 2U)};
+      std::vector<float> out(width * height);
+      simd_convolve_columns(gaussian, width, height, in.data(), width, out.data(), width);
+      ExpectNear(Convolve2D({gaussian.begin(), gaussian.end()}, 5U, 1U, in, width, height), out, 1e-5F);
+    }
+  }
+}
+
+TEST(simd_filter, SeparableFilter) {
+  for (const std::size_t width : widths) {
+    for (const std::size_t height : heights) {
+      const std::vector<float> in{Random(width * height, 3U)};
+      std::vector<float> out(width * height);
+      simd_separable_filter(derivative, smooth, width, height, in.data(), width, out.data(), width);
+      ExpectNear(Convolve2D(Outer(derivative, smooth), 3U, 3U, in, width, height), out, 1e-5F);
+      simd_separable_filter(gaussian, derivative, width, height, in.data(), width, out.data(), width);
+      ExpectNear(Convolve2D(Outer(gaussian, derivative), 3U, 5U, in, width, height), out, 1e-5F);
+    }
+  }
+}
+
+TEST(simd_filter, SeparableFilter_WhenStrides_ThenPaddingUntouched) {
+  const std::size_t width{13U};
+  const std::size_t height{7U};
+  const std::vector<float> image{Random(width * height, 4U)};
+  std::vector<float> in(20U * height, -1.0F);
+  for (std::size_t y{}; y < height; ++y) {
+    std::copy(&image[y * width], &image[(y + 1U) * width], &in[y * 20U]);
+  }
+  std::vector<float> out(16U * height, 42.0F);
+  simd_separable_filter(gaussian, gaussian, width, height, in.data(), 20U, out.data(), 16U);
+  const std::vector<float> expected{Convolve2D(Outer(gaussian, gaussian), 5U, 5U, image, width, height)};
+  for (std::size_t y{}; y < height; ++y) {
+    for (std::size_t x{}; x < 16U; ++x) {
+      EXPECT_NEAR((x < width) ? expected[y * width + x] : 42.0F, out[y * 16U + x], 1e-5F);
+    }
+  }
+}
+
+TEST(simd_filter, BoxFilter) {
+  for (const std::size_t radius : {0U, 1U, 3U, 20U}) {
+    const std::size_t n{2U * radius + 1U};
+    const std::vector<float> kernel(n, 1.0F / static_cast<float>(n));
+    for (const std::size_t width : widths) {
+      for (const std::size_t height : heights) {
+        const std::vector<float> in{Random(width * height, 5U)};
+        std::vector<float> out(width * height);
+        simd_box_filter(radius, width, height, in.data(), width, out.data(), width);
+        // the box is separable, the textbook convolution with the 1D kernels keeps the test fast for large radii
+        ExpectNear(Convolve2D(kernel, n, 1U, Convolve2D(kernel, 1U, n, in, width, height), width, height), out, 1e-4F);
+      }
+    }
+  }
+}
+
+TEST(simd_filter, WhenEmptyImage_ThenNothingWritten) {
+  const std::vector<float> in(4U, 1.0F);
+  std::vector<float> out(4U, 42.0F);
+  for (const auto [width, height] : {std::array<std::size_t, 2U>{4U, 0U}, std::array<std::size_t, 2U>{0U, 4U}}) {
+    simd_convolve_rows(smooth, width, height, in.data(), 4U, out.data(), 4U);
+    simd_convolve_columns(smooth, width, height, in.data(), 4U, out.data(), 4U);
+    simd_separable_filter(smooth, smooth, width, height, in.data(), 4U, out.data(), 4U);
+    simd_box_filter(1U, width, height, in.data(), 4U, out.data(), 4U);
+  }
+  EXPECT_EQ(std::vector<float>(4U, 42.0F), out);
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_filter, WhenInvalidStride_ThenPreconditionViolated) {
+  const std::vector<float> in(16U);
+  std::vector<float> out(16U);
+  EXPECT_THROW(simd_convolve_rows(smooth, 4U, 4U, in.data(), 3U, out.data(), 4U), detail::condition_violated);
+  EXPECT_THROW(simd_convolve_columns(smooth, 4U, 4U, in.data(), 4U, out.data(), 3U), detail::condition_violated);
+  EXPECT_THROW(simd_separable_filter(smooth, smooth, 4U, 4U, in.data(), 3U, out.data(), 4U),
+               detail::condition_violated);
+  EXPECT_THROW(simd_box_filter(1U, 4U, 4U, in.data(), 4U, out.data(), 3U), detail::condition_violated);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_hash.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+// one bit at a time, the textbook definition
+std::uint32_t Crc32c(const char *first, const char *const last, std::uint32_t crc = 0U) {
+  crc = ~crc;
+  for (; first != last; ++first) {
+    crc ^= static_cast<std::uint8_t>(*first);
+    for (int i{}; i < 8; ++i) {
+      crc = ((crc & 1U) != 0U) ? (crc >> 1) ^ 0x82F63B78U : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+std::vector<char> Random(const std::size_t n) {
+  std::mt19937 engine{42U};
+  std::uniform_int_distribution<int> distribution{-128, 127};
+  std::vector<char> v(n);
+  for (char &c : v) {
+    c = static_cast<char>(distribution(engine));
+  }
+  return v;
+}
+
+TEST(simd_hash, HashMix) {
+  EXPECT_EQ(0U, hash_mix(0U));
+  EXPECT_EQ(0x514E28B7U, hash_mix(1U));
+
+  using V = simd<std::uint32_t>;
+  V keys{0U};
+  for (std::size_t i{}; i < V::size(); ++i) {
+    keys[i] = static_cast<std::uint32_t>(i * 0x9E3779B9U);
+  }
+  const V hashes{hash_mix(keys)};
+  for (std::size_t i{}; i < V::size(); ++i) {
+    EXPECT_EQ(hash_mix(keys[i]), hashes[i]);
+  }
+
+  static_assert(0x514E28B7U == extract<0U>(hash_mix(V{1U})), "not constant evaluated");
+}
+
+TEST(simd_hash, RangeHash) {
+  for (const std::size_t n : {0U, 1U, 3U, 4U, 17U, 1000U}) {
+    std::vector<std::uint32_t> keys(n);
+    for (std::size_t i{}; i < n; ++i) {
+      keys[i] = static_cast<std::uint32_t>(i * i);
+    }
+    std::vector<std::uint32_t> hashes(n);
+
+    EXPECT_EQ(hashes.data() + n, simd_hash(keys.data(), keys.data() + n, hashes.data()));
+    for (std::size_t i{}; i < n; ++i) {
+      EXPECT_EQ(hash_mix(keys[i]), hashes[i]) << n << " " << i;
+    }
+  }
+}
+
+TEST(simd_hash, Crc32c) {
+  const std::string_view check{"123456789"};
+  EXPECT_EQ(0xE3069283U, simd_crc32c(check.data(), check.data() + check.size()));
+  EXPECT_EQ(0U, simd_crc32c(check.data(), check.data()));
+
+  // lengths around the block sizes of the interleaved streams
+  const std::vector<char> v{Random(3U * 8192U + 3U * 256U + 21U)};
+  for (const std::size_t n : {1U, 7U, 8U, 767U, 768U, 769U, 24575U, 24576U, 25365U}) {
+    EXPECT_EQ(Crc32c(v.data(), v.data() + n), simd_crc32c(v.data(), v.data() + n)) << n;
+  }
+}
+
+TEST(simd_hash, Crc32c_WhenContinued_ThenSameAsWhole) {
+  const std::vector<char> v{Random(30000U)};
+  const char *const middle{v.data() + 12345};
+  const std::uint32_t crc{simd_crc32c(v.data(), middle)};
+
+  EXPECT_EQ(simd_crc32c(v.data(), v.data() + v.size()), simd_crc32c(middle, v.data() + v.size(), crc));
+}
+
+TEST(simd_hash, Crc32cZeros) {
+  const std::vector<char> zeros(256U);
+  for (const std::uint32_t crc : {0U, 1U, 0xDEADBEEFU}) {
+    // the register is not inverted for the zero bytes, hence the inversions around the checksum
+    EXPECT_EQ(~simd_crc32c(zeros.data(), zeros.data() + zeros.size(), ~crc), detail::crc32c_zeros<256U>(crc));
+  }
+}
+
+} // namespace
+} // namespace parallelism_v2
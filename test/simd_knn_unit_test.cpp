@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_knn.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<float> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+float Distance(const knn_metric metric, const float *const q, const float *const x, const std::size_t dim) {
+  double l2{};
+  double dot{};
+  double qq{};
+  double xx{};
+  for (std::size_t j{}; j < dim; ++j) {
+    l2 += (double{x[j]} - q[j]) * (double{x[j]} - q[j]);
+    dot += double{x[j]} * q[j];
+    qq += double{q[j]} * q[j];
+    xx += double{x[j]} * x[j];
+  }
+  switch (metric) {
+  case knn_metric::squared_l2:
+    return static_cast<float>(l2);
+  case knn_metric::inner_product:
+    return static_cast<float>(-dot);
+  case knn_metric::cosine:
+    return static_cast<float>(1.0 - dot / std::sqrt(qq * xx));
+  }
+  return 0.0F;
+}
+
+std::vector<knn_neighbor> BruteForce(const knn_metric metric, const float *const q, const std::vector<float> &database,
+                                     const std::size_t dim, const std::size_t k) {
+  std::vector<knn_neighbor> r;
+  for (std::size_t i{}; i < database.size() / dim; ++i) {
+    r.push_back({i, Distance(metric, q, &database[i * dim], dim)});
+  }
+  std::stable_sort(r.begin(), r.end(), [](const auto &a, const auto &b) { return a.distance < b.distance; });
+  r.resize(std::min(k, r.size()));
+  return r;
+}
+
+constexpr knn_metric metrics[]{knn_metric::squared_l2, knn_metric::inner_product, knn_metric::cosine};
+
+TEST(simd_knn, Distances) {
+  // full and partial blocks of rows and chunks
+  for (const knn_metric metric : metrics) {
+    for (const std::size_t dim : {1U, 3U, 4U, 7U, 64U, 67U}) {
+      for (const std::size_t count : {1U, 3U, 4U, 9U}) {
+        const std::vector<float> q{Random(dim, 1U)};
+        const std::vector<float> database{Random(count * dim, 2U)};
+        std::vector<float> d(count);
+        knn_distances(metric, q.data(), database.data(), count, dim, d.data());
+        for (std::size_t i{}; i < count; ++i) {
+          EXPECT_NEAR(Distance(metric, q.data(), &database[i * dim], dim), d[i], 1e-4F);
+        }
+      }
+    }
+  }
+}
+
+TEST(simd_knn, Distances_WhenZeroVector_ThenCosineIsOne) {
+  const std::vector<float> q{1.0F, 2.0F, 3.0F};
+  const std::vector<float> database{0.0F, 0.0F, 0.0F, 2.0F, 4.0F, 6.0F, -1.0F, -2.0F, -3.0F};
+  std::vector<float> d(3U);
+  knn_distances(knn_metric::cosine, q.data(), database.data(), 3U, 3U, d.data());
+  EXPECT_EQ(1.0F, d[0]);
+  EXPECT_NEAR(0.0F, d[1], 1e-6F);
+  EXPECT_NEAR(2.0F, d[2], 1e-6F);
+}
+
+TEST(simd_knn, Distances_WhenHalfPrecision_ThenConverted) {
+  const std::size_t dim{37U};
+  const std::size_t count{6U};
+  const std::vector<float> q{Random(dim, 3U)};
+  const std::vector<float> database{Random(count * dim, 4U)};
+
+  // rounds the database to half precision and back
+  using V = simd<float>;
+  const std::size_t n{(count * dim + V::size() - 1U) / V::size() * V::size()};
+  std::vector<std::uint16_t> half(n);
+  std::vector<float> rounded(n);
+  std::copy(database.begin(), database.end(), rounded.begin());
+  for (std::size_t i{}; i < n; i += V::size()) {
+    V v;
+    v.copy_from(&rounded[i], element_aligned);
+    v.copy_to(&half[i], float16);
+    v.copy_from(&half[i], float16);
+    v.copy_to(&rounded[i], element_aligned);
+  }
+
+  for (const knn_metric metric : metrics) {
+    std::vector<float> d(count);
+    std::vector<float> expected(count);
+    knn_distances(metric, q.data(), half.data(), count, dim, d.data());
+    knn_distances(metric, q.data(), rounded.data(), count, dim, expected.data());
+    for (std::size_t i{}; i < count; ++i) {
+      EXPECT_NEAR(expected[i], d[i], 1e-5F);
+      EXPECT_NEAR(Distance(metric, q.data(), &database[i * dim], dim), d[i], 1e-2F);
+    }
+  }
+}
+
+TEST(simd_knn, Search) {
+  const std::size_t dim{19U};
+  const std::size_t count{1000U};
+  const std::vector<float> database{Random(count * dim, 5U)};
+  const std::vector<float> q{Random(dim, 6U)};
+
+  for (const knn_metric metric : metrics) {
+    for (const std::size_t k : {0U, 1U, 10U, 999U, 1000U, 2000U}) {
+      const std::vector<knn_neighbor> expected{BruteForce(metric, q.data(), database, dim, k)};
+      for (const std::size_t threads : {1U, 3U, 8U}) {
+        const std::vector<knn_neighbor> r{knn_search(metric, q.data(), database.data(), count, dim, k, threads)};
+        ASSERT_EQ(expected.size(), r.size());
+        for (std::size_t i{}; i < r.size(); ++i) {
+          EXPECT_NEAR(expected[i].distance, r[i].distance, 1e-4F);
+          EXPECT_TRUE((i == 0U) || (r[i - 1U].distance <= r[i].distance));
+        }
+        if (!r.empty()) {
+          EXPECT_EQ(expected[0].index, r[0].index);
+        }
+      }
+    }
+  }
+}
+
+TEST(simd_knn, Search_WhenTies_ThenSmallerIndexFirst) {
+  // the vectors repeat every 7 vectors, i.e., every distance occurs several times across blocks and threads
+  const std::size_t dim{5U};
+  const std::size_t count{2000U};
+  std::vector<float> database(count * dim);
+  const std::vector<float> pattern{Random(7U * dim, 7U)};
+  for (std::size_t i{}; i < database.size(); ++i) {
+    database[i] = pattern[i % pattern.size()];
+  }
+  const std::vector<float> q{Random(dim, 8U)};
+
+  const std::vector<knn_neighbor> single{
+      knn_search(knn_metric::squared_l2, q.data(), database.data(), count, dim, 20U)};
+  ASSERT_EQ(20U, single.size());
+  for (std::size_t i{1U}; i < single.size(); ++i) {
+    EXPECT_TRUE((single[i - 1U].distance < single[i].distance) || (single[i - 1U].index < single[i].index));
+  }
+  EXPECT_EQ(single[1].index, single[0].index + 7U);
+
+  const std::vector<knn_neighbor> parallel{
+      knn_search(knn_metric::squared_l2, q.data(), database.data(), count, dim, 20U, 4U)};
+  for (std::size_t i{}; i < single.size(); ++i) {
+    EXPECT_EQ(single[i].index, parallel[i].index);
+    EXPECT_EQ(single[i].distance, parallel[i].distance);
+  }
+}
+
+TEST(simd_knn, Search_WhenNaN_ThenNotSelected) {
+  std::vector<float> database{1.0F, NAN, 2.0F, 3.0F};
+  const float q{0.0F};
+  const std::vector<knn_neighbor> r{knn_search(knn_metric::squared_l2, &q, database.data(), 4U, 1U, 4U)};
+  ASSERT_EQ(3U, r.size());
+  EXPECT_EQ(0U, r[0].index);
+  EXPECT_EQ(2U, r[1].index);
+  EXPECT_EQ(3U, r[2].index);
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_knn, WhenInvalidArguments_ThenPreconditionViolated) {
+  const float x{};
+  float d{};
+  EXPECT_THROW(knn_distances(knn_metric::squared_l2, &x, &x, 1U, 0U, &d), detail::condition_violated);
+  EXPECT_THROW(knn_search(knn_metric::squared_l2, &x, &x, 1U, 0U, 1U), detail::condition_violated);
+  EXPECT_THROW(knn_search(knn_metric::squared_l2, &x, &x, 1U, 1U, 1U, 0U), detail::condition_violated);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
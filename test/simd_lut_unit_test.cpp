@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_lut.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = simd<float>;
+
+template <std::size_t N, typename F> constexpr simd_lut<N> Tabulate(const F f, const float x0, const float x1) {
+  std::array<float, N> y{};
+  for (std::size_t k{}; k < N; ++k) {
+    y[k] = f(x0 + (x1 - x0) * static_cast<float>(k) / static_cast<float>(N - 1U));
+  }
+  return simd_lut<N>{y, x0, x1};
+}
+
+static_assert(simd_lut<2U>::in_registers, "one segment in registers");
+static_assert(simd_lut<4U * V::size() + 1U>::in_registers, "4 registers of segments in registers");
+static_assert(!simd_lut<4U * V::size() + 2U>::in_registers, "more segments in memory");
+
+template <std::size_t N> void ExpectLinear(const float x0, const float x1) {
+  const simd_lut<N> lut{Tabulate<N>([](const float x) { return 2.0F * x + 1.0F; }, x0, x1)};
+  for (float x{x0}; x <= x1; x += 0.0625F) {
+    EXPECT_NEAR(2.0F * x + 1.0F, lut.linear(V{x})[0], 1e-5F) << x;
+    EXPECT_NEAR(2.0F * x + 1.0F, lut.cubic(V{x})[0], 1e-5F) << x;
+  }
+}
+
+TEST(simd_lut, WhenLinearFunction_ThenExact) {
+  ExpectLinear<2U>(-1.0F, 3.0F);
+  ExpectLinear<5U>(-1.0F, 3.0F);
+  ExpectLinear<18U>(-1.0F, 3.0F);
+  ExpectLinear<101U>(-1.0F, 3.0F);
+}
+
+template <std::size_t N> void ExpectQuadratic() {
+  const simd_lut<N> lut{Tabulate<N>([](const float x) { return x * x; }, 0.0F, 1.0F)};
+  const float h{1.0F / static_cast<float>(N - 1U)};
+  // Catmull-Rom is exact for quadratics except in the first and last segment
+  for (float x{h}; x <= 1.0F - h; x += h / 8.0F) {
+    EXPECT_NEAR(x * x, lut.cubic(V{x})[0], 1e-6F) << x;
+  }
+}
+
+TEST(simd_lut, Cubic_WhenQuadraticFunction_ThenExactInInterior) {
+  ExpectQuadratic<9U>();
+  ExpectQuadratic<65U>();
+}
+
+template <std::size_t N> void ExpectSamples() {
+  std::array<float, N> y{};
+  for (std::size_t k{}; k < N; ++k) {
+    y[k] = static_cast<float>((k * 7U) % 5U);
+  }
+  const simd_lut<N> lut{y, 10.0F, 10.0F + static_cast<float>(N - 1U)};
+  for (std::size_t k{}; k < N; ++k) {
+    const V x{10.0F + static_cast<float>(k)};
+    EXPECT_EQ(y[k], lut.linear(x)[0]) << k;
+    EXPECT_EQ(y[k], lut.cubic(x)[0]) << k;
+  }
+}
+
+TEST(simd_lut, WhenSample_ThenSameAsSample) {
+  ExpectSamples<3U>();
+  ExpectSamples<12U>();
+  ExpectSamples<17U>();
+  ExpectSamples<300U>();
+}
+
+template <std::size_t N> void ExpectSin() {
+  const simd_lut<N> lut{Tabulate<N>([](const float x) { return std::sin(x); }, 0.0F, 3.0F)};
+  const float h{3.0F / static_cast<float>(N - 1U)};
+  for (std::size_t k{}; k + 1U < N; ++k) {
+    const float a{std::sin(static_cast<float>(k) * h)};
+    const float b{std::sin(static_cast<float>(k + 1U) * h)};
+    const V x{V{static_cast<float>(k) * h} + V{0.0F, 0.25F, 0.5F, 0.75F} * V{h}};
+    const V l{lut.linear(x)};
+    const V c{lut.cubic(x)};
+    for (std::size_t i{}; i < V::size(); ++i) {
+      const float t{(x[i] - static_cast<float>(k) * h) / h};
+      EXPECT_NEAR(a + t * (b - a), l[i], 1e-5F) << x[i];
+      // the cubic error is of the order h^3 instead of h^2
+      EXPECT_NEAR(std::sin(x[i]), c[i], 0.1F * h * h * h + 1e-6F) << x[i];
+    }
+  }
+}
+
+TEST(simd_lut, WhenSin_ThenInterpolated) {
+  ExpectSin<16U>();
+  ExpectSin<1024U>();
+}
+
+template <std::size_t N> void ExpectClamped() {
+  const simd_lut<N> lut{Tabulate<N>([](const float x) { return x * x * x; }, -1.0F, 2.0F)};
+  const float inf{std::numeric_limits<float>::infinity()};
+  const V x{-1.5F, 2.5F, -inf, inf};
+  EXPECT_TRUE(all_of(V{-1.0F, 8.0F, -1.0F, 8.0F} == lut.linear(x)));
+  EXPECT_TRUE(all_of(V{-1.0F, 8.0F, -1.0F, 8.0F} == lut.cubic(x)));
+  EXPECT_TRUE(all_of(is_nan(lut.linear(V{std::numeric_limits<float>::quiet_NaN()}))));
+  EXPECT_TRUE(all_of(is_nan(lut.cubic(V{std::numeric_limits<float>::quiet_NaN()}))));
+}
+
+TEST(simd_lut, WhenOutOfRange_ThenClamped) {
+  ExpectClamped<4U>();
+  ExpectClamped<100U>();
+}
+
+TEST(simd_lut, WhenConstantEvaluated_ThenSame) {
+  constexpr simd_lut<3U> small{{0.0F, 1.0F, 4.0F}, 0.0F, 2.0F};
+  static_assert(2.5F == extract<0U>(small.linear(V{1.5F})), "not constant evaluated");
+  static_assert(0.25F == extract<0U>(small.linear(V{0.25F})), "not constant evaluated");
+  constexpr simd_lut<30U> large{Tabulate<30U>([](const float x) { return x; }, 0.0F, 29.0F)};
+  static_assert(17.5F == extract<0U>(large.linear(V{17.5F})), "not constant evaluated");
+  static_assert(17.5F == extract<0U>(large.cubic(V{17.5F})), "not constant evaluated");
+}
+
+} // namespace
+} // namespace parallelism_v2
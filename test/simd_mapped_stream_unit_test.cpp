@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_mapped_stream.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = simd<float>;
+
+std::string Path(const std::string &name) { return testing::TempDir() + "simd_mapped_stream_" + name; }
+
+// removes the file of a test, also if an assertion ended the test early
+struct TemporaryFile {
+  explicit TemporaryFile(const std::string &name) : path{Path(name)} {}
+  TemporaryFile(const TemporaryFile &) = delete;
+  TemporaryFile &operator=(const TemporaryFile &) = delete;
+  ~TemporaryFile() { static_cast<void>(std::remove(path.c_str())); }
+
+  std::string path;
+};
+
+std::vector<float> ReadFile(const std::string &path) {
+  std::ifstream file{path, std::ios::binary | std::ios::ate};
+  std::vector<float> v(static_cast<std::size_t>(file.tellg()) / sizeof(float));
+  file.seekg(0);
+  file.read(reinterpret_cast<char *>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(float)));
+  return v;
+}
+
+void WriteFile(const std::string &path, const std::vector<float> &v) {
+  std::ofstream file{path, std::ios::binary};
+  file.write(reinterpret_cast<const char *>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(float)));
+}
+
+TEST(simd_mapped_stream, WhenWrittenAndRead_ThenSame) {
+  // spans a few windows of hints and ends with a tail
+  const std::size_t n{(std::size_t{3U} << 20) + 3U};
+  const TemporaryFile file{"round_trip"};
+  {
+    mapped_simd_output<float> output{file.path, n};
+    EXPECT_EQ(n, output.size());
+    V v{0.0F, 1.0F, 2.0F, 3.0F};
+    for (std::size_t i{}; i < n; i += V::size()) {
+      output.write(v, std::min(V::size(), n - i));
+      v += V{4.0F};
+    }
+    EXPECT_EQ(n, output.position());
+  }
+
+  const std::vector<float> expected{ReadFile(file.path)};
+  ASSERT_EQ(n, expected.size());
+  for (std::size_t i{}; i < n; ++i) {
+    ASSERT_EQ(static_cast<float>(i), expected[i]);
+  }
+
+  mapped_simd_stream<float> stream{file.path};
+  EXPECT_EQ(n, stream.size());
+  V v{0.0F};
+  std::size_t read{};
+  for (std::size_t k{}; (k = stream.read(v)) != 0U;) {
+    for (std::size_t i{}; i < k; ++i) {
+      ASSERT_EQ(static_cast<float>(read + i), v[i]);
+    }
+    read += k;
+  }
+  EXPECT_EQ(n, read);
+  EXPECT_EQ(n, stream.position());
+  EXPECT_EQ(0U, stream.read(v));
+}
+
+TEST(simd_mapped_stream, WhenTail_ThenFilled) {
+  const TemporaryFile file{"tail"};
+  WriteFile(file.path, {1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F});
+  mapped_simd_stream<float> stream{file.path};
+  V v{0.0F};
+  EXPECT_EQ(4U, stream.read(v));
+  EXPECT_TRUE(all_of(V{1.0F, 2.0F, 3.0F, 4.0F} == v));
+  EXPECT_EQ(2U, stream.read(v, -1.0F));
+  EXPECT_TRUE(all_of(V{5.0F, 6.0F, -1.0F, -1.0F} == v));
+  EXPECT_EQ(0U, stream.read(v));
+  EXPECT_TRUE(all_of(V{5.0F, 6.0F, -1.0F, -1.0F} == v));
+}
+
+TEST(simd_mapped_stream, WhenPartialElement_ThenIgnored) {
+  const TemporaryFile file{"partial"};
+  {
+    std::ofstream out{file.path, std::ios::binary};
+    const float x{7.0F};
+    out.write(reinterpret_cast<const char *>(&x), sizeof(x));
+    out.write("ab", 2);
+  }
+  mapped_simd_stream<float> stream{file.path};
+  EXPECT_EQ(1U, stream.size());
+  V v{0.0F};
+  EXPECT_EQ(1U, stream.read(v));
+  EXPECT_EQ(7.0F, v[0]);
+}
+
+TEST(simd_mapped_stream, WhenEmpty_ThenNothingRead) {
+  const TemporaryFile file{"empty"};
+  { mapped_simd_output<std::int32_t> output{file.path, 0U}; }
+  mapped_simd_stream<std::int32_t> stream{file.path};
+  EXPECT_EQ(0U, stream.size());
+  simd<std::int32_t> v{42};
+  EXPECT_EQ(0U, stream.read(v));
+  EXPECT_EQ(42, v[0]);
+}
+
+TEST(simd_mapped_stream, WhenMissingFile_ThenThrows) {
+  EXPECT_THROW(mapped_simd_stream<float>{Path("missing/file")}, std::system_error);
+  EXPECT_THROW((mapped_simd_output<float>{Path("missing/file"), 4U}), std::system_error);
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_mapped_stream, Write_WhenPartialChunkBeforeTail_ThenPreconditionViolated) {
+  const TemporaryFile file{"precondition"};
+  mapped_simd_output<float> output{file.path, 6U};
+  EXPECT_THROW(output.write(V{1.0F}, 2U), detail::condition_violated);
+  output.write(V{1.0F});
+  EXPECT_THROW(output.write(V{1.0F}), detail::condition_violated);
+  output.write(V{1.0F}, 2U);
+}
+#endif
+
+} // namespace
+} // namespace parallelism_v2
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "simd.h"
+#include <cstdint>
 #include <gtest/gtest.h>
 
 namespace parallelism_v2 {
@@ -47,11 +48,61 @@ TEST(simd_mask, Initialize) {
   }
 }
 
+TEST(simd_mask, ConstantEvaluated) {
+  constexpr fixed_size_simd_mask<float, 4> a{true, false, true, false};
+  constexpr fixed_size_simd_mask<float, 4> b{false};
+  static_assert(a[0U] && !a[1U] && a[2U] && !a[3U], "not constant evaluated");
+  static_assert(all_of(a || !a), "not constant evaluated");
+  static_assert(none_of(a && b), "not constant evaluated");
+  static_assert(any_of(a || b), "not constant evaluated");
+
+  EXPECT_TRUE(all_of(!b));
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
 TEST(simd_mask, Access_WhenOutOfBounds_ThenPreconditionViolated) {
   const fixed_size_simd_mask<float, 4> a{false};
 
   EXPECT_THROW(a[4U], parallelism_v2::detail::condition_violated);
 }
+#endif
+
+TEST(simd_mask, Convert) {
+  const fixed_size_simd_mask<float, 4> a{true, false, true, false};
+  const fixed_size_simd_mask<std::int32_t, 4> b{a};
+
+  EXPECT_TRUE(b[0U]);
+  EXPECT_FALSE(b[1U]);
+  EXPECT_TRUE(b[2U]);
+  EXPECT_FALSE(b[3U]);
+  EXPECT_TRUE(all_of(fixed_size_simd_mask<float, 4>{b} || !a));
+}
+
+TEST(simd_mask, Popcount) {
+  EXPECT_EQ(0, popcount(fixed_size_simd_mask<float, 4>{false}));
+  EXPECT_EQ(1, popcount(fixed_size_simd_mask<float, 4>{false, false, true, false}));
+  EXPECT_EQ(3, popcount(fixed_size_simd_mask<std::int32_t, 4>{true, false, true, true}));
+  EXPECT_EQ(4, popcount(fixed_size_simd_mask<float, 4>{true}));
+
+  static_assert(2 == popcount(fixed_size_simd_mask<float, 4>{true, false, false, true}), "not constant evaluated");
+}
+
+TEST(simd_mask, FindFirstSet) {
+  EXPECT_EQ(0, find_first_set(fixed_size_simd_mask<float, 4>{true}));
+  EXPECT_EQ(1, find_first_set(fixed_size_simd_mask<float, 4>{false, true, false, true}));
+  EXPECT_EQ(3, find_first_set(fixed_size_simd_mask<std::int32_t, 4>{false, false, false, true}));
+
+  constexpr fixed_size_simd_mask<float, 4> a{false, false, true, true};
+  static_assert(2 == find_first_set(a), "not constant evaluated");
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd_mask, FindFirstSet_WhenNoneSet_ThenPreconditionViolated) {
+  const fixed_size_simd_mask<float, 4> a{false};
+
+  EXPECT_THROW(find_first_set(a), parallelism_v2::detail::condition_violated);
+}
+#endif
 
 TEST(simd_mask, Not) {
   {
@@ -2,6 +2,10 @@
 
 #include "simd.h"
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
 
 namespace parallelism_v2 {
 namespace {
@@ -17,5 +21,135 @@ TEST(simd_math, IsNan) {
   EXPECT_TRUE(all_of(is_nan(-nan)));
 }
 
+// the elements of a mask as a string, e.g., "1001"
+std::string Bits(const fixed_size_simd_mask<float, 4> &m) {
+  std::string s;
+  for (std::size_t i{}; i < m.size(); ++i) {
+    s += m[i] ? '1' : '0';
+  }
+  return s;
+}
+
+TEST(simd_math, Classification) {
+  using V = fixed_size_simd<float, 4>;
+  const float inf{std::numeric_limits<float>::infinity()};
+  const float nan{std::numeric_limits<float>::quiet_NaN()};
+
+  EXPECT_EQ("1100", Bits(is_inf(V{inf, -inf, nan, 1.0F})));
+  EXPECT_EQ("0001", Bits(is_finite(V{inf, -inf, nan, -3e38F})));
+  EXPECT_EQ("0111", Bits(signbit(V{0.0F, -0.0F, -nan, -inf})));
+  EXPECT_TRUE(all_of(fixed_size_simd<std::int32_t, 4>{FP_NAN, FP_INFINITE, FP_ZERO, FP_SUBNORMAL} ==
+                     fpclassify(V{nan, -inf, -0.0F, 1e-40F})));
+  EXPECT_TRUE(all_of(fixed_size_simd<std::int32_t, 4>{FP_NORMAL} ==
+                     fpclassify(V{std::numeric_limits<float>::min(), -1.0F, 3e38F, -1e-37F})));
+}
+
+TEST(simd_math, AbsCopysign) {
+  using V = fixed_size_simd<float, 4>;
+  const float inf{std::numeric_limits<float>::infinity()};
+
+  const V a{abs(V{-0.0F, -2.5F, 3.0F, -inf})};
+  EXPECT_TRUE(all_of(V{0.0F, 2.5F, 3.0F, inf} == a));
+  EXPECT_TRUE(none_of(signbit(a)));
+  EXPECT_TRUE(all_of(V{-1.0F, 2.0F, -0.0F, inf} == copysign(V{1.0F, -2.0F, 0.0F, -inf}, V{-0.0F, 1.0F, -5.0F, 0.0F})));
+  EXPECT_TRUE(all_of(signbit(copysign(V{0.0F}, V{-1.0F}))));
+}
+
+TEST(simd_math, Rounding) {
+  using V = fixed_size_simd<float, 4>;
+  const V v{-2.5F, -0.5F, 0.5F, 1.5F};
+
+  EXPECT_TRUE(all_of(V{-3.0F, -1.0F, 0.0F, 1.0F} == floor(v)));
+  EXPECT_TRUE(all_of(V{-2.0F, -0.0F, 1.0F, 2.0F} == ceil(v)));
+  EXPECT_TRUE(all_of(V{-2.0F, -0.0F, 0.0F, 1.0F} == trunc(v)));
+  EXPECT_TRUE(all_of(V{-3.0F, -1.0F, 1.0F, 2.0F} == round(v)));
+  EXPECT_TRUE(all_of(signbit(V{ceil(v)[1], trunc(v)[1], round(V{-0.49999997F})[0], floor(V{-0.0F})[0]})));
+  EXPECT_TRUE(all_of(is_nan(round(V{std::numeric_limits<float>::quiet_NaN()}))));
+}
+
+TEST(simd_math, Rounding_WhenAllExponents_ThenSameAsStd) {
+  using V = fixed_size_simd<float, 4>;
+  for (std::uint64_t bits{}; bits < (1ULL << 32); bits += 0x3F1DU) {
+    const float f{detail::bit_cast<float>(static_cast<std::uint32_t>(bits))};
+    if (std::isnan(f)) {
+      continue;
+    }
+    const V v{f};
+    ASSERT_EQ(std::floor(f), floor(v)[0]) << f;
+    ASSERT_EQ(std::ceil(f), ceil(v)[0]) << f;
+    ASSERT_EQ(std::trunc(f), trunc(v)[0]) << f;
+    ASSERT_EQ(std::round(f), round(v)[0]) << f;
+    ASSERT_EQ(std::signbit(std::round(f)), signbit(round(v))[0]) << f;
+  }
+  for (float f{-4.0F}; f <= 4.0F; f += 0.125F) {
+    ASSERT_EQ(std::round(f), round(V{f})[0]) << f;
+    ASSERT_EQ(std::round(std::nextafter(f, 0.0F)), round(V{std::nextafter(f, 0.0F)})[0]) << f;
+  }
+}
+
+TEST(simd_math, Rounding_WhenConstantEvaluated_ThenSame) {
+  using V = fixed_size_simd<float, 4>;
+  constexpr V v{-2.5F, -0.5F, 0.5F, 1.5F};
+  static_assert(-3.0F == extract<0U>(floor(v)), "not constant evaluated");
+  static_assert(2.0F == extract<3U>(ceil(v)), "not constant evaluated");
+  static_assert(-2.0F == extract<0U>(trunc(v)), "not constant evaluated");
+  static_assert(1.0F == extract<2U>(round(v)), "not constant evaluated");
+  static_assert(-0.5F == extract<2U>(copysign(abs(v), v - V{1.0F})), "not constant evaluated");
+  static_assert(FP_ZERO == extract<0U>(fpclassify(V{0.0F})), "not constant evaluated");
+  static_assert(all_of(signbit(V{-0.0F})), "not constant evaluated");
+  static_assert(none_of(is_finite(V{std::numeric_limits<float>::infinity()})), "not constant evaluated");
+  static_assert(all_of(is_inf(V{-std::numeric_limits<float>::infinity()})), "not constant evaluated");
+}
+
+TEST(simd_math, Fma) {
+  const simd<float> nan{std::numeric_limits<float>::quiet_NaN()};
+  const simd<float> inf{std::numeric_limits<float>::infinity()};
+  const simd<float> two{2.0F};
+  const simd<float> three{3.0F};
+
+  EXPECT_TRUE(all_of(simd<float>{7.0F} == fma(two, three, simd<float>{1.0F})));
+  EXPECT_TRUE(all_of(simd<float>{-5.0F} == fma(-two, three, simd<float>{1.0F})));
+  EXPECT_TRUE(all_of(inf == fma(two, inf, three)));
+  EXPECT_TRUE(all_of(is_nan(fma(two, three, nan))));
+  EXPECT_TRUE(all_of(is_nan(fma(inf, simd<float>{0.0F}, three))));
+}
+
+TEST(simd_math, WhereAssignmentFma) {
+  fixed_size_simd<float, 4> value{6.0F, 9.0F, 16.0F, 25.0F};
+  const fixed_size_simd_mask<float, 4> mask{true, false, true, false};
+  const fixed_size_simd<float, 4> factor{2.0F, 3.0F, 4.0F, 5.0F};
+
+  where(mask, value) = fma(factor, factor, value);
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{10.0F, 9.0F, 32.0F, 25.0F} == value));
+}
+
+TEST(simd_math, Mulhi) {
+  using V = fixed_size_simd<std::uint32_t, 4>;
+  constexpr V a{0xFFFFFFFFU, 0x80000000U, 0xD2511F53U, 12345U};
+  constexpr V b{0xFFFFFFFFU, 2U, 0x243F6A88U, 6789U};
+
+  EXPECT_TRUE(all_of(V{0xFFFFFFFEU, 1U, 0x1DC781E3U, 0U} == mulhi(a, b)));
+  EXPECT_TRUE(all_of(V{1U, 0U, 0xB37E0218U, 83810205U} == a * b));
+  static_assert(0x1DC781E3U == extract<2U>(mulhi(a, b)), "not constant evaluated");
+}
+
+TEST(simd_math, Addsub) {
+  constexpr fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+  constexpr fixed_size_simd<float, 4> b{10.0F, 20.0F, 30.0F, 40.0F};
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{-9.0F, 22.0F, -27.0F, 44.0F} == addsub(a, b)));
+  static_assert(-9.0F == extract<0U>(addsub(a, b)), "not constant evaluated");
+}
+
+TEST(simd_math, Sqrt) {
+  const fixed_size_simd<float, 4> v{0.0F, 1.0F, 4.0F, 2.25F};
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{0.0F, 1.0F, 2.0F, 1.5F} == sqrt(v)));
+  EXPECT_TRUE(all_of(is_nan(sqrt(simd<float>{-1.0F}))));
+  EXPECT_TRUE(all_of(simd<float>{std::numeric_limits<float>::infinity()} ==
+                     sqrt(simd<float>{std::numeric_limits<float>::infinity()})));
+}
+
 } // namespace
 } // namespace parallelism_v2
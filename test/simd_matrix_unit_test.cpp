@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_matrix.h"
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = fixed_size_simd<float, 4>;
+using M = simd_matrix4<float>;
+
+std::array<float, 4> ToArray(const V &v) { return {extract<0U>(v), extract<1U>(v), extract<2U>(v), extract<3U>(v)}; }
+
+// element (i, j) is 4 * i + j + 1
+M Iota() {
+  return {V{1.0F, 2.0F, 3.0F, 4.0F}, V{5.0F, 6.0F, 7.0F, 8.0F}, V{9.0F, 10.0F, 11.0F, 12.0F},
+          V{13.0F, 14.0F, 15.0F, 16.0F}};
+}
+
+std::vector<float> Random(const std::size_t n, const unsigned seed) {
+  std::mt19937 engine{seed};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  std::vector<float> v(n);
+  for (float &x : v) {
+    x = distribution(engine);
+  }
+  return v;
+}
+
+TEST(simd_matrix, Transpose4x4) {
+  M m{Iota()};
+  transpose4x4(m[0], m[1], m[2], m[3]);
+
+  EXPECT_EQ((std::array<float, 4>{1.0F, 5.0F, 9.0F, 13.0F}), ToArray(m[0]));
+  EXPECT_EQ((std::array<float, 4>{2.0F, 6.0F, 10.0F, 14.0F}), ToArray(m[1]));
+  EXPECT_EQ((std::array<float, 4>{3.0F, 7.0F, 11.0F, 15.0F}), ToArray(m[2]));
+  EXPECT_EQ((std::array<float, 4>{4.0F, 8.0F, 12.0F, 16.0F}), ToArray(m[3]));
+
+  const M t{transpose(transpose(Iota()))};
+  for (std::size_t i{}; i < 4U; ++i) {
+    EXPECT_EQ(ToArray(Iota()[i]), ToArray(t[i]));
+  }
+}
+
+TEST(simd_matrix, MatrixVector) {
+  EXPECT_EQ((std::array<float, 4>{10.0F, 26.0F, 42.0F, 58.0F}), ToArray(multiply(Iota(), V{1.0F})));
+  EXPECT_EQ((std::array<float, 4>{30.0F, 70.0F, 110.0F, 150.0F}),
+            ToArray(multiply(Iota(), V{1.0F, 2.0F, 3.0F, 4.0F})));
+}
+
+TEST(simd_matrix, MatrixMatrix) {
+  const M a{Iota()};
+  const M b{transpose(Iota())};
+  const M r{multiply(a, b)};
+
+  for (std::size_t i{}; i < 4U; ++i) {
+    for (std::size_t j{}; j < 4U; ++j) {
+      float expected{};
+      for (std::size_t k{}; k < 4U; ++k) {
+        expected += a[i][k] * b[k][j];
+      }
+      EXPECT_EQ(expected, r[i][j]) << i << " " << j;
+    }
+  }
+
+  const M identity{V{1.0F, 0.0F, 0.0F, 0.0F}, V{0.0F, 1.0F, 0.0F, 0.0F}, V{0.0F, 0.0F, 1.0F, 0.0F},
+                   V{0.0F, 0.0F, 0.0F, 1.0F}};
+  for (std::size_t i{}; i < 4U; ++i) {
+    EXPECT_EQ(ToArray(a[i]), ToArray(multiply(identity, a)[i]));
+  }
+}
+
+TEST(simd_matrix, ConstantEvaluated) {
+  constexpr M m{transpose(M{V{1.0F}, V{2.0F}, V{3.0F}, V{4.0F}})};
+  static_assert(4.0F == extract<3U>(m[0]), "not constant evaluated");
+  static_assert(10.0F == extract<2U>(multiply(m, V{1.0F})), "not constant evaluated");
+}
+
+TEST(simd_matrix, Gemm) {
+  struct Shape {
+    std::size_t m;
+    std::size_t n;
+    std::size_t k;
+  };
+  // shapes smaller than a micro-kernel, with edges and larger than the cache blocks
+  for (const Shape s : {Shape{1U, 1U, 1U}, Shape{4U, 8U, 16U}, Shape{5U, 7U, 3U}, Shape{100U, 37U, 300U},
+                        Shape{13U, 2100U, 5U}, Shape{3U, 4U, 0U}}) {
+    const std::size_t lda{s.k + 1U};
+    const std::size_t ldb{s.n + 2U};
+    const std::size_t ldc{s.n + 3U};
+    const std::vector<float> a{Random(s.m * lda, 1U)};
+    const std::vector<float> b{Random(s.k * ldb, 2U)};
+    std::vector<float> c(s.m * ldc, -1.0F);
+
+    simd_gemm(s.m, s.n, s.k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+
+    for (std::size_t i{}; i < s.m; ++i) {
+      for (std::size_t j{}; j < s.n; ++j) {
+        float expected{};
+        for (std::size_t p{}; p < s.k; ++p) {
+          expected += a[i * lda + p] * b[p * ldb + j];
+        }
+        ASSERT_NEAR(expected, c[i * ldc + j], 1e-4F) << s.m << "x" << s.n << "x" << s.k << " " << i << " " << j;
+      }
+      for (std::size_t j{s.n}; j < ldc; ++j) {
+        ASSERT_EQ(-1.0F, c[i * ldc + j]);
+      }
+    }
+  }
+}
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_parse.h"
+#include <gtest/gtest.h>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+template <typename T> void ExpectSameAsFromChars(const char *const first, const char *const last) {
+  T expected{42};
+  T value{42};
+  const std::from_chars_result e{std::from_chars(first, last, expected)};
+  const std::from_chars_result r{simd_from_chars(first, last, value)};
+  const std::string s{first, last};
+  EXPECT_EQ(e.ec, r.ec) << s;
+  EXPECT_EQ(e.ptr, r.ptr) << s;
+  if (std::isnan(static_cast<double>(expected))) {
+    EXPECT_TRUE(std::isnan(static_cast<double>(value))) << s;
+  } else {
+    EXPECT_EQ(expected, value) << s;
+    EXPECT_EQ(std::signbit(static_cast<double>(expected)), std::signbit(static_cast<double>(value))) << s;
+  }
+}
+
+template <typename T> void ExpectSameAsFromChars(const std::string &s) {
+  ExpectSameAsFromChars<T>(s.data(), s.data() + s.size());
+}
+
+TEST(simd_parse, Int32) {
+  for (const std::string s :
+       {"0", "7", "-7", "-0", "12345678", "123456789", "1234567890123456", "0000000000000012", "00000000000000012",
+        "2147483647", "-2147483648", "2147483648", "-2147483649", "9999999999999999", "99999999999999999",
+        "123456789012345678901234", "", "-", "+1", "x1", "12x", "-12,3", "1 2", "٣", "--1", "1234567890123456,"}) {
+    ExpectSameAsFromChars<std::int32_t>(s);
+  }
+}
+
+TEST(simd_parse, Int32_WhenRandom_ThenSameAsFromChars) {
+  std::mt19937 engine{1U};
+  std::uniform_int_distribution<std::int32_t> distribution{std::numeric_limits<std::int32_t>::min()};
+  for (int i{}; i < 10000; ++i) {
+    const std::int32_t x{distribution(engine) >> (i % 32)};
+    ExpectSameAsFromChars<std::int32_t>(std::to_string(x) + ",");
+  }
+}
+
+TEST(simd_parse, WhenEndOfRange_ThenNotReadPast) {
+  // the digits continue past the end of the range
+  const std::string s{"12345678901234567890.12345678901234567890"};
+  for (std::size_t n{}; n <= s.size(); ++n) {
+    ExpectSameAsFromChars<std::int32_t>(s.data(), s.data() + n);
+    ExpectSameAsFromChars<float>(s.data(), s.data() + n);
+  }
+  for (std::size_t n{16U}; n <= s.size(); ++n) {
+    ExpectSameAsFromChars<float>(s.data() + 16, s.data() + n);
+  }
+}
+
+TEST(simd_parse, Float) {
+  for (const std::string s :
+       {"0", "-0", "0.0", "1", "-1.5", "3.14159", "0.1", "1e10", "1e-10", "1.5e3", "1.5E-3", "16777216", "16777217",
+        "0.000001", "123456.789", "1e38", "1e39", "1e-45", "1e-50", "3.4028235e38", "1.", ".5", "-.5", ".", "-", "",
+        "e5", "1e", "1e+", "1e-", "1e+5", "1ex", "1.5x", "inf", "-inf", "nan", "infinity", "0x1p3", "1.2.3",
+        "12345678901234567890", "1.2345678901234567890", "0.00000000000000000000000000001", "1e00001", "7e-10",
+        "9.999999e-10", "2.5e10"}) {
+    ExpectSameAsFromChars<float>(s);
+  }
+}
+
+TEST(simd_parse, Float_WhenRandom_ThenSameAsFromChars) {
+  std::mt19937 engine{2U};
+  std::uniform_real_distribution<float> distribution{-1000.0F, 1000.0F};
+  std::uniform_int_distribution<int> digits{0, 9};
+  char buffer[64];
+  for (int i{}; i < 10000; ++i) {
+    // short decimals, which take the fast path, and the shortest representations, which mostly do not
+    std::snprintf(buffer, sizeof(buffer), "%.*f", digits(engine), static_cast<double>(distribution(engine)));
+    ExpectSameAsFromChars<float>(buffer);
+    const float x{distribution(engine)};
+    const std::to_chars_result r{std::to_chars(buffer, buffer + sizeof(buffer), x)};
+    ExpectSameAsFromChars<float>(std::string{buffer, r.ptr});
+    std::snprintf(buffer, sizeof(buffer), "%de%d", digits(engine) * 1234, digits(engine) * 3 - 15);
+    ExpectSameAsFromChars<float>(buffer);
+  }
+}
+
+TEST(simd_parse, Batch) {
+  const std::string s{"1,-2,30,400,5000,60000,700000,8000000,90000000"};
+  const char *p{s.data()};
+  const char *const last{s.data() + s.size()};
+  std::vector<std::int32_t> values;
+  simd<std::int32_t> v;
+  std::from_chars_result r{p, std::errc{}};
+  while ((r = simd_from_chars(p, last, v, ',')).ec == std::errc{}) {
+    for (std::size_t i{}; i < v.size(); ++i) {
+      values.push_back(v[i]);
+    }
+    p = r.ptr;
+  }
+  EXPECT_EQ(last, r.ptr);
+  EXPECT_EQ(std::errc::invalid_argument, r.ec);
+  // the remaining numbers one by one
+  while (p != last) {
+    std::int32_t x{};
+    p = simd_from_chars(p, last, x).ptr;
+    values.push_back(x);
+    p += (p != last) ? 1 : 0;
+  }
+  EXPECT_EQ((std::vector<std::int32_t>{1, -2, 30, 400, 5000, 60000, 700000, 8000000, 90000000}), values);
+}
+
+TEST(simd_parse, Batch_WhenFloat_ThenConverted) {
+  const std::string s{"0.5\n-1.25\n1e3\n7\n"};
+  simd<float> v{-1.0F};
+  const std::from_chars_result r{simd_from_chars(s.data(), s.data() + s.size(), v, '\n')};
+  ASSERT_EQ(std::errc{}, r.ec);
+  EXPECT_EQ(s.data() + s.size(), r.ptr);
+  EXPECT_EQ(0.5F, v[0]);
+  EXPECT_EQ(-1.25F, v[1]);
+  EXPECT_EQ(1000.0F, v[2]);
+  EXPECT_EQ(7.0F, v[3]);
+}
+
+TEST(simd_parse, Batch_WhenInvalid_ThenUnchanged) {
+  simd<std::int32_t> v{42};
+  const std::string s{"1,2;3,4,5,6,7,8"};
+  const std::from_chars_result r{simd_from_chars(s.data(), s.data() + s.size(), v, ',')};
+  EXPECT_EQ(std::errc::invalid_argument, r.ec);
+  EXPECT_EQ(s.data() + 3, r.ptr);
+  EXPECT_TRUE(all_of(v == simd<std::int32_t>{42}));
+
+  const std::string t{"1,99999999999,3,4,5,6,7,8"};
+  EXPECT_EQ(std::errc::result_out_of_range, simd_from_chars(t.data(), t.data() + t.size(), v, ',').ec);
+  EXPECT_TRUE(all_of(v == simd<std::int32_t>{42}));
+}
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_polynomial.h"
+#include <gtest/gtest.h>
+#include <cmath>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = fixed_size_simd<float, 4>;
+
+TEST(simd_polynomial, Horner) {
+  const V x{0.0F, 1.0F, 2.0F, -1.0F};
+
+  EXPECT_TRUE(all_of(V{7.0F} == horner<7.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 3.0F, 5.0F, -1.0F} == horner<1.0F, 2.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 15.0F, 129.0F, 3.0F} == horner<1.0F, 2.0F, 3.0F, 4.0F, 5.0F>(x)));
+}
+
+TEST(simd_polynomial, Estrin) {
+  const V x{0.0F, 1.0F, 2.0F, -1.0F};
+
+  EXPECT_TRUE(all_of(V{7.0F} == estrin<7.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 3.0F, 5.0F, -1.0F} == estrin<1.0F, 2.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 6.0F, 17.0F, 2.0F} == estrin<1.0F, 2.0F, 3.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 15.0F, 129.0F, 3.0F} == estrin<1.0F, 2.0F, 3.0F, 4.0F, 5.0F>(x)));
+  EXPECT_TRUE(all_of(V{1.0F, 8.0F, 255.0F, 0.0F} ==
+                     estrin<1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F>(x)));
+}
+
+TEST(simd_polynomial, Estrin_WhenTaylorSeries_ThenSameAsHornerAndExp) {
+  for (float f{-1.0F}; f <= 1.0F; f += 0.125F) {
+    const V x{f};
+    const V h{horner<1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320,
+                     1.0 / 362880>(x)};
+    const V e{estrin<1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320,
+                     1.0 / 362880>(x)};
+    EXPECT_NEAR(std::exp(f), h[0], 1e-6F) << f;
+    EXPECT_NEAR(h[0], e[0], 4e-7F) << f;
+  }
+}
+
+TEST(simd_polynomial, Rational) {
+  const V x{0.0F, 0.5F, -1.0F, 3.0F};
+
+  EXPECT_TRUE(all_of(V{1.0F, 3.0F, 0.0F, -2.0F} == rational<polynomial<1.0F, 1.0F>, polynomial<1.0F, -1.0F>>(x)));
+  EXPECT_TRUE(all_of(V{0.0F, 0.25F, -0.5F, 1.5F} == rational<polynomial<0.0F, 1.0F>, polynomial<2.0F>>(x)));
+  EXPECT_TRUE(all_of(V{0.5F, 0.4F, 0.5F, 0.25F} == rational<polynomial<1.0F>, polynomial<2.0F, 0.0F, 0.5F, 0.0F>>(
+                                                    V{0.0F, 1.0F, 0.0F, 2.0F})));
+}
+
+TEST(simd_polynomial, WhenConstantEvaluated_ThenSame) {
+  constexpr V x{2.0F};
+  static_assert(129.0F == extract<0U>(horner<1, 2, 3, 4, 5>(x)), "not constant evaluated");
+  static_assert(129.0F == extract<0U>(estrin<1, 2, 3, 4, 5>(x)), "not constant evaluated");
+  static_assert(-3.0F == extract<0U>(rational<polynomial<1, 1>, polynomial<1, -1>>(x)), "not constant evaluated");
+}
+
+} // namespace
+} // namespace parallelism_v2
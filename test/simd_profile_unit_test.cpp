@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_profile.h"
+#include "simd.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+float Sum(const std::vector<float> &v) {
+  simd<float> sum{0.0F};
+  for (std::size_t i{}; i < v.size(); i += simd<float>::size()) {
+    simd<float> x;
+    x.copy_from(&v[i], element_aligned);
+    sum += x;
+  }
+  return reduce(sum);
+}
+
+TEST(simd_profile, WhenProfiles_ThenAccumulatedPerName) {
+  thread_kernel_profile_reset();
+  const std::vector<float> v(1U << 16, 1.0F);
+  for (int i{}; i < 3; ++i) {
+    kernel_profile profile{"sum"};
+    profile.add_bytes(v.size() * sizeof(float));
+    EXPECT_EQ(65536.0F, Sum(v));
+  }
+  {
+    kernel_profile profile{"empty"};
+  }
+
+  ASSERT_EQ(2U, thread_kernel_profile_table().size());
+  const kernel_statistics &sum{thread_kernel_profile_table().at("sum")};
+  EXPECT_EQ(3U, sum.calls);
+  EXPECT_EQ(3U * v.size() * sizeof(float), sum.bytes);
+  EXPECT_LT(0, sum.time.count());
+  EXPECT_EQ(1U, thread_kernel_profile_table().at("empty").calls);
+
+  if (hardware_event_available(hardware_event::instructions)) {
+    // at least a load and an addition per 4 floats
+    EXPECT_LT(3U * v.size() / 2U, sum.counts[hardware_event::instructions]);
+    EXPECT_LT(thread_kernel_profile_table().at("empty").counts[hardware_event::instructions], 10000U);
+  }
+  if (hardware_event_available(hardware_event::cycles) && hardware_event_available(hardware_event::instructions)) {
+    EXPECT_LT(0.0, sum.ipc());
+    EXPECT_LT(0.0, sum.bytes_per_cycle());
+  }
+}
+
+TEST(simd_profile, WhenCountersUnavailable_ThenZero) {
+  for (std::size_t i{}; i < static_cast<std::size_t>(hardware_event::count); ++i) {
+    const hardware_event e{static_cast<hardware_event>(i)};
+    if (!hardware_event_available(e)) {
+      kernel_profile profile{"unavailable"};
+      EXPECT_EQ(0U, profile.counts()[e]);
+    }
+  }
+  EXPECT_EQ(0.0, kernel_statistics{}.ipc());
+  EXPECT_EQ(0.0, kernel_statistics{}.bytes_per_cycle());
+}
+
+TEST(simd_profile, WhenOtherThread_ThenOwnTable) {
+  thread_kernel_profile_reset();
+  std::thread t{[] {
+    kernel_profile profile{"other"};
+  }};
+  t.join();
+  EXPECT_TRUE(thread_kernel_profile_table().empty());
+}
+
+TEST(simd_profile, Report) {
+  thread_kernel_profile_reset();
+  {
+    kernel_profile profile{"kernel"};
+    profile.add_bytes(64U);
+  }
+  std::ostringstream os;
+  os << std::setprecision(5);
+  thread_kernel_profile_report(os);
+
+  std::istringstream lines{os.str()};
+  std::string header;
+  std::string row;
+  std::getline(lines, header);
+  std::getline(lines, row);
+  EXPECT_EQ(0U, header.find("kernel"));
+  EXPECT_NE(std::string::npos, header.find("IPC"));
+  EXPECT_NE(std::string::npos, header.find("bytes/cycle"));
+  EXPECT_EQ(0U, row.find("kernel "));
+  EXPECT_EQ(header.size(), row.size());
+  EXPECT_EQ(5, os.precision());
+  thread_kernel_profile_reset();
+}
+
+TEST(simd_profile, Report_WhenCountersNeverRan_ThenUnavailable) {
+  thread_kernel_profile_reset();
+  kernel_statistics &s{thread_kernel_profile_table()["multiplexed"]};
+  s.calls = 1U;
+  s.bytes = 64U;
+  s.counts[hardware_event::cycles] = 100U;
+  s.counts[hardware_event::instructions] = 200U;
+  s.counts.time_enabled() = 1000U;
+  std::ostringstream os;
+  thread_kernel_profile_report(os);
+
+  std::istringstream lines{os.str()};
+  std::string row;
+  std::getline(lines, row);
+  std::getline(lines, row);
+  EXPECT_EQ(std::string::npos, row.find("100"));
+  EXPECT_EQ(std::string::npos, row.find("200"));
+  EXPECT_NE(std::string::npos, row.find("n/a"));
+  thread_kernel_profile_reset();
+}
+
+TEST(simd_profile, CountsDifference) {
+  hardware_counts a;
+  a[hardware_event::cycles] = 10U;
+  a.time_enabled() = 7U;
+  a.time_running() = 5U;
+  hardware_counts b{a};
+  b[hardware_event::cycles] = 25U;
+  b.time_enabled() = 20U;
+  b.time_running() = 9U;
+
+  const hardware_counts d{b - a};
+  EXPECT_EQ(15U, d[hardware_event::cycles]);
+  EXPECT_EQ(13U, d.time_enabled());
+  EXPECT_EQ(4U, d.time_running());
+}
+
+} // namespace
+} // namespace parallelism_v2
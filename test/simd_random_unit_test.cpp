@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_random.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+using U = simd<std::uint32_t>;
+using V = simd<float>;
+
+// the known answers of the Random123 distribution for (counter, key)
+void ExpectPhilox(const std::uint64_t counter, const std::uint64_t stream, const std::uint64_t seed,
+                  const std::array<std::uint32_t, 4U> &expected) {
+  philox4x32<> g{seed, stream};
+  g.discard(4U * (counter / U::size()));
+  for (const std::uint32_t e : expected) {
+    EXPECT_EQ(e, g()[counter % U::size()]);
+  }
+}
+
+TEST(simd_random, Philox_WhenKnownAnswer_ThenSame) {
+  ExpectPhilox(0U, 0U, 0U, {0x6627E8D5U, 0xE169C58DU, 0xBC57AC4CU, 0x9B00DBD8U});
+  ExpectPhilox(0xFFFFFFFFFFFFFFFFU, 0xFFFFFFFFFFFFFFFFU, 0xFFFFFFFFFFFFFFFFU,
+               {0x408F276DU, 0x41C83B0EU, 0xA20BC7C6U, 0x6D5451FDU});
+  ExpectPhilox(0x85A308D3243F6A88U, 0x0370734413198A2EU, 0x299F31D0A4093822U,
+               {0xD16CFE09U, 0x94FDCCEBU, 0x5001E420U, 0x24126EA1U});
+}
+
+TEST(simd_random, Philox_WhenConstantEvaluated_ThenSame) {
+  constexpr std::uint32_t first{[] {
+    philox4x32<> g{0U};
+    return extract<0U>(g());
+  }()};
+  static_assert(0x6627E8D5U == first, "not constant evaluated");
+}
+
+TEST(simd_random, Philox_WhenDiscard_ThenSameAsCalls) {
+  for (std::uint64_t n{}; n < 10U; ++n) {
+    philox4x32<> a{42U, 7U};
+    philox4x32<> b{42U, 7U};
+    for (std::uint64_t i{}; i < n; ++i) {
+      b();
+    }
+    a.discard(n);
+    EXPECT_TRUE(all_of(a() == b()));
+    a.discard(5U);
+    for (int i{}; i < 5; ++i) {
+      b();
+    }
+    EXPECT_TRUE(all_of(a() == b()));
+  }
+}
+
+TEST(simd_random, Philox_WhenOtherStream_ThenOtherSequence) {
+  philox4x32<> a{42U, 0U};
+  philox4x32<> b{42U, 1U};
+  EXPECT_TRUE(none_of(a() == b()));
+}
+
+// the reference implementation of xoshiro128+
+struct Xoshiro128Plus {
+  std::uint32_t operator()() {
+    const std::uint32_t result{s[0] + s[3]};
+    const std::uint32_t t{s[1] << 9};
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+    return result;
+  }
+
+  void Jump(const std::array<std::uint32_t, 4U> &polynomial) {
+    std::array<std::uint32_t, 4U> j{};
+    for (const std::uint32_t word : polynomial) {
+      for (int b{}; b < 32; ++b) {
+        if ((word & (1U << b)) != 0U) {
+          for (std::size_t i{}; i < 4U; ++i) {
+            j[i] ^= s[i];
+          }
+        }
+        (*this)();
+      }
+    }
+    s = j;
+  }
+
+  std::array<std::uint32_t, 4U> s;
+};
+
+Xoshiro128Plus Lane(std::uint64_t seed, const std::size_t lane) {
+  const std::uint64_t a{detail::splitmix64(seed)};
+  const std::uint64_t b{detail::splitmix64(seed)};
+  Xoshiro128Plus g{{static_cast<std::uint32_t>(a), static_cast<std::uint32_t>(a >> 32), static_cast<std::uint32_t>(b),
+                    static_cast<std::uint32_t>(b >> 32)}};
+  for (std::size_t i{}; i < lane; ++i) {
+    g.Jump({0x8764000BU, 0xF542D2D3U, 0x6FA035C3U, 0x77F2DB5BU});
+  }
+  return g;
+}
+
+TEST(simd_random, Xoshiro_WhenLanes_ThenJumpedReferences) {
+  xoshiro128plus<> g{1234U};
+  std::vector<Xoshiro128Plus> lanes;
+  for (std::size_t i{}; i < U::size(); ++i) {
+    lanes.push_back(Lane(1234U, i));
+  }
+  for (int n{}; n < 100; ++n) {
+    const U v{g()};
+    for (std::size_t i{}; i < U::size(); ++i) {
+      ASSERT_EQ(lanes[i](), v[i]);
+    }
+  }
+}
+
+TEST(simd_random, Xoshiro_WhenLongJump_ThenLanesLongJumped) {
+  xoshiro128plus<> g{1234U};
+  g.long_jump();
+  const U v{g()};
+  for (std::size_t i{}; i < U::size(); ++i) {
+    Xoshiro128Plus lane{Lane(1234U, i)};
+    lane.Jump({0xB523952EU, 0x0B6F099FU, 0xCCF5A0EFU, 0x1C580662U});
+    EXPECT_EQ(lane(), v[i]);
+  }
+}
+
+TEST(simd_random, UniformFloat) {
+  EXPECT_TRUE(all_of(V{0.0F} == uniform_float(U{0U})));
+  EXPECT_TRUE(all_of(V{0.5F} == uniform_float(U{0x80000000U})));
+  EXPECT_TRUE(all_of(V{1.0F - 0x1p-23F} == uniform_float(U{0xFFFFFFFFU})));
+}
+
+TEST(simd_random, Log) {
+  for (std::uint32_t x{0x00800000U}; x <= 0x3F800000U; x += 0x1357U) {
+    const float f{detail::bit_cast<float>(x)};
+    const float expected{std::log(f)};
+    ASSERT_NEAR(expected, detail::log(V{f})[0], 2e-7F * (1.0F + std::abs(expected))) << f;
+  }
+}
+
+TEST(simd_random, CosSinTurn) {
+  for (std::uint64_t i{}; i < (1ULL << 32); i += 0x10001ULL) {
+    const std::uint32_t x{static_cast<std::uint32_t>(i)};
+    // the angle is given by the upper 25 bits rounded to nearest
+    const std::uint32_t truncated{(((x + (1U << 29)) >> 7) << 7) - (1U << 29)};
+    const double a{6.283185307179586 * truncated / 4294967296.0};
+    const std::pair<V, V> cos_sin{detail::cos_sin_turn(U{x})};
+    ASSERT_NEAR(std::cos(a), cos_sin.first[0], 2e-7) << x;
+    ASSERT_NEAR(std::sin(a), cos_sin.second[0], 2e-7) << x;
+  }
+}
+
+TEST(simd_random, Normal_WhenManySamples_ThenStandardNormal) {
+  philox4x32<> g{2024U};
+  std::vector<float> z((1U << 20) + 3U);
+  simd_generate_normal(g, z.data(), z.data() + z.size());
+
+  double sum{};
+  double squares{};
+  std::size_t within_one{};
+  for (const float x : z) {
+    sum += x;
+    squares += x * x;
+    within_one += (std::abs(x) < 1.0F) ? 1U : 0U;
+  }
+  const double n{static_cast<double>(z.size())};
+  EXPECT_NEAR(0.0, sum / n, 0.005);
+  EXPECT_NEAR(1.0, squares / n, 0.005);
+  EXPECT_NEAR(0.682689, within_one / n, 0.002);
+}
+
+TEST(simd_random, Uniform_WhenManySamples_ThenUniform) {
+  xoshiro128plus<> g{2024U};
+  std::vector<float> u((1U << 20) + 1U);
+  simd_generate_uniform(g, u.data(), u.data() + u.size());
+
+  double sum{};
+  std::size_t below_quarter{};
+  for (const float x : u) {
+    ASSERT_LE(0.0F, x);
+    ASSERT_GT(1.0F, x);
+    sum += x;
+    below_quarter += (x < 0.25F) ? 1U : 0U;
+  }
+  const double n{static_cast<double>(u.size())};
+  EXPECT_NEAR(0.5, sum / n, 0.002);
+  EXPECT_NEAR(0.25, below_quarter / n, 0.002);
+}
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_sort.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+using V = fixed_size_simd<float, 4>;
+
+std::array<float, 4> ToArray(const V &v) { return {extract<0U>(v), extract<1U>(v), extract<2U>(v), extract<3U>(v)}; }
+
+TEST(simd_sort, SortingNetwork4) {
+  std::array<float, 4> permutation{1.0F, 2.0F, 3.0F, 4.0F};
+  do {
+    V a{permutation[0], permutation[1], permutation[2], permutation[3]};
+    sorting_network(a);
+    EXPECT_TRUE(all_of(V{1.0F, 2.0F, 3.0F, 4.0F} == a));
+  } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+  V a{2.0F, 1.0F, 2.0F, 1.0F};
+  sorting_network(a);
+  EXPECT_TRUE(all_of(V{1.0F, 1.0F, 2.0F, 2.0F} == a));
+}
+
+TEST(simd_sort, SortingNetwork8) {
+  std::mt19937 engine{42U};
+  std::uniform_int_distribution<int> distribution{-8, 8};
+  for (int n{}; n < 100; ++n) {
+    std::array<float, 8> input;
+    std::generate(input.begin(), input.end(), [&]() { return static_cast<float>(distribution(engine)); });
+    V a;
+    V b;
+    a.copy_from(input.data(), element_aligned);
+    b.copy_from(input.data() + 4U, element_aligned);
+
+    sorting_network(a, b);
+
+    std::sort(input.begin(), input.end());
+    std::array<float, 8> output;
+    a.copy_to(output.data(), element_aligned);
+    b.copy_to(output.data() + 4U, element_aligned);
+    EXPECT_EQ(input, output);
+  }
+}
+
+TEST(simd_sort, SortingNetwork16) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-1.0F, 1.0F};
+  for (int n{}; n < 100; ++n) {
+    std::array<float, 16> input;
+    std::generate(input.begin(), input.end(), [&]() { return distribution(engine); });
+    V a;
+    V b;
+    V c;
+    V d;
+    a.copy_from(input.data(), element_aligned);
+    b.copy_from(input.data() + 4U, element_aligned);
+    c.copy_from(input.data() + 8U, element_aligned);
+    d.copy_from(input.data() + 12U, element_aligned);
+
+    sorting_network(a, b, c, d);
+
+    std::sort(input.begin(), input.end());
+    std::array<float, 16> output;
+    a.copy_to(output.data(), element_aligned);
+    b.copy_to(output.data() + 4U, element_aligned);
+    c.copy_to(output.data() + 8U, element_aligned);
+    d.copy_to(output.data() + 12U, element_aligned);
+    EXPECT_EQ(input, output);
+  }
+}
+
+TEST(simd_sort, BitonicMerge) {
+  V a{1.0F, 4.0F, 5.0F, 8.0F};
+  V b{2.0F, 3.0F, 6.0F, 7.0F};
+
+  bitonic_merge(a, b);
+
+  EXPECT_EQ((std::array<float, 4>{1.0F, 2.0F, 3.0F, 4.0F}), ToArray(a));
+  EXPECT_EQ((std::array<float, 4>{5.0F, 6.0F, 7.0F, 8.0F}), ToArray(b));
+}
+
+constexpr V SortedConstant() {
+  V a{4.0F, 2.0F, 3.0F, 1.0F};
+  sorting_network(a);
+  return a;
+}
+
+TEST(simd_sort, ConstantEvaluated) {
+  constexpr V a{SortedConstant()};
+  static_assert(1.0F == extract<0U>(a), "not constant evaluated");
+  static_assert(4.0F == extract<3U>(a), "not constant evaluated");
+}
+
+TEST(simd_sort, RangeSort) {
+  std::mt19937 engine{42U};
+  std::uniform_real_distribution<float> distribution{-100.0F, 100.0F};
+  for (std::size_t n : {0U, 1U, 2U, 3U, 4U, 15U, 16U, 17U, 31U, 32U, 33U, 63U, 64U, 100U, 1000U, 4099U}) {
+    std::vector<float> input(n);
+    std::generate(input.begin(), input.end(), [&]() { return distribution(engine); });
+    std::vector<float> expected{input};
+    std::sort(expected.begin(), expected.end());
+
+    simd_sort(input.data(), input.data() + n);
+
+    EXPECT_EQ(expected, input);
+  }
+}
+
+TEST(simd_sort, RangeSort_WhenDuplicatesAndInfinity_ThenSorted) {
+  std::vector<float> input(1000U);
+  for (std::size_t i{}; i < input.size(); ++i) {
+    input[i] = (i % 7U == 0U) ? std::numeric_limits<float>::infinity() : static_cast<float>((i * 31U) % 5U);
+  }
+  std::vector<float> expected{input};
+  std::sort(expected.begin(), expected.end());
+
+  simd_sort(input.data(), input.data() + input.size());
+
+  EXPECT_EQ(expected, input);
+}
+
+TEST(simd_sort, RangeSort_WhenInt32_ThenSorted) {
+  std::mt19937 engine{42U};
+  std::uniform_int_distribution<std::int32_t> distribution{std::numeric_limits<std::int32_t>::min(),
+                                                           std::numeric_limits<std::int32_t>::max()};
+  std::vector<std::int32_t> input(1000U);
+  std::generate(input.begin(), input.end(), [&]() { return distribution(engine); });
+  input[17U] = std::numeric_limits<std::int32_t>::max();
+  std::vector<std::int32_t> expected{input};
+  std::sort(expected.begin(), expected.end());
+
+  simd_sort(input.data(), input.data() + input.size());
+
+  EXPECT_EQ(expected, input);
+}
+
+} // namespace
+} // namespace parallelism_v2
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+
+#include "simd_string.h"
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <vector>
+
+namespace parallelism_v2 {
+namespace {
+
+std::vector<std::string_view> Tokenize(const std::string_view s, const std::string_view delimiters) {
+  simd_tokenizer<> tokenizer{s.data(), s.data() + s.size(), delimiters};
+  std::vector<std::string_view> tokens;
+  for (std::string_view token; tokenizer.next(token);) {
+    tokens.push_back(token);
+  }
+  return tokens;
+}
+
+// two pages of which the second one faults on access
+class GuardPage {
+public:
+  GuardPage() {
+    memory_ = static_cast<char *>(mmap(nullptr, 2U * size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    EXPECT_NE(MAP_FAILED, memory_);
+    EXPECT_EQ(0, mprotect(memory_ + size, size, PROT_NONE));
+  }
+  ~GuardPage() { munmap(memory_, 2U * size); }
+
+  // copies s to the end of the first page
+  const char *Place(const std::string_view s) {
+    char *const first{memory_ + size - s.size()};
+    std::memcpy(first, s.data(), s.size());
+    return first;
+  }
+
+private:
+  static constexpr std::size_t size{4096U};
+  char *memory_;
+};
+
+TEST(simd_string, Strchr) {
+  alignas(64) char buffer[128];
+  for (std::size_t offset{}; offset < 32U; ++offset) {
+    for (std::size_t length{}; length < 64U; ++length) {
+      std::memset(buffer, 'x', sizeof(buffer));
+      char *const s{buffer + offset};
+      s[length] = '\0';
+      if (offset > 0U) {
+        buffer[offset - 1U] = 'a'; // before the string
+      }
+      for (std::size_t position{}; position < length; ++position) {
+        s[position] = 'a';
+        EXPECT_EQ(s + position, simd_strchr(s, 'a'));
+        s[position] = 'x';
+      }
+      EXPECT_EQ(nullptr, simd_strchr(s, 'a'));
+      EXPECT_EQ(s + length, simd_strchr(s, '\0'));
+    }
+  }
+}
+
+TEST(simd_string, Memchr) {
+  const std::string s{"0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+  for (std::size_t first{}; first < 20U; ++first) {
+    for (std::size_t last{first}; last <= s.size(); ++last) {
+      const std::string_view range{s.data() + first, last - first};
+      for (const char c : {'0', 'a', 'z', 'Z', '#'}) {
+        const std::size_t expected{std::min(range.find(c), range.size())};
+        EXPECT_EQ(range.data() + expected, simd_memchr(range.data(), range.data() + range.size(), c));
+      }
+    }
+  }
+}
+
+TEST(simd_string, FindFirstOf) {
+  const std::string s{"GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: */*\r\n\r\n"};
+  for (const std::string_view set : {" ", ":\r\n", "/.", "#", "", "0123456789abcdef"}) {
+    if (set.size() > simd<char>::size()) {
+      continue;
+    }
+    for (std::size_t first{}; first < s.size(); ++first) {
+      const std::string_view range{s.data() + first, s.size() - first};
+      const std::size_t expected{std::min(range.find_first_of(set), range.size())};
+      EXPECT_EQ(range.data() + expected, simd_find_first_of(range.data(), range.data() + range.size(), set));
+    }
+  }
+}
+
+TEST(simd_string, Tokenizer) {
+  EXPECT_EQ((std::vector<std::string_view>{"a", "b", "", "c"}), Tokenize("a,b;;c", ",;"));
+  EXPECT_EQ((std::vector<std::string_view>{""}), Tokenize("", ","));
+  EXPECT_EQ((std::vector<std::string_view>{"", ""}), Tokenize(",", ","));
+  EXPECT_EQ((std::vector<std::string_view>{"abc", ""}), Tokenize("abc\n", "\n"));
+  EXPECT_EQ((std::vector<std::string_view>{"no delimiter in a range longer than a register"}),
+            Tokenize("no delimiter in a range longer than a register", ","));
+  EXPECT_EQ((std::vector<std::string_view>{"2024-01-01T00:00:00Z", "INFO", "request handled in 12 ms", "id=42"}),
+            Tokenize("2024-01-01T00:00:00Z\tINFO\trequest handled in 12 ms\tid=42", "\t"));
+}
+
+TEST(simd_string, EndOfPage) {
+  GuardPage page;
+  for (std::size_t length{}; length < 40U; ++length) {
+    const std::string s(length, 'x');
+    const char *const first{page.Place(s)};
+    const char *const last{first + length};
+
+    EXPECT_EQ(last, simd_memchr(first, last, 'y'));
+    EXPECT_EQ(last, simd_find_first_of(first, last, ",;"));
+    EXPECT_EQ((std::vector<std::string_view>{std::string_view{first, length}}),
+              Tokenize(std::string_view{first, length}, ","));
+
+    if (length > 0U) {
+      const char *const terminated{page.Place(s.substr(1U) + '\0')};
+      EXPECT_EQ(terminated + length - 1U, simd_strchr(terminated, '\0'));
+      EXPECT_EQ(nullptr, simd_strchr(terminated, 'y'));
+    }
+  }
+}
+
+} // namespace
+} // namespace parallelism_v2
@@ -2,6 +2,8 @@
 
 #include "simd.h"
 #include <array>
+#include <bit>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <gtest/gtest.h>
@@ -21,6 +23,39 @@ static_assert(std::is_trivially_copy_assignable<simd<float>>::value, "Not trivia
 static_assert(std::is_trivially_move_assignable<simd<float>>::value, "Not trivially move assignable.");
 static_assert(std::is_trivially_destructible<simd<float>>::value, "Not trivially destructable.");
 
+constexpr std::array<float, 4U> Polynomial(const std::array<float, 4U> &x) {
+  const fixed_size_simd<float, 4> one{1.0F};
+  fixed_size_simd<float, 4> v;
+  v.copy_from(x.data(), element_aligned);
+  v = (v + one) * v - one;
+  where(v < fixed_size_simd<float, 4>{0.0F}, v) = fixed_size_simd<float, 4>{0.0F};
+
+  std::array<float, 4U> r{};
+  v.copy_to(r.data(), element_aligned);
+  return r;
+}
+
+TEST(simd, ConstantEvaluated) {
+  constexpr fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+  constexpr fixed_size_simd<float, 4> b{-a * a + fixed_size_simd<float, 4>{24.0F} / a};
+  static_assert(23.0F == b[0U], "not constant evaluated");
+  static_assert(8.0F == b[1U], "not constant evaluated");
+  static_assert(-1.0F == b[2U], "not constant evaluated");
+  static_assert(-10.0F == b[3U], "not constant evaluated");
+
+  static_assert(all_of(clamp(b, fixed_size_simd<float, 4>{-1.0F}, a) <= a), "not constant evaluated");
+  static_assert(all_of(is_nan(a + fixed_size_simd<float, 4>{std::numeric_limits<float>::quiet_NaN()})),
+                "not constant evaluated");
+
+  constexpr std::array<float, 4U> table{Polynomial({0.0F, 1.0F, 2.0F, -0.5F})};
+  static_assert(0.0F == std::get<0U>(table), "not constant evaluated");
+  static_assert(1.0F == std::get<1U>(table), "not constant evaluated");
+  static_assert(5.0F == std::get<2U>(table), "not constant evaluated");
+  static_assert(0.0F == std::get<3U>(table), "not constant evaluated");
+
+  EXPECT_TRUE(all_of(b == fixed_size_simd<float, 4>{23.0F, 8.0F, -1.0F, -10.0F}));
+}
+
 TEST(simd, Size) {
   EXPECT_EQ(16U, (memory_alignment_v<simd<float>>));
   EXPECT_EQ(4U, (simd<float>::size()));
@@ -66,12 +101,14 @@ TEST(simd, LoadAligned) {
   EXPECT_EQ(4.0F, scalars[3U]);
 }
 
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
 TEST(simd, LoadAligned_WhenCopyingFromUnalignedMemory_ThenPreconditionViolated) {
   fixed_size_simd<float, 4> vector;
   alignas(16) const std::array<float, 5U> scalars{};
 
   EXPECT_THROW(vector.copy_from(&scalars[1], vector_aligned), parallelism_v2::detail::condition_violated);
 }
+#endif
 
 TEST(simd, StoreUnaligned) {
   const fixed_size_simd<float, 4> vector{1.0F, 2.0F, 3.0F, 4.0F};
@@ -95,6 +132,7 @@ TEST(simd, StoreAligned) {
   EXPECT_EQ(4.0F, std::get<3U>(scalars));
 }
 
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
 TEST(simd, StoreAligned_WhenCopyingToUnalignedMemory_ThenPreconditionViolated) {
   const fixed_size_simd<float, 4> vector{23.0F};
   alignas(16) std::array<float, 5U> scalars;
@@ -102,11 +140,242 @@ TEST(simd, StoreAligned_WhenCopyingToUnalignedMemory_ThenPreconditionViolated) {
   EXPECT_THROW(vector.copy_to(&scalars[1], vector_aligned), parallelism_v2::detail::condition_violated);
 }
 
+// decodes IEEE 754 half precision by its definition
+float Float16(const std::uint16_t h) {
+  const float sign{(h & 0x8000U) != 0U ? -1.0F : 1.0F};
+  const int exponent{(h >> 10) & 0x1F};
+  const int mantissa{h & 0x3FF};
+  if (exponent == 0x1F) {
+    return (mantissa == 0) ? sign * std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+  }
+  if (exponent == 0) {
+    return sign * std::ldexp(static_cast<float>(mantissa), -24);
+  }
+  return sign * std::ldexp(static_cast<float>(1024 + mantissa), exponent - 25);
+}
+
+TEST(simd, Float16) {
+  using V = fixed_size_simd<float, 4>;
+  for (std::uint32_t i{}; i < 0x10000U; i += 4U) {
+    const std::array<std::uint16_t, 4U> h{static_cast<std::uint16_t>(i), static_cast<std::uint16_t>(i + 1U),
+                                          static_cast<std::uint16_t>(i + 2U), static_cast<std::uint16_t>(i + 3U)};
+    V v;
+    v.copy_from(h.data(), float16);
+    std::array<std::uint16_t, 4U> r;
+    v.copy_to(r.data(), float16);
+    for (std::size_t k{}; k < 4U; ++k) {
+      if (std::isnan(Float16(h[k]))) {
+        ASSERT_TRUE(std::isnan(v[k])) << h[k];
+        ASSERT_EQ(h[k] | 0x200U, r[k]) << h[k];
+      } else {
+        ASSERT_EQ(Float16(h[k]), v[k]) << h[k];
+        ASSERT_EQ(h[k], r[k]) << h[k];
+      }
+    }
+  }
+}
+
+TEST(simd, Float16_WhenRounding_ThenNearestEven) {
+  using V = fixed_size_simd<float, 4>;
+  std::array<std::uint16_t, 4U> r;
+
+  V{1.0F + 0x1p-11F, 1.0F + 3 * 0x1p-11F, 1.0F + 0x1p-11F + 0x1p-20F, -1.0F - 0x1p-12F}.copy_to(r.data(), float16);
+  EXPECT_EQ((std::array<std::uint16_t, 4U>{0x3C00U, 0x3C02U, 0x3C01U, 0xBC00U}), r);
+
+  V{65504.0F, 65519.0F, 65520.0F, std::numeric_limits<float>::infinity()}.copy_to(r.data(), float16);
+  EXPECT_EQ((std::array<std::uint16_t, 4U>{0x7BFFU, 0x7BFFU, 0x7C00U, 0x7C00U}), r);
+
+  // the smallest denormal, ties to even towards zero and away from zero and the largest denormal rounded up
+  V{0x1p-24F, 0x1p-25F, 3 * 0x1p-25F, 0x1p-14F - 0x1p-26F}.copy_to(r.data(), float16);
+  EXPECT_EQ((std::array<std::uint16_t, 4U>{0x0001U, 0x0000U, 0x0002U, 0x0400U}), r);
+
+  V{-0.0F, 1e-10F, -std::numeric_limits<float>::quiet_NaN(), 1e10F}.copy_to(r.data(), float16);
+  EXPECT_EQ(0x8000U, r[0]);
+  EXPECT_EQ(0x0000U, r[1]);
+  EXPECT_EQ(0xFE00U, r[2]);
+  EXPECT_EQ(0x7C00U, r[3]);
+}
+
+TEST(simd, Bfloat16) {
+  using V = fixed_size_simd<float, 4>;
+  const std::array<std::uint16_t, 4U> h{0x3F80U, 0xC000U, 0x7F80U, 0x0001U};
+  V v;
+  v.copy_from(h.data(), bfloat16);
+  EXPECT_TRUE(all_of(V{1.0F, -2.0F, std::numeric_limits<float>::infinity(), 0x1p-133F} == v));
+
+  std::array<std::uint16_t, 4U> r;
+  v.copy_to(r.data(), bfloat16);
+  EXPECT_EQ(h, r);
+
+  // ties to even, above the tie, the largest finite value rounded to infinity and a NaN which would round to infinity
+  const float nan{std::bit_cast<float>(0x7FFFFFFFU)};
+  V{1.0F + 0x1p-8F, 1.0F + 0x1p-8F + 0x1p-20F, std::numeric_limits<float>::max(), nan}.copy_to(r.data(), bfloat16);
+  EXPECT_EQ((std::array<std::uint16_t, 4U>{0x3F80U, 0x3F81U, 0x7F80U, 0x7FFFU}), r);
+}
+
+TEST(simd, Float16_WhenConstantEvaluated_ThenSame) {
+  using V = fixed_size_simd<float, 4>;
+  constexpr std::array<std::uint16_t, 4U> h{[] {
+    std::array<std::uint16_t, 4U> r{};
+    V{1.5F, -0.0F, 0x1p-24F, 65520.0F}.copy_to(r.data(), float16);
+    return r;
+  }()};
+  static_assert((h == std::array<std::uint16_t, 4U>{0x3E00U, 0x8000U, 0x0001U, 0x7C00U}), "not constant evaluated");
+
+  constexpr float f{[] {
+    const std::array<std::uint16_t, 4U> b{0x3F80U, 0x0001U, 0x3E00U, 0x4049U};
+    V v;
+    v.copy_from(b.data(), bfloat16);
+    V w;
+    w.copy_from(b.data(), float16);
+    return extract<3U>(v) + extract<1U>(w);
+  }()};
+  static_assert(0x1p-24F + 3.140625F == f, "not constant evaluated");
+}
+
 TEST(simd, Access_WhenOutOfBounds_ThenPreconditionViolated) {
   const fixed_size_simd<float, 4> a{23.0F};
 
   EXPECT_THROW(a[4U], parallelism_v2::detail::condition_violated);
 }
+#endif
+
+TEST(simd, ElementReference) {
+  fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+  const fixed_size_simd<float, 4> b{5.0F, 6.0F, 7.0F, 8.0F};
+
+  a[0U] = 23.0F;
+  a[1U] += 1.0F;
+  a[2U] *= 2.0F;
+  a[3U] = a[0U];
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{23.0F, 3.0F, 6.0F, 23.0F} == a));
+
+  for (std::size_t i{}; i < a.size(); ++i) {
+    a[i] -= b[i];
+  }
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{18.0F, -3.0F, -1.0F, 15.0F} == a));
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd, ElementReference_WhenOutOfBounds_ThenPreconditionViolated) {
+  fixed_size_simd<float, 4> a{23.0F};
+
+  EXPECT_THROW(a[4U] = 1.0F, parallelism_v2::detail::condition_violated);
+}
+#endif
+
+TEST(simd, ExtractInsert) {
+  const fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+
+  EXPECT_EQ(1.0F, extract<0U>(a));
+  EXPECT_EQ(2.0F, extract<1U>(a));
+  EXPECT_EQ(3.0F, extract<2U>(a));
+  EXPECT_EQ(4.0F, extract<3U>(a));
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{5.0F, 2.0F, 3.0F, 4.0F} == insert<0U>(a, 5.0F)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{1.0F, 5.0F, 3.0F, 4.0F} == insert<1U>(a, 5.0F)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{1.0F, 2.0F, 5.0F, 4.0F} == insert<2U>(a, 5.0F)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{1.0F, 2.0F, 3.0F, 5.0F} == insert<3U>(a, 5.0F)));
+
+  constexpr fixed_size_simd<float, 4> b{insert<2U>(fixed_size_simd<float, 4>{0.0F}, 7.0F)};
+  static_assert(7.0F == extract<2U>(b), "not constant evaluated");
+  static_assert(0.0F == extract<3U>(b), "not constant evaluated");
+}
+
+TEST(simd, Shuffle) {
+  const fixed_size_simd<float, 4> a{1.0F, 2.0F, 3.0F, 4.0F};
+  const fixed_size_simd<float, 4> b{5.0F, 6.0F, 7.0F, 8.0F};
+
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{4.0F, 3.0F, 2.0F, 1.0F} == shuffle<3U, 2U, 1U, 0U>(a, b)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{1.0F, 5.0F, 2.0F, 6.0F} == shuffle<0U, 4U, 1U, 5U>(a, b)));
+  EXPECT_TRUE(all_of(fixed_size_simd<float, 4>{8.0F, 8.0F, 1.0F, 7.0F} == shuffle<7U, 7U, 0U, 6U>(a, b)));
+
+  constexpr fixed_size_simd<float, 4> c{
+      shuffle<1U, 4U, 0U, 0U>(fixed_size_simd<float, 4>{1.0F, 2.0F, 3.0F, 4.0F}, fixed_size_simd<float, 4>{5.0F})};
+  static_assert(2.0F == extract<0U>(c), "not constant evaluated");
+  static_assert(5.0F == extract<1U>(c), "not constant evaluated");
+}
+
+TEST(simd, Permute) {
+  const simd<float> table{1.0F, 2.0F, 3.0F, 4.0F};
+
+  EXPECT_TRUE(all_of(simd<float>{4.0F, 3.0F, 2.0F, 1.0F} == permute(table, simd<std::int32_t>{3, 2, 1, 0})));
+  EXPECT_TRUE(all_of(simd<float>{2.0F, 2.0F, 4.0F, 1.0F} == permute(table, simd<std::int32_t>{1, 1, 3, 0})));
+
+  constexpr simd<float> c{permute(simd<float>{1.0F, 2.0F, 3.0F, 4.0F}, simd<std::int32_t>{2, 0, 0, 3})};
+  static_assert(3.0F == extract<0U>(c), "not constant evaluated");
+  static_assert(4.0F == extract<3U>(c), "not constant evaluated");
+}
+
+TEST(simd, Gather) {
+  constexpr std::array<float, 8U> memory{0.5F, 1.5F, 2.5F, 3.5F, 4.5F, 5.5F, 6.5F, 7.5F};
+
+  EXPECT_TRUE(all_of(simd<float>{7.5F, 0.5F, 3.5F, 3.5F} == gather(memory.data(), simd<std::int32_t>{7, 0, 3, 3})));
+
+  constexpr simd<float> c{gather(memory.data(), simd<std::int32_t>{6, 5, 4, 1})};
+  static_assert(6.5F == extract<0U>(c), "not constant evaluated");
+  static_assert(1.5F == extract<3U>(c), "not constant evaluated");
+}
+
+TEST(simd, PermuteBytes) {
+  const simd<std::uint32_t> v{0x03020100U, 0x07060504U, 0x0B0A0908U, 0x0F0E0D0CU};
+
+  EXPECT_TRUE(all_of(simd<std::uint32_t>{0x0C0D0E0FU, 0x08090A0BU, 0x04050607U, 0x00010203U} ==
+                     permute_bytes(v, simd<std::uint32_t>{0x0C0D0E0FU, 0x08090A0BU, 0x04050607U, 0x00010203U})));
+  // the bytes of variable-length integers moved into their elements, the high bit selects zero
+  EXPECT_TRUE(all_of(simd<std::uint32_t>{0x00000100U, 0x00000002U, 0x00050403U, 0x0C0B0A09U} ==
+                     permute_bytes(v, simd<std::uint32_t>{0xFFFF0100U, 0xFFFFFF02U, 0xFF050403U, 0x0C0B0A09U})));
+
+  constexpr simd<std::int32_t> c{
+      permute_bytes(simd<std::int32_t>{0x03020100, 0x07060504, 0x0B0A0908, 0x0F0E0D0C}, simd<std::int32_t>{-1})};
+  static_assert(0 == extract<0U>(c), "not constant evaluated");
+  static_assert(0 == extract<3U>(c), "not constant evaluated");
+}
+
+TEST(simd, MaddBytes) {
+  // the digits 1, 2, ..., 8, 9, 0, ... by the weights 10 and 1
+  const simd<std::uint32_t> digits{0x04030201U, 0x08070605U, 0x00000009U, 0xFF00FF00U};
+  const simd<std::uint32_t> weights{0x010A010AU};
+  EXPECT_TRUE(all_of(simd<std::uint32_t>{0x0022000CU, 0x004E0038U, 0x0000005AU, 0x00FF00FFU} ==
+                     madd_bytes(digits, weights)));
+  // saturated
+  EXPECT_TRUE(
+      all_of(simd<std::int32_t>{0x7FFF7FFF} == madd_bytes(simd<std::int32_t>{-1}, simd<std::int32_t>{0x7F7F7F7F})));
+  EXPECT_TRUE(all_of(simd<std::int32_t>{static_cast<std::int32_t>(0x80008000U)} ==
+                     madd_bytes(simd<std::int32_t>{-1}, simd<std::int32_t>{static_cast<std::int32_t>(0x80808080U)})));
+
+  constexpr simd<std::int32_t> c{madd_bytes(simd<std::int32_t>{0x04030201}, simd<std::int32_t>{0x010A010A})};
+  static_assert(0x0022000C == extract<0U>(c), "not constant evaluated");
+}
+
+TEST(simd, MaddHalves) {
+  // pairs of two digit numbers by the weights 100 and 1, then pairs of four digit numbers by 10000 and 1
+  EXPECT_TRUE(all_of(simd<std::int32_t>{1234, -1234, 0, 99999999} ==
+                     madd_halves(simd<std::int32_t>{0x0022000C, static_cast<std::int32_t>(0xFFDEFFF4U), 0, 0x270F270F},
+                                 simd<std::int32_t>{0x00010064, 0x00010064, 0x00010064, 0x00012710})));
+  // wraps
+  EXPECT_EQ(std::numeric_limits<std::int32_t>::min(),
+            extract<0U>(madd_halves(simd<std::int32_t>{static_cast<std::int32_t>(0x80008000U)},
+                                    simd<std::int32_t>{static_cast<std::int32_t>(0x80008000U)})));
+
+  constexpr simd<std::int32_t> c{madd_halves(simd<std::int32_t>{0x0022000C}, simd<std::int32_t>{0x00010064})};
+  static_assert(1234 == extract<0U>(c), "not constant evaluated");
+}
+
+TEST(simd, StaticSimdCast) {
+  EXPECT_TRUE(all_of(simd<std::int32_t>{1, -1, 0, 16777217} ==
+                     static_simd_cast<std::int32_t>(simd<float>{1.9F, -1.9F, -0.5F, 16777216.0F}) +
+                         simd<std::int32_t>{0, 0, 0, 1}));
+  EXPECT_TRUE(all_of(simd<float>{1.0F, -7.0F, 0.0F, 16777216.0F} ==
+                     static_simd_cast<float>(simd<std::int32_t>{1, -7, 0, 16777217})));
+
+  constexpr simd<std::int32_t> c{static_simd_cast<std::int32_t>(simd<float>{-2.5F})};
+  static_assert(-2 == extract<0U>(c), "not constant evaluated");
+  constexpr simd<float> d{static_simd_cast<float>(simd<std::int32_t>{3})};
+  static_assert(3.0F == extract<0U>(d), "not constant evaluated");
+}
 
 TEST(simd, Add) {
   const simd<float> nan{std::numeric_limits<float>::quiet_NaN()};
@@ -360,6 +629,173 @@ TEST(simd, Max) {
   EXPECT_TRUE(all_of(is_nan(max(nan, two))));
 }
 
+TEST(simd, Reduce) {
+  EXPECT_EQ(10.0F, reduce(fixed_size_simd<float, 4>{1.0F, 2.0F, 3.0F, 4.0F}));
+  EXPECT_EQ(-2, reduce(fixed_size_simd<std::int32_t, 4>{1, -2, 3, -4}));
+
+  static_assert(6.0F == reduce(fixed_size_simd<float, 4>{3.0F, 2.0F, 1.0F, 0.0F}), "not constant evaluated");
+}
+
+TEST(simd, HorizontalMinMax) {
+  const fixed_size_simd<float, 4> a{3.0F, -1.0F, 4.0F, 1.0F};
+  const fixed_size_simd<std::int32_t, 4> b{3, -1, 4, 1};
+
+  EXPECT_EQ(-1.0F, hmin(a));
+  EXPECT_EQ(4.0F, hmax(a));
+  EXPECT_EQ(-1, hmin(b));
+  EXPECT_EQ(4, hmax(b));
+
+  static_assert(-1 == hmin(fixed_size_simd<std::int32_t, 4>{3, -1, 4, 1}), "not constant evaluated");
+  static_assert(4.0F == hmax(fixed_size_simd<float, 4>{3.0F, -1.0F, 4.0F, 1.0F}), "not constant evaluated");
+}
+
+TEST(simd, Int32) {
+  using V = fixed_size_simd<std::int32_t, 4>;
+  const V a{1, -2, 3, -4};
+  const V b{2, 2, -2, -2};
+
+  EXPECT_TRUE(all_of(V{3, 0, 1, -6} == a + b));
+  EXPECT_TRUE(all_of(V{-1, -4, 5, -2} == a - b));
+  EXPECT_TRUE(all_of(V{2, -4, -6, 8} == a * b));
+  EXPECT_TRUE(all_of(V{0, -1, -1, 2} == a / b));
+  EXPECT_TRUE(all_of(V{-1, 2, -3, 4} == -a));
+  EXPECT_TRUE(all_of(V{1, -2, -2, -4} == min(a, b)));
+  EXPECT_TRUE(all_of(V{2, 2, 3, -2} == max(a, b)));
+  EXPECT_TRUE(all_of(V{1, -1, 2, -2} == inclusive_scan(a)));
+  EXPECT_TRUE(all_of(V{0, 1, -1, 2} == exclusive_scan(a)));
+  const fixed_size_simd_mask<std::int32_t, 4> less{a < b};
+  EXPECT_TRUE(less[0U] && less[1U] && !less[2U] && less[3U]);
+  EXPECT_EQ(3, popcount(a <= b));
+  EXPECT_EQ(1, popcount(a > b));
+  EXPECT_EQ(1, popcount(a >= b));
+  EXPECT_TRUE(none_of(a == b));
+  EXPECT_TRUE(all_of(a != b));
+
+  V c{a};
+  c[2U] = 7;
+  where(a < b, c) += V{10};
+  EXPECT_TRUE(all_of(V{11, 8, 7, 6} == c));
+  EXPECT_EQ(8, extract<1U>(c));
+  EXPECT_EQ(7, c[2U]);
+  EXPECT_TRUE(all_of(V{11, 8, 5, 6} == insert<2U>(c, 5)));
+
+  constexpr V d{V{1, 2, 3, 4} * V{2} - V{1}};
+  static_assert(7 == extract<3U>(d), "not constant evaluated");
+}
+
+TEST(simd, Uint32) {
+  using V = fixed_size_simd<std::uint32_t, 4>;
+  const V a{1U, 0x80000000U, 3U, 0xFFFFFFFFU};
+  const V b{2U, 2U, 0x80000000U, 0U};
+
+  EXPECT_TRUE(all_of(V{3U, 0x80000002U, 0x80000003U, 0xFFFFFFFFU} == a + b));
+  EXPECT_TRUE(all_of(V{0U, 0x40000000U, 0U, 0xFFFFFFFFU} == a / V{2U, 2U, 4U, 1U}));
+  EXPECT_TRUE(all_of(V{1U, 2U, 3U, 0U} == min(a, b)));
+  EXPECT_TRUE(all_of(V{2U, 0x80000000U, 0x80000000U, 0xFFFFFFFFU} == max(a, b)));
+  const fixed_size_simd_mask<std::uint32_t, 4> less{a < b};
+  EXPECT_TRUE(less[0U] && !less[1U] && less[2U] && !less[3U]);
+  EXPECT_EQ(2, popcount(a >= b));
+  EXPECT_EQ(0xFFFFFFFFU, hmax(a));
+  EXPECT_EQ(0U, hmin(b));
+  EXPECT_EQ(0x80000003U, reduce(V{1U, 0x80000000U, 2U, 0U}));
+  EXPECT_EQ(0x80000000U, extract<1U>(a));
+  EXPECT_EQ(0xFFFFFFFFU, a[3U]);
+
+  constexpr V c{insert<3U>(V{7U}, 0xFFFFFFFFU)};
+  static_assert(3U == hmin(c >> 1), "not constant evaluated");
+  static_assert(0x7FFFFFFFU == hmax(c >> 1), "not constant evaluated");
+}
+
+TEST(simd, Bitwise) {
+  using U = fixed_size_simd<std::uint32_t, 4>;
+  using I = fixed_size_simd<std::int32_t, 4>;
+  const U a{0xF0F0F0F0U, 0U, 1U, 0x80000000U};
+  const U b{0xFF00FF00U, 0xFFFFFFFFU, 3U, 1U};
+
+  EXPECT_TRUE(all_of(U{0xF000F000U, 0U, 1U, 0U} == (a & b)));
+  EXPECT_TRUE(all_of(U{0xFFF0FFF0U, 0xFFFFFFFFU, 3U, 0x80000001U} == (a | b)));
+  EXPECT_TRUE(all_of(U{0x0FF00FF0U, 0xFFFFFFFFU, 2U, 0x80000001U} == (a ^ b)));
+  EXPECT_TRUE(all_of(U{0x0F0F0F0FU, 0xFFFFFFFFU, 0xFFFFFFFEU, 0x7FFFFFFFU} == ~a));
+  EXPECT_TRUE(all_of(U{0xE1E1E1E0U, 0U, 2U, 0U} == (a << 1)));
+  EXPECT_TRUE(all_of(U{0x0F0F0F0FU, 0U, 0U, 0x08000000U} == (a >> 4)));
+  EXPECT_TRUE(all_of(I{-8, 8, -1, 0} == (I{-128, 128, -1, 0} >> 4)));
+  EXPECT_TRUE(all_of(I{-256, 256, -2, 0} == (I{-128, 128, -1, 0} << 1)));
+
+  U c{a};
+  c ^= b;
+  c &= U{0xFFU};
+  c |= U{0x100U};
+  c <<= 4;
+  c >>= 8;
+  EXPECT_TRUE(all_of(U{0x1FU, 0x1FU, 0x10U, 0x10U} == c));
+
+  EXPECT_TRUE(all_of((simd<char>{'a'} & simd<char>{'\x5F'}) == simd<char>{'A'}));
+  EXPECT_TRUE(all_of((simd<char>{'A'} | simd<char>{'\x20'}) == simd<char>{'a'}));
+  EXPECT_TRUE(all_of((simd<char>{'\x10'} >> 4) == simd<char>{'\x01'}));
+
+  constexpr U d{(U{1U} << 31) >> 31};
+  static_assert(1U == extract<0U>(d), "not constant evaluated");
+  static_assert(-1 == extract<0U>(I{-2} >> 1), "not constant evaluated");
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd, Shift_WhenCountIsWidth_ThenPreconditionViolated) {
+  const fixed_size_simd<std::uint32_t, 4> v{1U};
+
+  EXPECT_THROW(v << 32, parallelism_v2::detail::condition_violated);
+  EXPECT_THROW(v >> -1, parallelism_v2::detail::condition_violated);
+}
+#endif
+
+TEST(simd, Char) {
+  using V = simd<char>;
+  V a{'a'};
+  a[1U] = 'z';
+  a[2U] = ',';
+
+  EXPECT_EQ('z', extract<1U>(a));
+  EXPECT_EQ('z', hmax(a));
+  EXPECT_EQ(',', hmin(a));
+  EXPECT_EQ(1, popcount(a == V{'z'}));
+  EXPECT_EQ(static_cast<int>(V::size()) - 2, popcount(a < V{'b'} && a > V{','}));
+  EXPECT_TRUE(all_of(a - a == V{'\0'}));
+  EXPECT_TRUE(all_of(min(a, V{'b'}) <= V{'b'}));
+  EXPECT_EQ(static_cast<char>(V::size()), extract<V::size() - 1U>(inclusive_scan(V{1})));
+
+  const V set{insert<1U>(V{';'}, ',')};
+  EXPECT_EQ(2, find_first_set(is_any_of(a, set, 2U)));
+  EXPECT_TRUE(none_of(is_any_of(a, set, 1U)));
+  EXPECT_TRUE(none_of(is_any_of(a, set, 0U)));
+
+  static_assert(3 == find_first_set(is_any_of(insert<3U>(V{'x'}, '\n'), V{'\n'}, 1U)), "not constant evaluated");
+}
+
+TEST(simd, IsInRanges) {
+  using V = simd<char>;
+  const V digits{insert<1U>(V{'0'}, '9')};
+  const V v{insert<2U>(insert<1U>(V{'-'}, '7'), '9')};
+
+  EXPECT_EQ(1, find_first_set(is_in_ranges(v, digits, 2U)));
+  EXPECT_EQ(2, popcount(is_in_ranges(v, digits, 2U)));
+  EXPECT_TRUE(none_of(is_in_ranges(v, digits, 0U)));
+  // a second range of one element
+  EXPECT_TRUE(all_of(is_in_ranges(v, insert<3U>(insert<2U>(digits, '-'), '-'), 4U)));
+  // signed like the comparisons of char
+  EXPECT_EQ(0, find_first_set(is_in_ranges(insert<0U>(V{'a'}, '\x80'), insert<1U>(V{'\x80'}, '\0'), 2U)));
+
+  static_assert(1 == find_first_set(is_in_ranges(insert<1U>(V{'x'}, '5'), insert<1U>(V{'0'}, '9'), 2U)),
+                "not constant evaluated");
+}
+
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
+TEST(simd, IsInRanges_WhenOddNumberOfBounds_ThenPreconditionViolated) {
+  using V = simd<char>;
+  const V digits{insert<1U>(V{'0'}, '9')};
+
+  EXPECT_THROW(is_in_ranges(V{'5'}, digits, 1U), parallelism_v2::detail::condition_violated);
+}
+#endif
+
 TEST(simd, Clamp) {
   const simd<float> one{1.0F};
   const simd<float> low{-1.0F};
@@ -370,6 +806,7 @@ TEST(simd, Clamp) {
   EXPECT_TRUE(all_of(high == clamp(simd<float>{2.0F}, low, high)));
 }
 
+#if SIMD_CONTRACT_LEVEL == SIMD_CONTRACT_THROW
 TEST(simd, Clamp_WhenNoValidBoundaryInterval_ThenPreconditionViolated) {
   const simd<float> one{1.0F};
   const simd<float> low{-1.0F};
@@ -377,6 +814,7 @@ TEST(simd, Clamp_WhenNoValidBoundaryInterval_ThenPreconditionViolated) {
 
   EXPECT_THROW(clamp(one, high, low), parallelism_v2::detail::condition_violated);
 }
+#endif
 
 TEST(simd, WhereAssignment) {
   fixed_size_simd<float, 4> value{6.0F, 9.0F, 16.0F, 25.0F};